@@ -30,7 +30,7 @@
 #
 # Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
 
-CONFIG += c++11
+CONFIG += c++11 thread
 
 mac {
     CONFIG -= app_bundle
@@ -40,6 +40,19 @@ mac {
 # Path to the newest version of Boost Library
 #INCLUDEPATH += /path/to/boost_x_xx_x
 
+# Vectorized batch cell current evaluation - only for CPUs with AVX2
+#QMAKE_CXXFLAGS += -mavx2
+
+# Least important messages compiled in - 0 error, 1 warning, 2 info (the
+#  default), 3 debug
+#DEFINES += RRAMSPEC_LOG_LEVEL=3
+
+# Performance counters (-stats) compiled out
+#DEFINES += RRAMSPEC_STATS=0
+
+# Trace events (-trace) compiled out
+#DEFINES += RRAMSPEC_TRACE=0
+
 #RERAMSpec License
 OTHER_FILES += License
 
@@ -48,15 +61,25 @@ HEADERS += utils/constants.h
 HEADERS += utils/globalStructs.h
 HEADERS += utils/functions.h
 HEADERS += utils/Param.h
+HEADERS += utils/ResultCache.h
+HEADERS += utils/PerfStats.h
+HEADERS += utils/Trace.h
+HEADERS += utils/SolverGuard.h
+HEADERS += utils/WorkerPool.h
 
 HEADERS += parser/ArgumentsParser.h
 HEADERS += parser/JsonAssist.h
 
 HEADERS += core/Cell.h
+HEADERS += core/LineSolver.h
+HEADERS += core/ArraySolver.h
 HEADERS += core/Technology.h
 HEADERS += core/XPointArray.h
 HEADERS += core/Bank.h
 
+HEADERS += parser/RramSpecLib.h
+HEADERS += parser/ResultWriter.h
+HEADERS += parser/RramServer.h
 HEADERS += parser/RramSpec.h
 
 HEADERS += expandedBoostUnits/DerivedDimensions/*
@@ -66,12 +89,22 @@ HEADERS += expandedBoostUnits/*
 #RRAMSpec SOURCE files
 SOURCES += utils/functions.cpp
 SOURCES += utils/Param.cpp
+SOURCES += utils/ResultCache.cpp
+SOURCES += utils/PerfStats.cpp
+SOURCES += utils/Trace.cpp
+SOURCES += utils/SolverGuard.cpp
+SOURCES += utils/WorkerPool.cpp
 
 SOURCES += parser/ArgumentsParser.cpp
 SOURCES += parser/JsonAssist.cpp
+SOURCES += parser/RramSpecLib.cpp
+SOURCES += parser/ResultWriter.cpp
+SOURCES += parser/RramServer.cpp
 SOURCES += parser/RramSpec.cpp
 
 SOURCES += core/Cell.cpp
+SOURCES += core/LineSolver.cpp
+SOURCES += core/ArraySolver.cpp
 SOURCES += core/Technology.cpp
 SOURCES += core/XPointArray.cpp
 SOURCES += core/Bank.cpp
@@ -90,9 +123,32 @@ CONFIG(release, debug|release) {
 
     QMAKE_CXXFLAGS += -Wextra -Wall
 
-    SOURCES += main.cpp
-
-    TARGET = rramspec
+    # Embeddable library instead of the program - see parser/RramSpecLib.h
+    #  qmake CONFIG+=release CONFIG+=rramspec_lib RRAMSpec.pro
+    rramspec_lib {
+        TEMPLATE = lib
+        CONFIG += staticlib
+    }
+    # Microbenchmarks of the model hot paths - see runBenchmarks.sh
+    #  qmake CONFIG+=release CONFIG+=rramspec_bench RRAMSpec.pro
+    else:rramspec_bench {
+        HEADERS += benchmarks/Benchmark.h
+        SOURCES += benchmarks/Benchmark.cpp
+        SOURCES += benchmarks/CellBenchmark.cpp
+        SOURCES += benchmarks/XPointArrayBenchmark.cpp
+        SOURCES += benchmarks/BankBenchmark.cpp
+        SOURCES += benchmarks/benchmarksRunner.cpp
+    }
+    else {
+        SOURCES += main.cpp
+    }
+
+    rramspec_bench {
+        TARGET = rramspec_bench
+    }
+    else {
+        TARGET = rramspec
+    }
 }
 
 CONFIG(debug, debug|release) {
@@ -108,13 +164,24 @@ CONFIG(debug, debug|release) {
     #UNIT TEST using Boost/Test HEADERS and SOURCE files // Degub only
     SOURCES += tests/classTests/FunctionsTest.cpp
     SOURCES += tests/classTests/ParamTest.cpp
+    SOURCES += tests/classTests/ResultCacheTest.cpp
+    SOURCES += tests/classTests/PerfStatsTest.cpp
+    SOURCES += tests/classTests/TraceTest.cpp
+    SOURCES += tests/classTests/SolverGuardTest.cpp
+    SOURCES += tests/classTests/WorkerPoolTest.cpp
 
     SOURCES += tests/classTests/ArgumentsParserTest.cpp
     SOURCES += tests/classTests/JsonAssistTest.cpp
 
     SOURCES += tests/classTests/CellTest.cpp
+    SOURCES += tests/classTests/LineSolverTest.cpp
+    SOURCES += tests/classTests/ArraySolverTest.cpp
     SOURCES += tests/classTests/TechnologyTest.cpp
     SOURCES += tests/classTests/XPointArrayTest.cpp
+    SOURCES += tests/classTests/BankTest.cpp
+    SOURCES += tests/classTests/RramSpecLibTest.cpp
+    SOURCES += tests/classTests/ResultWriterTest.cpp
+    SOURCES += tests/classTests/RramServerTest.cpp
 
     SOURCES += tests/testsRunner.cpp
 
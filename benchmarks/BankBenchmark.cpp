@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, University of Kaiserslautern
+ * Copyright (c) 2019, University of Kaiserslautern
  * All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
@@ -29,33 +29,40 @@
  * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  *
- * Authors: Andr'e Lucas Chinazzo Matthias Jung, Christian Weis, Kamal Haddad
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
  */
 
-// this class is used to parse the results of timing and 
-// current into json files
-#ifndef RESULTPARSER_H
-#define RESULTPARSER_H
-#include "rapidjson/include/rapidjson/document.h"
-#include "rapidjson/include/rapidjson/prettywriter.h"
-#include "rapidjson/include/rapidjson/stringbuffer.h"
-#include "../core/Current.h"
-#include <stdio.h>
-#include <string>
-class ResultParser
+
+#include "Benchmark.h"
+
+#include "../core/Bank.h"
+
+#include <sstream>
+
+// Whole bank runs - the mode of the architecture file, over every
+//  combination of the shipped inputs. Each run starts from empty cell I-V
+//  table caches, as a new process would
+void runBankBenchmarks(BenchmarkRunner& runner)
 {
-  public:
-    ResultParser(Timing T , Current I): t(NULL), i(NULL)
-    {
-        t=&T;
-        i=&I;
+  for (const auto& cellFileName : runner.inputFiles("cells")) {
+    for (const auto& techFileName : runner.inputFiles("techs")) {
+      for (const auto& archFileName : runner.inputFiles("archs")) {
+        Config config;
+        config.cellFileName = cellFileName;
+        config.techFileName = techFileName;
+        config.archFileName = archFileName;
+
+        string parameter = cellFileName + ", " + techFileName + ", "
+                           + archFileName;
+        runner.run("Bank", parameter, 1, [&]() {
+          ostringstream discardedMessages;
+          MessageRedirection redirection(&discardedMessages);
+          Bank bank(config);
+          keepBenchmarkValue(bank.getTccdw().value());
+        }, []() {
+          Cell::clearCellIxVCache();
+        });
+      }
     }
-    void 
-    jsonwriter(int filenumber);
-  private:
-    //object which contains results of timing
-    Timing* t;
-    //object which contains results of currents
-    Current* i;
-};
-#endif
+  }
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+#include "Benchmark.h"
+
+#include "../parser/JsonAssist.h"
+#include "../utils/PerfStats.h"
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include <dirent.h>
+
+static volatile double benchmarkSink = 0.;
+
+void keepBenchmarkValue(double value)
+{
+  benchmarkSink = benchmarkSink + value;
+}
+
+BenchmarkRunner::BenchmarkRunner(ostream& output_, const string& filter_,
+                                 size_t nRepetitions_,
+                                 const string& inputDir_)
+  : output(output_)
+{
+  filter = filter_;
+  nRepetitions = nRepetitions_;
+  inputDir = inputDir_;
+  if ( nRepetitions == 0 ) {
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("Benchmarks need at least one repetition.\n");
+    throw exceptionMsgThrown;
+  }
+}
+
+void
+BenchmarkRunner::run(const string& name, const string& parameter,
+                     size_t nCalls, const function<void()>& body,
+                     const function<void()>& setup)
+{
+  if ( name.find(filter) == string::npos
+       && parameter.find(filter) == string::npos ) {
+    return;
+  }
+  cerr << "Running " << name << " (" << parameter << ")" << endl;
+
+  // Warm-up - first touch of the memory and of the process caches
+  if ( setup ) { setup(); }
+  body();
+
+  vector<double> callTimes;
+  uint64_t nIterations = 0;
+  for (size_t repetition = 0; repetition < nRepetitions; ++repetition) {
+    if ( setup ) { setup(); }
+    uint64_t firstIteration = threadPerfStats().solverIterations;
+    auto start = chrono::steady_clock::now();
+    body();
+    chrono::duration<double, nano> elapsed =
+        chrono::steady_clock::now() - start;
+    nIterations += threadPerfStats().solverIterations - firstIteration;
+    callTimes.push_back(elapsed.count() / double(nCalls));
+  }
+
+  sort(callTimes.begin(), callTimes.end());
+  size_t middle = callTimes.size() / 2;
+  double medianTime = callTimes.size() % 2 == 1 ? callTimes[middle]
+                      : (callTimes[middle-1] + callTimes[middle]) / 2.;
+
+  output << "{" << jsonString("Benchmark") << ":" << jsonString(name)
+         << "," << jsonString("Parameter") << ":" << jsonString(parameter)
+         << "," << jsonString("Repetitions []") << ":" << nRepetitions
+         << "," << jsonString("Calls per repetition []") << ":" << nCalls
+         << "," << jsonString("Median time per call [ns]") << ":"
+         << jsonNumber(medianTime)
+         << "," << jsonString("Min time per call [ns]") << ":"
+         << jsonNumber(callTimes.front())
+         << "," << jsonString("Max time per call [ns]") << ":"
+         << jsonNumber(callTimes.back())
+         << "," << jsonString("Solver iterations per call []") << ":"
+         << jsonNumber(double(nIterations) / (nRepetitions * nCalls))
+         << "}" << endl;
+}
+
+vector<string>
+BenchmarkRunner::inputFiles(const string& subdirectory) const
+{
+  string directoryName = inputDir + "/" + subdirectory;
+  DIR* directory = opendir(directoryName.c_str());
+  if ( directory == nullptr ) {
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("Could not open the input directory: ");
+    exceptionMsgThrown.append(directoryName);
+    exceptionMsgThrown.append("\n");
+    throw exceptionMsgThrown;
+  }
+
+  vector<string> fileNames;
+  while ( struct dirent* entry = readdir(directory) ) {
+    string entryName(entry->d_name);
+    if ( entryName.size() > 5
+         && entryName.compare(entryName.size() - 5, 5, ".json") == 0 ) {
+      fileNames.push_back(directoryName + "/" + entryName);
+    }
+  }
+  closedir(directory);
+
+  sort(fileNames.begin(), fileNames.end());
+  return fileNames;
+}
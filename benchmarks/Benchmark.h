@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+/* Microbenchmarks of the model hot paths, for comparing builds and
+ * solver changes over time. Each benchmark runs its body once to warm up,
+ * then times it over a number of repetitions, each starting from the same
+ * state, and writes one JSON line with the median, minimum and maximum
+ * time per call and the solver iterations per call. Inputs are fixed, so
+ * only the machine and the build change the figures.
+*/
+
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+class BenchmarkRunner
+{
+public:
+  // Only the benchmarks whose name or parameter contain the filter run
+  //  Inputs are read from the cells/, techs/ and archs/ of inputDir
+  BenchmarkRunner(ostream& output, const string& filter,
+                  size_t nRepetitions, const string& inputDir);
+
+  // Times body, which makes nCalls calls of the benchmarked function.
+  //  setup runs before each repetition, untimed
+  void run(const string& name, const string& parameter, size_t nCalls,
+           const function<void()>& body,
+           const function<void()>& setup = nullptr);
+
+  // JSON files of the input subdirectory, sorted by name
+  vector<string> inputFiles(const string& subdirectory) const;
+
+private:
+  ostream& output;
+  string filter;
+  size_t nRepetitions;
+  string inputDir;
+};
+
+// Value the compiler must compute, so benchmarked calls are not dropped
+void keepBenchmarkValue(double value);
+
+void runCellBenchmarks(BenchmarkRunner& runner);
+void runXPointArrayBenchmarks(BenchmarkRunner& runner);
+void runBankBenchmarks(BenchmarkRunner& runner);
+
+#endif // BENCHMARK_H
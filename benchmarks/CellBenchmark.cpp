@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+#include "Benchmark.h"
+
+#include "../core/Cell.h"
+
+// Voltages swept by the cell current benchmarks
+static const size_t nSweepVoltages = 1000;
+static const double maxSweepVoltage = 3.;
+
+void runCellBenchmarks(BenchmarkRunner& runner)
+{
+  for (const auto& cellFileName : runner.inputFiles("cells")) {
+    Cell cell(cellFileName.c_str());
+
+    for (bool resistanceState : {false, true}) {
+      cell.setMemDevResistanceState(resistanceState);
+      string parameter = cellFileName
+                         + (resistanceState ? ", LRS" : ", HRS");
+
+      runner.run("Cell::calcCellCurrent", parameter, nSweepVoltages, [&]() {
+        for (size_t voltageID = 0; voltageID < nSweepVoltages; ++voltageID) {
+          double voltage = maxSweepVoltage * voltageID / nSweepVoltages;
+          keepBenchmarkValue(
+              cell.calcCellCurrent(voltage * rrs::volts).value());
+        }
+      });
+    }
+
+    // Each build starts from an empty table cache
+    runner.run("Cell::buildCellIxV", cellFileName, 1, [&]() {
+      cell.buildCellIxV();
+    }, []() {
+      Cell::clearCellIxVCache();
+    });
+
+    cell.buildCellIxV();
+    for (bool resistanceState : {false, true}) {
+      cell.setMemDevResistanceState(resistanceState);
+      string parameter = cellFileName
+                         + (resistanceState ? ", LRS" : ", HRS");
+
+      runner.run("Cell::getCellCurrent", parameter, nSweepVoltages, [&]() {
+        for (size_t voltageID = 0; voltageID < nSweepVoltages; ++voltageID) {
+          double voltage = maxSweepVoltage * voltageID / nSweepVoltages;
+          keepBenchmarkValue(
+              cell.getCellCurrent(voltage * rrs::volts).value());
+        }
+      });
+    }
+  }
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+#include "Benchmark.h"
+
+#include "../core/XPointArray.h"
+
+#include <sstream>
+
+// The selected cell solves are private - they are timed through the write
+//  operation update, which makes exactly the reset and the set solves
+void runXPointArrayBenchmarks(BenchmarkRunner& runner)
+{
+  Config config;
+  config.cellFileName = runner.inputFiles("cells").at(0);
+  config.techFileName = runner.inputFiles("techs").at(0);
+  config.archFileName = runner.inputFiles("archs").at(0);
+
+  for (double nLines = 256; nLines <= 8192; nLines *= 2) {
+    ostringstream discardedMessages;
+    MessageRedirection redirection(&discardedMessages);
+
+    XPointArray preparedArray(config);
+    preparedArray.setNRows(nLines);
+    preparedArray.setNCols(nLines);
+    preparedArray.updateGeometry();
+    preparedArray.updateDelays();
+
+    ostringstream parameter;
+    parameter << nLines << " x " << nLines << " lines, reset and set";
+    XPointArray array(preparedArray);
+    runner.run("XPointArray::calcVSelectedCell", parameter.str(), 2, [&]() {
+      array.updateWriteOperation();
+      keepBenchmarkValue(array.getWriteTime().value());
+    }, [&]() {
+      array = preparedArray;
+    });
+  }
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+#include "Benchmark.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+static const char* benchmarkHelpMessage =
+        "  Optional:\n"
+        "    -filter       <text>   "
+          "(Run only the benchmarks whose name or parameter contain the "
+            "text.)\n"
+        "    -repetitions  <N>      "
+          "(Timed repetitions of each benchmark. Default is 5.)\n"
+        "    -inputs       <path>   "
+          "(Directory holding the cells/, techs/ and archs/ inputs. "
+            "Default is the working directory.)\n"
+        "Results are written to stdout as JSON lines, progress to stderr.\n";
+
+int main(int argc, char** argv)
+{
+  try {
+    string filter;
+    size_t nRepetitions = 5;
+    string inputDir(".");
+
+    for (int argID = 1; argID < argc; ++argID) {
+      string argument(argv[argID]);
+      if ( argument == "-h" ) {
+        cout << benchmarkHelpMessage;
+        return 0;
+      }
+      if ( argID + 1 >= argc ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Unexpected argument \'");
+        exceptionMsgThrown.append(argument);
+        exceptionMsgThrown.append("\'\n");
+        exceptionMsgThrown.append(benchmarkHelpMessage);
+        throw exceptionMsgThrown;
+      }
+      if ( argument == "-filter" ) {
+        filter = argv[++argID];
+      }
+      else if ( argument == "-repetitions" ) {
+        nRepetitions = strtoul(argv[++argID], nullptr, 10);
+      }
+      else if ( argument == "-inputs" ) {
+        inputDir = argv[++argID];
+      }
+      else {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Unexpected argument \'");
+        exceptionMsgThrown.append(argument);
+        exceptionMsgThrown.append("\'\n");
+        exceptionMsgThrown.append(benchmarkHelpMessage);
+        throw exceptionMsgThrown;
+      }
+    }
+
+    BenchmarkRunner runner(cout, filter, nRepetitions, inputDir);
+    runCellBenchmarks(runner);
+    runXPointArrayBenchmarks(runner);
+    runBankBenchmarks(runner);
+
+  } catch(string exceptionMsgThrown) {
+    std::cerr << exceptionMsgThrown;
+    return -1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,755 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+
+
+#include "ArraySolver.h"
+
+using namespace std;
+
+// Newton needs finite conductances - ideal wires get a negligible resistance
+#define MIN_SOLVER_RESISTANCE 1e-6
+// Cells past their last I-V point have no slope - a node left floating on
+//  them would make the Jacobian singular, so slopes are floored [A/V]
+#define MIN_CELL_CONDUCTANCE 1e-12
+
+// Work is split in (at most) this many blocks, whatever the thread count
+#define N_PARALLEL_BLOCKS 64
+// Arrays with less nodes than this are solved in a single thread
+#define MIN_PARALLEL_NODES 32768
+
+// Relative residual targets of the conjugate gradients solves
+//  Newton steps only need to be as accurate as the residual reduction
+//  they bring, while the driver sensitivity is used as is
+#define NEWTON_CG_TOLERANCE 1e-3
+#define SENSITIVITY_CG_TOLERANCE 1e-8
+
+void
+ArraySolver::checkSetup() const
+{
+  if ( nPLSegs < 1 || nNLSegs < 1 ||
+       selectedCell == nullptr || unselectedCell == nullptr ||
+       vNodes.size() != nNodes() ) {
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("Unexpected behaviour - ");
+    exceptionMsgThrown.append("tried to run the array solver");
+    exceptionMsgThrown.append(" before its lines and cells were set.\n");
+    throw exceptionMsgThrown;
+  }
+}
+
+size_t
+ArraySolver::nNodes() const
+{
+  return 2 * nPLSegs * nNLSegs;
+}
+
+size_t
+ArraySolver::PNode(size_t PLine, size_t NLine) const
+{
+  return PLine * nPLSegs + NLine;
+}
+
+size_t
+ArraySolver::NNode(size_t PLine, size_t NLine) const
+{
+  return nPLSegs * nNLSegs + PLine * nPLSegs + NLine;
+}
+
+double
+ArraySolver::PDriverConductance(size_t PLine) const
+{
+  if ( PLine != 0 && biasScheme == floating_bias ) {
+    return 0.;
+  }
+  double driverResistance =
+      (PLine == 0) ? PAMUXResistance : halfBiasDriverResistance;
+  return 1. / max(driverResistance + PLResistancePerCell,
+                  MIN_SOLVER_RESISTANCE);
+}
+
+double
+ArraySolver::NDriverConductance(size_t NLine) const
+{
+  if ( NLine != nPLSegs-1 && biasScheme == floating_bias ) {
+    return 0.;
+  }
+  double driverResistance =
+      (NLine == nPLSegs-1) ? NAMUXResistance : halfBiasDriverResistance;
+  return 1. / max(driverResistance + NLResistancePerCell,
+                  MIN_SOLVER_RESISTANCE);
+}
+
+template <typename Body>
+void
+ArraySolver::parallelFor(size_t n, Body body) const
+{
+  size_t nBlocks = min(n, (size_t) N_PARALLEL_BLOCKS);
+  auto runBlock = [&](size_t block) {
+    body(block * n / nBlocks, (block + 1) * n / nBlocks);
+  };
+
+  size_t nWorkers = min(nWorkerThreads(nThreads), nBlocks);
+  if ( nWorkers <= 1 || nNodes() < MIN_PARALLEL_NODES ) {
+    for (size_t block = 0; block < nBlocks; ++block) {
+      runBlock(block);
+    }
+    return;
+  }
+
+  // Contiguous blocks per worker - each block always sees the same range
+  workerPool.run(nWorkers, [&](size_t worker) {
+    for (size_t block = worker * nBlocks / nWorkers;
+         block < (worker + 1) * nBlocks / nWorkers; ++block) {
+      runBlock(block);
+    }
+  });
+}
+
+double
+ArraySolver::parallelSum(size_t n,
+                         const vector<double>& a,
+                         const vector<double>& b) const
+{
+  // Partial sums are added in block order, so the total is reproducible
+  vector<double> blockSums(N_PARALLEL_BLOCKS, 0.);
+  size_t nBlocks = min(n, (size_t) N_PARALLEL_BLOCKS);
+  parallelFor(n, [&](size_t first, size_t last) {
+    double sum = 0.;
+    for (size_t k = first; k < last; ++k) {
+      sum += a[k] * b[k];
+    }
+    // Block whose range starts at first
+    blockSums[(first * nBlocks + n - 1) / n] = sum;
+  });
+  return accumulate(blockSums.begin(), blockSums.end(), 0.);
+}
+
+void
+ArraySolver::setArray(size_t _nPLSegs, size_t _nNLSegs,
+                      double _PLResistancePerCell, double _NLResistancePerCell,
+                      double _PAMUXResistance, double _NAMUXResistance,
+                      double _halfBiasDriverResistance)
+{
+  if ( _nPLSegs < 1 || _nNLSegs < 1 ||
+       !areValid(_PLResistancePerCell, _NLResistancePerCell,
+                 _PAMUXResistance, _NAMUXResistance,
+                 _halfBiasDriverResistance) ) {
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("Unexpected behaviour - ");
+    exceptionMsgThrown.append("tried to set up the array solver");
+    exceptionMsgThrown.append(" with empty lines or unknown resistances.\n");
+    throw exceptionMsgThrown;
+  }
+
+  nPLSegs = _nPLSegs;
+  nNLSegs = _nNLSegs;
+  PLResistancePerCell = _PLResistancePerCell;
+  NLResistancePerCell = _NLResistancePerCell;
+  PAMUXResistance = _PAMUXResistance;
+  NAMUXResistance = _NAMUXResistance;
+  halfBiasDriverResistance = _halfBiasDriverResistance;
+
+  vNodes.assign(nNodes(), 0.);
+  nodeResidual.assign(nNodes(), 0.);
+  cellConductance.assign(nPLSegs * nNLSegs, 0.);
+  precondInvPivots.assign(nNodes(), 0.);
+
+  cgSolution.assign(nNodes(), 0.);
+  cgResidual.assign(nNodes(), 0.);
+  cgPrecond.assign(nNodes(), 0.);
+  cgDirection.assign(nNodes(), 0.);
+  cgProduct.assign(nNodes(), 0.);
+
+  SCCurrent = 0.;
+  SPCurrent = 0.;
+  UCCurrent = 0.;
+}
+
+void
+ArraySolver::setCells(const Cell* _selectedCell, const Cell* _unselectedCell)
+{
+  selectedCell = _selectedCell;
+  unselectedCell = _unselectedCell;
+}
+
+void
+ArraySolver::setNThreads(size_t _nThreads)
+{
+  nThreads = _nThreads;
+}
+
+size_t
+ArraySolver::getNThreads() const
+{
+  return nThreads;
+}
+
+void
+ArraySolver::setBiasScheme(biasSchemes scheme)
+{
+  if ( scheme == invalid_bias ) {
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("Unexpected behaviour - ");
+    exceptionMsgThrown.append("tried to set an invalid bias scheme");
+    exceptionMsgThrown.append(" in the array solver.\n");
+    throw exceptionMsgThrown;
+  }
+  biasScheme = scheme;
+}
+
+biasSchemes
+ArraySolver::getBiasScheme() const
+{
+  return biasScheme;
+}
+
+void
+ArraySolver::setLimits(const SolverLimits& _limits)
+{
+  limits = _limits;
+}
+
+const SolverLimits&
+ArraySolver::getLimits() const
+{
+  return limits;
+}
+
+double
+ArraySolver::buildNewtonSystem(double vP, double vBias, double vN)
+{
+  const double gPL = 1. / max(PLResistancePerCell, MIN_SOLVER_RESISTANCE);
+  const double gNL = 1. / max(NLResistancePerCell, MIN_SOLVER_RESISTANCE);
+  const double vUnselPLines = vBias * unselectedLineBias(biasScheme, true);
+  const double vUnselNLines = vBias * unselectedLineBias(biasScheme, false);
+
+  // P-lines - cells are evaluated here, their current leaves the P node
+  //  and enters the N node
+  parallelFor(nNLSegs, [&](size_t firstPLine, size_t lastPLine) {
+    for (size_t PLine = firstPLine; PLine < lastPLine; ++PLine) {
+      double vDriver = (PLine == 0) ? vP : vUnselPLines;
+      const double* vPLine = &vNodes[PNode(PLine, 0)];
+      const double* vNLine = &vNodes[NNode(PLine, 0)];
+      double* resPLine = &nodeResidual[PNode(PLine, 0)];
+      double* resNLine = &nodeResidual[NNode(PLine, 0)];
+      double* gCell = &cellConductance[PNode(PLine, 0)];
+
+      // Whole line of cells at once, as unselected ones - the selected
+      //  cell is then evaluated on its own
+      for (size_t NLine = 0; NLine < nPLSegs; ++NLine) {
+        resPLine[NLine] = vPLine[NLine] - vNLine[NLine];
+      }
+      unselectedCell->getRawCellCurrents(resPLine, resPLine, gCell, nPLSegs);
+      if ( PLine == 0 ) {
+        size_t NLine = nPLSegs-1;
+        resPLine[NLine] = selectedCell->getRawCellCurrent(
+              vPLine[NLine] - vNLine[NLine], gCell[NLine]);
+      }
+      for (size_t NLine = 0; NLine < nPLSegs; ++NLine) {
+        gCell[NLine] = max(gCell[NLine], MIN_CELL_CONDUCTANCE);
+        resNLine[NLine] = -resPLine[NLine];
+      }
+
+      resPLine[0] += PDriverConductance(PLine) * (vPLine[0] - vDriver);
+      for (size_t NLine = 1; NLine < nPLSegs; ++NLine) {
+        double iSeg = gPL * (vPLine[NLine] - vPLine[NLine-1]);
+        resPLine[NLine] += iSeg;
+        resPLine[NLine-1] -= iSeg;
+      }
+    }
+  });
+
+  // N-lines - swept across, one P-line crossing at a time
+  parallelFor(nPLSegs, [&](size_t firstNLine, size_t lastNLine) {
+    for (size_t PLine = 1; PLine < nNLSegs; ++PLine) {
+      const double* vNLine = &vNodes[NNode(PLine, 0)];
+      const double* vNLinePrev = &vNodes[NNode(PLine-1, 0)];
+      double* resNLine = &nodeResidual[NNode(PLine, 0)];
+      double* resNLinePrev = &nodeResidual[NNode(PLine-1, 0)];
+      for (size_t NLine = firstNLine; NLine < lastNLine; ++NLine) {
+        double iSeg = gNL * (vNLine[NLine] - vNLinePrev[NLine]);
+        resNLine[NLine] += iSeg;
+        resNLinePrev[NLine] -= iSeg;
+      }
+    }
+
+    const double* vNLine = &vNodes[NNode(nNLSegs-1, 0)];
+    double* resNLine = &nodeResidual[NNode(nNLSegs-1, 0)];
+    for (size_t NLine = firstNLine; NLine < lastNLine; ++NLine) {
+      double vDriver = (NLine == nPLSegs-1) ? vN : vUnselNLines;
+      resNLine[NLine] += NDriverConductance(NLine)
+                         * (vNLine[NLine] - vDriver);
+    }
+  });
+
+  return sqrt(parallelSum(nNodes(), nodeResidual, nodeResidual));
+}
+
+void
+ArraySolver::factorPreconditioner()
+{
+  const double gPL = 1. / max(PLResistancePerCell, MIN_SOLVER_RESISTANCE);
+  const double gNL = 1. / max(NLResistancePerCell, MIN_SOLVER_RESISTANCE);
+
+  // Tridiagonal blocks of the Jacobian along each line
+  //  i.e., the Jacobian without the P to N coupling through the cells
+  parallelFor(nNLSegs, [&](size_t firstPLine, size_t lastPLine) {
+    for (size_t PLine = firstPLine; PLine < lastPLine; ++PLine) {
+      double* invPivot = &precondInvPivots[PNode(PLine, 0)];
+      const double* gCell = &cellConductance[PNode(PLine, 0)];
+      for (size_t NLine = 0; NLine < nPLSegs; ++NLine) {
+        double diag = gCell[NLine];
+        diag += (NLine == 0) ? PDriverConductance(PLine) : gPL;
+        diag += (NLine < nPLSegs-1) ? gPL : 0.;
+        if ( NLine > 0 ) {
+          diag -= gPL * gPL * invPivot[NLine-1];
+        }
+        invPivot[NLine] = 1. / diag;
+      }
+    }
+  });
+
+  parallelFor(nPLSegs, [&](size_t firstNLine, size_t lastNLine) {
+    for (size_t PLine = 0; PLine < nNLSegs; ++PLine) {
+      size_t first = NNode(PLine, 0);
+      double* invPivot = &precondInvPivots[first];
+      const double* invPivotPrev = &precondInvPivots[first - nPLSegs];
+      const double* gCell = &cellConductance[PNode(PLine, 0)];
+      for (size_t NLine = firstNLine; NLine < lastNLine; ++NLine) {
+        double diag = gCell[NLine];
+        diag += (PLine > 0) ? gNL : 0.;
+        diag += (PLine < nNLSegs-1) ? gNL : NDriverConductance(NLine);
+        if ( PLine > 0 ) {
+          diag -= gNL * gNL * invPivotPrev[NLine];
+        }
+        invPivot[NLine] = 1. / diag;
+      }
+    }
+  });
+}
+
+void
+ArraySolver::applyPreconditioner(const vector<double>& r,
+                                 vector<double>& z) const
+{
+  const double gPL = 1. / max(PLResistancePerCell, MIN_SOLVER_RESISTANCE);
+  const double gNL = 1. / max(NLResistancePerCell, MIN_SOLVER_RESISTANCE);
+
+  // Thomas algorithm along each line
+  parallelFor(nNLSegs, [&](size_t firstPLine, size_t lastPLine) {
+    for (size_t PLine = firstPLine; PLine < lastPLine; ++PLine) {
+      size_t first = PNode(PLine, 0);
+      const double* invPivot = &precondInvPivots[first];
+      const double* rLine = &r[first];
+      double* zLine = &z[first];
+
+      zLine[0] = rLine[0] * invPivot[0];
+      for (size_t NLine = 1; NLine < nPLSegs; ++NLine) {
+        zLine[NLine] = (rLine[NLine] + gPL * zLine[NLine-1])
+                       * invPivot[NLine];
+      }
+      for (size_t NLine = nPLSegs-1; NLine-- > 0;) {
+        zLine[NLine] += gPL * invPivot[NLine] * zLine[NLine+1];
+      }
+    }
+  });
+
+  // N-lines are solved side by side, so the sweeps vectorize
+  parallelFor(nPLSegs, [&](size_t firstNLine, size_t lastNLine) {
+    for (size_t PLine = 0; PLine < nNLSegs; ++PLine) {
+      size_t first = NNode(PLine, 0);
+      const double* invPivot = &precondInvPivots[first];
+      const double* rLine = &r[first];
+      const double* zLinePrev = &z[first - nPLSegs];
+      double* zLine = &z[first];
+      for (size_t NLine = firstNLine; NLine < lastNLine; ++NLine) {
+        double zPrev = (PLine > 0) ? zLinePrev[NLine] : 0.;
+        zLine[NLine] = (rLine[NLine] + gNL * zPrev) * invPivot[NLine];
+      }
+    }
+    for (size_t PLine = nNLSegs-1; PLine-- > 0;) {
+      size_t first = NNode(PLine, 0);
+      const double* invPivot = &precondInvPivots[first];
+      const double* zLineNext = &z[first + nPLSegs];
+      double* zLine = &z[first];
+      for (size_t NLine = firstNLine; NLine < lastNLine; ++NLine) {
+        zLine[NLine] += gNL * invPivot[NLine] * zLineNext[NLine];
+      }
+    }
+  });
+}
+
+void
+ArraySolver::applyJacobian(const vector<double>& x, vector<double>& y) const
+{
+  const double gPL = 1. / max(PLResistancePerCell, MIN_SOLVER_RESISTANCE);
+  const double gNL = 1. / max(NLResistancePerCell, MIN_SOLVER_RESISTANCE);
+
+  // P-lines, plus the cell coupling of both nodes of each cell
+  parallelFor(nNLSegs, [&](size_t firstPLine, size_t lastPLine) {
+    for (size_t PLine = firstPLine; PLine < lastPLine; ++PLine) {
+      const double* xPLine = &x[PNode(PLine, 0)];
+      const double* xNLine = &x[NNode(PLine, 0)];
+      double* yPLine = &y[PNode(PLine, 0)];
+      double* yNLine = &y[NNode(PLine, 0)];
+      const double* gCell = &cellConductance[PNode(PLine, 0)];
+
+      for (size_t NLine = 0; NLine < nPLSegs; ++NLine) {
+        double iCell = gCell[NLine] * (xPLine[NLine] - xNLine[NLine]);
+        yPLine[NLine] = iCell;
+        yNLine[NLine] = -iCell;
+      }
+
+      yPLine[0] += PDriverConductance(PLine) * xPLine[0];
+      for (size_t NLine = 1; NLine < nPLSegs; ++NLine) {
+        double iSeg = gPL * (xPLine[NLine] - xPLine[NLine-1]);
+        yPLine[NLine] += iSeg;
+        yPLine[NLine-1] -= iSeg;
+      }
+    }
+  });
+
+  parallelFor(nPLSegs, [&](size_t firstNLine, size_t lastNLine) {
+    for (size_t PLine = 1; PLine < nNLSegs; ++PLine) {
+      const double* xNLine = &x[NNode(PLine, 0)];
+      const double* xNLinePrev = &x[NNode(PLine-1, 0)];
+      double* yNLine = &y[NNode(PLine, 0)];
+      double* yNLinePrev = &y[NNode(PLine-1, 0)];
+      for (size_t NLine = firstNLine; NLine < lastNLine; ++NLine) {
+        double iSeg = gNL * (xNLine[NLine] - xNLinePrev[NLine]);
+        yNLine[NLine] += iSeg;
+        yNLinePrev[NLine] -= iSeg;
+      }
+    }
+
+    const double* xNLine = &x[NNode(nNLSegs-1, 0)];
+    double* yNLine = &y[NNode(nNLSegs-1, 0)];
+    for (size_t NLine = firstNLine; NLine < lastNLine; ++NLine) {
+      yNLine[NLine] += NDriverConductance(NLine) * xNLine[NLine];
+    }
+  });
+}
+
+void
+ArraySolver::solveJacobian(const vector<double>& rhs, double relTolerance)
+{
+  size_t n = nNodes();
+  fill(cgSolution.begin(), cgSolution.end(), 0.);
+  cgResidual = rhs;
+  applyPreconditioner(cgResidual, cgPrecond);
+  cgDirection = cgPrecond;
+
+  double rhsNorm = sqrt(parallelSum(n, rhs, rhs));
+  double rz = parallelSum(n, cgResidual, cgPrecond);
+  if ( rhsNorm == 0. ) {
+    return;
+  }
+
+  SolverGuard guard(limits, "Array solver conjugate gradients");
+
+  while ( true ) {
+    guard.startIteration();
+    applyJacobian(cgDirection, cgProduct);
+    double alpha = rz / parallelSum(n, cgDirection, cgProduct);
+
+    parallelFor(n, [&](size_t first, size_t last) {
+      for (size_t k = first; k < last; ++k) {
+        cgSolution[k] += alpha * cgDirection[k];
+        cgResidual[k] -= alpha * cgProduct[k];
+      }
+    });
+
+    double relResidual = sqrt(parallelSum(n, cgResidual, cgResidual))
+                         / rhsNorm;
+    guard.checkFinite(relResidual);
+    if ( relResidual <= relTolerance ) {
+      return;
+    }
+
+    applyPreconditioner(cgResidual, cgPrecond);
+    double lastRz = rz;
+    rz = parallelSum(n, cgResidual, cgPrecond);
+    double beta = rz / lastRz;
+
+    parallelFor(n, [&](size_t first, size_t last) {
+      for (size_t k = first; k < last; ++k) {
+        cgDirection[k] = cgPrecond[k] + beta * cgDirection[k];
+      }
+    });
+  }
+}
+
+void
+ArraySolver::solveNodesNewton(double vP, double vBias, double vN)
+{
+  // Steps bounded and converged relative to the applied voltages, as in
+  //  LineSolver::solveNodesNewton
+  const double vRef = max(max(abs(vP), abs(vN)), max(abs(vBias), 1.));
+  const double maxStep = 0.1 * vRef;
+  const double vTolerance = 1e-9 * vRef;
+
+  size_t n = nNodes();
+
+  // Moves all nodes by factor * Newton step
+  auto stepNodes = [&](double factor) {
+    parallelFor(n, [&](size_t first, size_t last) {
+      for (size_t k = first; k < last; ++k) {
+        vNodes[k] += factor * cgSolution[k];
+      }
+    });
+  };
+
+  double residual = buildNewtonSystem(vP, vBias, vN);
+
+  SolverGuard guard(limits, "Array solver");
+
+  while ( true ) {
+    guard.startIteration();
+    COUNT_SOLVER_ITERATION();
+    for (auto& nodeRes : nodeResidual) { nodeRes = -nodeRes; }
+    factorPreconditioner();
+    solveJacobian(nodeResidual, NEWTON_CG_TOLERANCE);
+
+    double maxDelta = 0.;
+    for (auto& delta : cgSolution) {
+      maxDelta = maxMagnitude(maxDelta, delta);
+    }
+    guard.checkFinite(maxDelta / vRef);
+
+    double stepFactor = min(1., maxStep / maxDelta);
+    stepNodes(stepFactor);
+    double newResidual = buildNewtonSystem(vP, vBias, vN);
+
+    // Converged - the residual is down to rounding noise
+    if ( maxDelta <= vTolerance ) {
+      return;
+    }
+
+    // Steps are damped on the norm of all node residuals, so a kink
+    //  crossed by a single cell of a large array still shows
+    for (size_t halving = 0;
+         newResidual > residual && halving < 30; ++halving) {
+      stepFactor /= 2.;
+      stepNodes(-stepFactor);
+      newResidual = buildNewtonSystem(vP, vBias, vN);
+    }
+    residual = newResidual;
+  }
+}
+
+void
+ArraySolver::initializeNodes(double vP, double vBias, double vN)
+{
+  // Lines at their driver voltages, as if no current flowed
+  //  Floating lines start halfway between the selected ones
+  double vUnselPLines = vBias * unselectedLineBias(biasScheme, true);
+  double vUnselNLines = vBias * unselectedLineBias(biasScheme, false);
+  if ( biasScheme == floating_bias ) {
+    vUnselPLines = (vP + vN) / 2.;
+    vUnselNLines = vUnselPLines;
+  }
+  for (size_t PLine = 0; PLine < nNLSegs; ++PLine) {
+    fill(vNodes.begin() + PNode(PLine, 0),
+         vNodes.begin() + PNode(PLine, 0) + nPLSegs,
+         (PLine == 0) ? vP : vUnselPLines);
+  }
+  fill(vNodes.begin() + NNode(0, 0), vNodes.end(), vUnselNLines);
+  for (size_t PLine = 0; PLine < nNLSegs; ++PLine) {
+    vNodes[NNode(PLine, nPLSegs-1)] = vN;
+  }
+}
+
+void
+ArraySolver::storeCurrents()
+{
+  // Cell currents are recomputed from the nodes
+  auto cellCurrent = [&](size_t PLine, size_t NLine) {
+    const Cell* cellModel = (PLine == 0 && NLine == nPLSegs-1) ?
+                              selectedCell : unselectedCell;
+    return cellModel->getRawCellCurrent(vNodes[PNode(PLine, NLine)]
+                                        - vNodes[NNode(PLine, NLine)]);
+  };
+
+  SCCurrent = cellCurrent(0, nPLSegs-1);
+
+  SPCurrent = 0.;
+  for (size_t NLine = 0; NLine < nPLSegs-1; ++NLine) {
+    SPCurrent += cellCurrent(0, NLine);
+  }
+  for (size_t PLine = 1; PLine < nNLSegs; ++PLine) {
+    SPCurrent += cellCurrent(PLine, nPLSegs-1);
+  }
+
+  // Unselected cells may carry current either way - each one draws it
+  //  from the unselected lines drivers
+  UCCurrent = 0.;
+  for (size_t PLine = 1; PLine < nNLSegs; ++PLine) {
+    for (size_t NLine = 0; NLine < nPLSegs-1; ++NLine) {
+      UCCurrent += abs(cellCurrent(PLine, NLine));
+    }
+  }
+}
+
+double
+ArraySolver::calcVSelectedCell(double vP, double vBias, double vN)
+{
+  checkSetup();
+  initializeNodes(vP, vBias, vN);
+  solveNodesNewton(vP, vBias, vN);
+  storeCurrents();
+
+  return vNodes[PNode(0, nPLSegs-1)] - vNodes[NNode(0, nPLSegs-1)];
+}
+
+double
+ArraySolver::calcVEdge(double vSC, double vBias, bool trackBias)
+{
+  checkSetup();
+
+  // Start from the lines carrying only the selected cell current
+  double iSC = selectedCell->getRawCellCurrent(vSC);
+  double vP = vSC + iSC * (PAMUXResistance + nPLSegs * PLResistancePerCell
+                           + NAMUXResistance + nNLSegs * NLResistancePerCell);
+  if ( trackBias ) {
+    vBias = vP;
+  }
+  initializeNodes(vP, vBias, 0.);
+
+  SolverGuard guard(limits, "Array solver");
+
+  // Newton on the driver voltage, each step solving all array nodes
+  //  The sensitivity of the nodes to vP reuses the array Jacobian
+  while ( true ) {
+    guard.startIteration();
+    if ( trackBias ) {
+      vBias = vP;
+    }
+    solveNodesNewton(vP, vBias, 0.);
+    double vSCGot = vNodes[PNode(0, nPLSegs-1)]
+                    - vNodes[NNode(0, nPLSegs-1)];
+
+    // d(node currents)/d(vP), moved to the right hand side
+    //  nodeResidual is free until the next Newton system is built
+    fill(nodeResidual.begin(), nodeResidual.end(), 0.);
+    nodeResidual[PNode(0, 0)] = PDriverConductance(0);
+    if ( trackBias ) {
+      double fPL = unselectedLineBias(biasScheme, true);
+      double fNL = unselectedLineBias(biasScheme, false);
+      for (size_t PLine = 1; PLine < nNLSegs; ++PLine) {
+        nodeResidual[PNode(PLine, 0)] += PDriverConductance(PLine) * fPL;
+      }
+      for (size_t NLine = 0; NLine < nPLSegs-1; ++NLine) {
+        nodeResidual[NNode(nNLSegs-1, NLine)] +=
+            NDriverConductance(NLine) * fNL;
+      }
+    }
+    factorPreconditioner();
+    solveJacobian(nodeResidual, SENSITIVITY_CG_TOLERANCE);
+    double dVSCdVP = cgSolution[PNode(0, nPLSegs-1)]
+                     - cgSolution[NNode(0, nPLSegs-1)];
+
+    if ( !(dVSCdVP > 0.) ) {
+      string exceptionMsgThrown("[ERROR] ");
+      exceptionMsgThrown.append("Unexpected behaviour - ");
+      exceptionMsgThrown.append("selected cell voltage does not increase");
+      exceptionMsgThrown.append(" with the driver voltage.\n");
+      throw exceptionMsgThrown;
+    }
+
+    double deltaVP = (vSC - vSCGot) / dVSCdVP;
+    vP += deltaVP;
+    guard.checkFinite(deltaVP / vP);
+
+    // Nodes follow the driver to first order - a good start for the next
+    //  Newton solve, and exact enough once the driver step is negligible
+    parallelFor(nNodes(), [&](size_t first, size_t last) {
+      for (size_t k = first; k < last; ++k) {
+        vNodes[k] += deltaVP * cgSolution[k];
+      }
+    });
+
+    if ( abs(deltaVP) <= 1e-9 * abs(vP) ) {
+      storeCurrents();
+      return vP;
+    }
+  }
+}
+
+double
+ArraySolver::getSCCurrent() const
+{
+  return SCCurrent;
+}
+
+double
+ArraySolver::getSPCurrent() const
+{
+  return SPCurrent;
+}
+
+double
+ArraySolver::getUCCurrent() const
+{
+  return UCCurrent;
+}
+
+ArraySolver::ArraySolver()
+{
+  biasScheme = half_bias;
+
+  nPLSegs = 0;
+  nNLSegs = 0;
+
+  PAMUXResistance = INVALID_DOUBLE;
+  NAMUXResistance = INVALID_DOUBLE;
+  halfBiasDriverResistance = INVALID_DOUBLE;
+  PLResistancePerCell = INVALID_DOUBLE;
+  NLResistancePerCell = INVALID_DOUBLE;
+
+  selectedCell = nullptr;
+  unselectedCell = nullptr;
+
+  nThreads = 0;
+
+  SCCurrent = INVALID_DOUBLE;
+  SPCurrent = INVALID_DOUBLE;
+  UCCurrent = INVALID_DOUBLE;
+}
+
+ArraySolver::~ArraySolver()
+{
+
+}
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+
+#ifndef ARRAYSOLVER_H
+#define ARRAYSOLVER_H
+
+#include "../utils/constants.h"
+#include "../utils/functions.h"
+#include "../utils/SolverGuard.h"
+#include "../utils/WorkerPool.h"
+
+#include "../core/Cell.h"
+
+using namespace std;
+
+// Nodal solver for every wordline and bitline node of a crosspoint array
+// Lines parallel to the selected PL are P-lines, the ones parallel to the
+//  selected NL are N-lines. There are nNLSegs P-lines with nPLSegs nodes
+//  each, and nPLSegs N-lines with nNLSegs nodes each, with one cell between
+//  every P-line and N-line crossing. Unselected lines are driven through
+//  the half bias driver, from the same side as the selected ones, at the
+//  fraction of vBias set by the bias scheme - or left floating.
+// The selected cell sits at the crossing farthest from both selected line
+//  drivers, as in the lumped (LineSolver) model.
+// Newton-Raphson iterations solve for all node voltages. Each Newton step
+//  is a sparse SPD system solved by conjugate gradients, preconditioned by
+//  exact tridiagonal solves along each line. Storage is a fixed number of
+//  vectors with one entry per node, and the work is split over lines
+//  among threads, kept alive from one step to the next.
+class ArraySolver
+{
+
+private:
+  biasSchemes biasScheme;
+  SolverLimits limits;
+
+  // Array topology
+  size_t nPLSegs;
+  size_t nNLSegs;
+
+  // Resistances [ohm]
+  double PAMUXResistance;
+  double NAMUXResistance;
+  double halfBiasDriverResistance;
+  double PLResistancePerCell;
+  double NLResistancePerCell;
+
+  // Cells seen by the solver - not owned
+  const Cell* selectedCell;
+  const Cell* unselectedCell;
+
+  // Threads splitting each step - 0 for the thread budget of the caller
+  size_t nThreads;
+  mutable WorkerPool workerPool;
+
+  // Node voltages [V] - all P-lines nodes, line after line, followed by
+  //  all N-lines nodes in the same crossing order, so the two nodes of a
+  //  cell are at the same offset of each half and N-lines are swept across
+  vector<double> vNodes;
+  // Currents leaving each node [A]
+  vector<double> nodeResidual;
+  // I-V slope [A/V] of each cell, indexed as P-line nodes
+  vector<double> cellConductance;
+  // Inverse pivots of the tridiagonal line preconditioner
+  vector<double> precondInvPivots;
+
+  // Conjugate gradients state
+  vector<double> cgSolution;
+  vector<double> cgResidual;
+  vector<double> cgPrecond;
+  vector<double> cgDirection;
+  vector<double> cgProduct;
+
+  // Results of the last solve [A]
+  double SCCurrent;
+  double SPCurrent;
+  double UCCurrent;
+
+  void checkSetup() const;
+
+  size_t nNodes() const;
+  size_t PNode(size_t PLine, size_t NLine) const;
+  size_t NNode(size_t PLine, size_t NLine) const;
+
+  // Line driver conductances, including the first line segment [A/V]
+  //  Floating lines have none
+  double PDriverConductance(size_t PLine) const;
+  double NDriverConductance(size_t NLine) const;
+
+  // Runs body(first, last) over [0, n) split in a fixed number of blocks,
+  //  so results do not depend on the number of threads
+  template <typename Body>
+  void parallelFor(size_t n, Body body) const;
+  double parallelSum(size_t n,
+                     const vector<double>& a, const vector<double>& b) const;
+
+  // Fills cell slopes and node residuals
+  //  Returns the residual 2-norm [A]
+  double buildNewtonSystem(double vP, double vBias, double vN);
+  void factorPreconditioner();
+  void applyPreconditioner(const vector<double>& r, vector<double>& z) const;
+  void applyJacobian(const vector<double>& x, vector<double>& y) const;
+  // Solves Jacobian * cgSolution = rhs, down to a relative residual
+  void solveJacobian(const vector<double>& rhs, double relTolerance);
+
+  // Newton iterations on the node voltages, starting from the current ones
+  void solveNodesNewton(double vP, double vBias, double vN);
+  void initializeNodes(double vP, double vBias, double vN);
+  void storeCurrents();
+
+public:
+  ArraySolver();
+  ~ArraySolver();
+
+  // Sets lines lengths and resistances, (re)allocating and zeroing state
+  void setArray(size_t _nPLSegs, size_t _nNLSegs,
+                double _PLResistancePerCell, double _NLResistancePerCell,
+                double _PAMUXResistance, double _NAMUXResistance,
+                double _halfBiasDriverResistance);
+  void setCells(const Cell* _selectedCell, const Cell* _unselectedCell);
+
+  // Set/Get the threads splitting each step (0, the default, for the
+  //  thread budget of the calling thread). Results do not depend on it
+  void setNThreads(size_t);
+  size_t getNThreads() const;
+
+  void setBiasScheme(biasSchemes);
+  biasSchemes getBiasScheme() const;
+
+  // Every solve failing on these limits throws the [ERROR] message string
+  void setLimits(const SolverLimits&);
+  const SolverLimits& getLimits() const;
+
+  // Driver voltage [V] needed to get vSC [V] at the selected cell
+  //  If trackBias, vBias follows the driver voltage,
+  //  otherwise it is kept fixed at the given value
+  double calcVEdge(double vSC, double vBias, bool trackBias);
+
+  // Selected cell voltage [V] given the driver voltages [V]
+  double calcVSelectedCell(double vP, double vBias, double vN);
+
+  // Results of the last solve [A]
+  //  Sneak path current sums the half selected cells on the selected lines,
+  //  unselected cell current the magnitudes of all the other cells
+  double getSCCurrent() const;
+  double getSPCurrent() const;
+  double getUCCurrent() const;
+
+};
+#endif // ARRAYSOLVER_H
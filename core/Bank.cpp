@@ -45,8 +45,10 @@ void
 Bank::initialize()
 {
   optMode = INVALID_OPT_MODE;
+  nOptimizationThreads = 0.;
+  nArraySizesPerPowerOfTwo = 1.;
 
-  capacity = INVALID_DOUBLE * rrs::gibibits;
+  capacity = INVALID_DOUBLE * rrs::bits;
   nDataBusBits = INVALID_DOUBLE;
   prefetch = INVALID_DOUBLE;
 
@@ -61,36 +63,37 @@ Bank::initialize()
   nColAddressLines = INVALID_DOUBLE;
 
 
-  rowDecoderWidth = INVALID_DOUBLE * rrs::nanometers;
-  rowDecoderHeight = INVALID_DOUBLE * rrs::nanometers;
-  rowDecoderArea = INVALID_DOUBLE * rrs::square_nanometers;
-  colDecoderWidth = INVALID_DOUBLE * rrs::nanometers;
-  colDecoderHeight = INVALID_DOUBLE * rrs::nanometers;
-  colDecoderArea = INVALID_DOUBLE * rrs::square_nanometers;
+  rowDecoderWidth = INVALID_DOUBLE * rrs::meters;
+  rowDecoderHeight = INVALID_DOUBLE * rrs::meters;
+  rowDecoderArea = INVALID_DOUBLE * rrs::square_meters;
+  colDecoderWidth = INVALID_DOUBLE * rrs::meters;
+  colDecoderHeight = INVALID_DOUBLE * rrs::meters;
+  colDecoderArea = INVALID_DOUBLE * rrs::square_meters;
 
-  area = INVALID_DOUBLE * rrs::square_nanometers;
-  height = INVALID_DOUBLE * rrs::nanometers;
-  width = INVALID_DOUBLE * rrs::nanometers;
+  area = INVALID_DOUBLE * rrs::square_meters;
+  height = INVALID_DOUBLE * rrs::meters;
+  width = INVALID_DOUBLE * rrs::meters;
   areaEfficiency = INVALID_DOUBLE;
 
-  rowDecoderDelay = INVALID_DOUBLE * rrs::nanoseconds;
-  colDecoderDelay = INVALID_DOUBLE * rrs::nanoseconds;
+  rowDecoderDelay = INVALID_DOUBLE * rrs::seconds;
+  colDecoderDelay = INVALID_DOUBLE * rrs::seconds;
 
-  globalBusDelay = INVALID_DOUBLE * rrs::nanoseconds;
+  globalBusDelay = INVALID_DOUBLE * rrs::seconds;
 
-  prechargeTime = INVALID_DOUBLE * rrs::nanoseconds;
-  writeTime = INVALID_DOUBLE * rrs::nanoseconds;
-  readTime = INVALID_DOUBLE * rrs::nanoseconds;
+  prechargeTime = INVALID_DOUBLE * rrs::seconds;
+  writeTime = INVALID_DOUBLE * rrs::seconds;
+  readTime = INVALID_DOUBLE * rrs::seconds;
 
-  leakagePower = INVALID_DOUBLE * rrs::nanowatts;
+  leakagePower = INVALID_DOUBLE * rrs::watts;
 
-  interfaceBusEnergy = INVALID_DOUBLE * rrs::picojoules;
-  prechargeEnergy = INVALID_DOUBLE * rrs::picojoules;
-  writeEnergy = INVALID_DOUBLE * rrs::picojoules;
-  readEnergy = INVALID_DOUBLE * rrs::picojoules;
+  interfaceBusEnergy = INVALID_DOUBLE * rrs::joules;
+  prechargeEnergy = INVALID_DOUBLE * rrs::joules;
+  writeEnergy = INVALID_DOUBLE * rrs::joules;
+  readEnergy = INVALID_DOUBLE * rrs::joules;
 
-  bestWriteEnergy = INVALID_DOUBLE * rrs::picojoules;
-  bestWriteTime = INVALID_DOUBLE * rrs::nanoseconds;
+  bestWriteEnergy = INVALID_DOUBLE * rrs::joules;
+  bestWriteTime = INVALID_DOUBLE * rrs::seconds;
+  paretoFront.clear();
 }
 
 
@@ -110,6 +113,9 @@ Bank::setOptMode( string opt )
   else if ( opt == "energy" ) {
     optMode = energy;
   }
+  else if ( opt == "pareto" ) {
+    optMode = pareto;
+  }
   else {
     string exceptionMsgThrown("[ERROR] ");
     exceptionMsgThrown.append("Tried to set an optimization mode for");
@@ -120,12 +126,13 @@ Bank::setOptMode( string opt )
     exceptionMsgThrown.append("  \"density\"\n");
     exceptionMsgThrown.append("  \"performance\"\n");
     exceptionMsgThrown.append("  \"energy\"\n");
+    exceptionMsgThrown.append("  \"pareto\"\n");
     throw exceptionMsgThrown;
   }
 }
 
 string
-Bank::getOptMode()
+Bank::getOptMode() const
 {
   string optModeStr;
   switch (optMode) {
@@ -133,6 +140,7 @@ Bank::getOptMode()
     case density:           optModeStr = "density";       break;
     case performance:       optModeStr = "performance";   break;
     case energy:            optModeStr = "energy";        break;
+    case pareto:            optModeStr = "pareto";        break;
     case INVALID_OPT_MODE:  optModeStr = INVALID_STRING;  break;
 
     default:            optModeStr = "UNLISTED";      break;
@@ -150,7 +158,55 @@ Bank::getOptMode()
 }
 
 void
-Bank::setCapacity(bu::quantity<rrs::gibibit_unit> size)
+Bank::setNOptimizationThreads(bu::quantity<rrs::dimensionless> nThreads)
+{
+  if ( isInvalid(nThreads) ) {
+    nOptimizationThreads = 0.; // Default - all hardware threads
+    return;
+  }
+  if ( nThreads < 0. || nThreads.value() != floor(nThreads.value()) ) {
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("Number of optimization threads must be");
+    exceptionMsgThrown.append(" a non-negative integer. Tried to set it to ");
+    exceptionMsgThrown.append(to_string(nThreads.value()));
+    exceptionMsgThrown.append(".");
+    throw exceptionMsgThrown;
+  }
+  nOptimizationThreads = nThreads;
+}
+
+bu::quantity<rrs::dimensionless> const &
+Bank::getNOptimizationThreads() const
+{
+  return this->nOptimizationThreads;
+}
+
+void
+Bank::setNArraySizesPerPowerOfTwo(bu::quantity<rrs::dimensionless> nSizes)
+{
+  if ( isInvalid(nSizes) ) {
+    nArraySizesPerPowerOfTwo = 1.; // Default - only powers of two
+    return;
+  }
+  if ( nSizes < 1. || !isInteger(nSizes.value()) ) {
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("Number of array sizes per power of two must");
+    exceptionMsgThrown.append(" be a positive integer. Tried to set it to ");
+    exceptionMsgThrown.append(to_string(nSizes.value()));
+    exceptionMsgThrown.append(".");
+    throw exceptionMsgThrown;
+  }
+  nArraySizesPerPowerOfTwo = nSizes;
+}
+
+bu::quantity<rrs::dimensionless> const &
+Bank::getNArraySizesPerPowerOfTwo() const
+{
+  return this->nArraySizesPerPowerOfTwo;
+}
+
+void
+Bank::setCapacity(bu::quantity<rrs::bit_unit> size)
 {
   if ( !isPowerOfTwo(size.value()) ) {
     string exceptionMsgThrown("[ERROR] ");
@@ -164,7 +220,7 @@ Bank::setCapacity(bu::quantity<rrs::gibibit_unit> size)
   capacity = size;
 }
 
-bu::quantity<rrs::gibibit_unit> const &
+bu::quantity<rrs::bit_unit> const &
 Bank::getCapacity() const
 {
   return this->capacity;
@@ -209,7 +265,7 @@ void
 Bank::updateNSubarrays()
 {
   nActiveSubarraysPerAccess = nDataBusBits * prefetch;
-  nSubarrays = SCALE_QUANTITY(capacity, rrs::bit_unit) / subarray.getCapacity();
+  nSubarrays = capacity / subarray.getCapacity();
 
   nSubarraysPerRow = nSubarrays;
   nSubarraysPerCol = 1.;
@@ -292,7 +348,7 @@ Bank::getPageSize() const
 void
 Bank::updateNRowAddressLines()
 {
-//  nRowAddressLines = log2( SCALE_QUANTITY(capacity, rrs::bit_unit) / pageSize );
+//  nRowAddressLines = log2( capacity / pageSize );
   nRowAddressLines = log2(subarray.getNRows() * nSubarraysPerCol);
 }
 
@@ -320,7 +376,7 @@ Bank::getNColAddressLines() const
 void
 Bank::updateRowDecoderArea()
 {
-  rowDecoderArea = 0. * rrs::square_nanometers;
+  rowDecoderArea = 0. * rrs::square_meters;
   auto nVccDecodedAddress = pow( 2., nRowAddressLines - nVppDecodedLvls );
   auto F2Vcc = tech.getTechnologyNode() * tech.getTechnologyNode();
   rowDecoderArea += nF2PerDecodedAddress * F2Vcc * nVccDecodedAddress;
@@ -339,19 +395,19 @@ Bank::updateRowDecoderArea()
 
 }
 
-bu::quantity<rrs::square_nanometer_unit> const &
+bu::quantity<rrs::square_meter_unit> const &
 Bank::getRowDecoderArea() const
 {
   return this->rowDecoderArea;
 }
 
-bu::quantity<rrs::nanometer_unit> const &
+bu::quantity<rrs::meter_unit> const &
 Bank::getRowDecoderWidth() const
 {
   return this->rowDecoderWidth;
 }
 
-bu::quantity<rrs::nanometer_unit> const &
+bu::quantity<rrs::meter_unit> const &
 Bank::getRowDecoderHeight() const
 {
   return this->rowDecoderHeight;
@@ -361,7 +417,7 @@ Bank::getRowDecoderHeight() const
 void
 Bank::updateColDecoderArea()
 {
-  colDecoderArea = 0. * rrs::square_nanometers;
+  colDecoderArea = 0. * rrs::square_meters;
   auto nVccDecodedAddress = pow( 2., nColAddressLines - nVppDecodedLvls );
   auto F2Vcc = tech.getTechnologyNode() * tech.getTechnologyNode();
   colDecoderArea += nF2PerDecodedAddress * F2Vcc * nVccDecodedAddress;
@@ -380,19 +436,19 @@ Bank::updateColDecoderArea()
 
 }
 
-bu::quantity<rrs::square_nanometer_unit> const &
+bu::quantity<rrs::square_meter_unit> const &
 Bank::getColDecoderArea() const
 {
   return this->colDecoderArea;
 }
 
-bu::quantity<rrs::nanometer_unit> const &
+bu::quantity<rrs::meter_unit> const &
 Bank::getColDecoderWidth() const
 {
   return this->colDecoderWidth;
 }
 
-bu::quantity<rrs::nanometer_unit> const &
+bu::quantity<rrs::meter_unit> const &
 Bank::getColDecoderHeight() const
 {
   return this->colDecoderHeight;
@@ -411,19 +467,19 @@ Bank::updateArea()
   areaEfficiency = subarray.getArea4F2() * nSubarrays / area;
 }
 
-bu::quantity<rrs::square_nanometer_unit> const &
+bu::quantity<rrs::square_meter_unit> const &
 Bank::getArea() const
 {
   return this->area;
 }
 
-bu::quantity<rrs::nanometer_unit> const &
+bu::quantity<rrs::meter_unit> const &
 Bank::getHeight() const
 {
   return this->height;
 }
 
-bu::quantity<rrs::nanometer_unit> const &
+bu::quantity<rrs::meter_unit> const &
 Bank::getWidth() const
 {
   return this->width;
@@ -447,10 +503,10 @@ Bank::updateRowDecoderDelay()
   auto totalLineCap = tech.getMetalCapacitancePerLength()
       * width * globalWireCapacitanceMultiplier;
   rowDecoderDelay += tausToPercentLumpedRC(90) * totalLineRes
-      * SCALE_QUANTITY(totalLineCap, rrs::nanofarad_unit);
+      * totalLineCap;
 }
 
-bu::quantity<rrs::nanosecond_unit> const &
+bu::quantity<rrs::second_unit> const &
 Bank::getRowDecoderDelay() const
 {
   return this->rowDecoderDelay;
@@ -466,10 +522,10 @@ Bank::updateColDecoderDelay()
   auto totalLineCap = tech.getMetalCapacitancePerLength()
       * height * globalWireCapacitanceMultiplier;
   colDecoderDelay += tausToPercentLumpedRC(90) * totalLineRes
-      * SCALE_QUANTITY(totalLineCap, rrs::nanofarad_unit);
+      * totalLineCap;
 }
 
-bu::quantity<rrs::nanosecond_unit> const &
+bu::quantity<rrs::second_unit> const &
 Bank::getColDecoderDelay() const
 {
   return this->colDecoderDelay;
@@ -484,10 +540,10 @@ Bank::updateGlobalBusDelay()
       * max(width, height) * globalWireCapacitanceMultiplier;
 
   globalBusDelay = tausToPercentLumpedRC(63) * totalLineRes
-      * SCALE_QUANTITY(totalLineCap, rrs::nanofarad_unit);
+      * totalLineCap;
 }
 
-bu::quantity<rrs::nanosecond_unit> const &
+bu::quantity<rrs::second_unit> const &
 Bank::getGlobalBusDelay() const
 {
   return this->globalBusDelay;
@@ -502,7 +558,7 @@ Bank::updatePrechargeTime()
   prechargeTime += subarray.getPrechargeTime();
 }
 
-bu::quantity<rrs::nanosecond_unit> const &
+bu::quantity<rrs::second_unit> const &
 Bank::getPrechargeTime() const
 {
   return this->prechargeTime;
@@ -516,7 +572,7 @@ Bank::updateWriteTime()
   writeTime += subarray.getWriteTime();
 }
 
-bu::quantity<rrs::nanosecond_unit> const &
+bu::quantity<rrs::second_unit> const &
 Bank::getWriteTime() const
 {
   return this->writeTime;
@@ -531,7 +587,7 @@ Bank::updateReadTime()
   readTime += globalBusDelay;
 }
 
-bu::quantity<rrs::nanosecond_unit> const &
+bu::quantity<rrs::second_unit> const &
 Bank::getReadTime() const
 {
   return this->readTime;
@@ -545,7 +601,7 @@ Bank::updateTpd()
   tpd += subarray.getPrechargeTime();
 }
 
-bu::quantity<rrs::nanosecond_unit> const &
+bu::quantity<rrs::second_unit> const &
 Bank::getTpd() const
 {
   return this->tpd;
@@ -557,7 +613,7 @@ Bank::updateTccdr()
   tccdr = subarray.getReadTime();
 }
 
-bu::quantity<rrs::nanosecond_unit> const &
+bu::quantity<rrs::second_unit> const &
 Bank::getTccdr() const
 {
   return this->tccdr;
@@ -569,7 +625,7 @@ Bank::updateTccdw()
   tccdw = subarray.getWriteTime();
 }
 
-bu::quantity<rrs::nanosecond_unit> const &
+bu::quantity<rrs::second_unit> const &
 Bank::getTccdw() const
 {
   return this->tccdw;
@@ -583,7 +639,7 @@ Bank::updateTrl()
   trl += tccdr;
   trl += globalBusDelay;
 }
-bu::quantity<rrs::nanosecond_unit> const &
+bu::quantity<rrs::second_unit> const &
 Bank::getTrl() const
 {
   return this->trl;
@@ -597,7 +653,7 @@ Bank::updateTwl()
   twl += globalBusDelay;
 }
 
-bu::quantity<rrs::nanosecond_unit> const &
+bu::quantity<rrs::second_unit> const &
 Bank::getTwl() const
 {
   return this->twl;
@@ -613,7 +669,7 @@ Bank::updateLeakagePower()
   leakagePower = leakagePowerPerTranslator * nVccDecodedAddress;
 }
 
-bu::quantity<rrs::nanowatt_unit> const &
+bu::quantity<rrs::watt_unit> const &
 Bank::getLeakagePower() const
 {
   return this->leakagePower;
@@ -628,12 +684,12 @@ Bank::updateInterfaceBusEnergy()
       * (width + height)/2. * globalWireCapacitanceMultiplier;
 
   interfaceBusEnergy = tech.getVcc() * tech.getVcc()
-      * SCALE_QUANTITY(totalGlobalLineCap, rrs::picofarad_unit);
+      * totalGlobalLineCap;
   interfaceBusEnergy *= nCommandLines + nDataBusBits
                         + nRowAddressLines + nColAddressLines;
 }
 
-bu::quantity<rrs::picojoule_unit> const &
+bu::quantity<rrs::joule_unit> const &
 Bank::getInterfaceBusEnergy() const
 {
   return this->interfaceBusEnergy;
@@ -647,7 +703,7 @@ Bank::updatePrechargeEnergy()
   prechargeEnergy += interfaceBusEnergy;
 }
 
-bu::quantity<rrs::picojoule_unit> const &
+bu::quantity<rrs::joule_unit> const &
 Bank::getPrechargeEnergy() const
 {
   return this->prechargeEnergy;
@@ -660,7 +716,7 @@ Bank::updateWriteEnergy()
   writeEnergy += interfaceBusEnergy;
 }
 
-bu::quantity<rrs::picojoule_unit> const &
+bu::quantity<rrs::joule_unit> const &
 Bank::getWriteEnergy() const
 {
   return this->writeEnergy;
@@ -673,20 +729,20 @@ Bank::updateReadEnergy()
   readEnergy += interfaceBusEnergy;
 }
 
-bu::quantity<rrs::picojoule_unit> const &
+bu::quantity<rrs::joule_unit> const &
 Bank::getReadEnergy() const
 {
   return this->readEnergy;
 }
 
 
-bu::quantity<rrs::picojoule_unit> const &
+bu::quantity<rrs::joule_unit> const &
 Bank::getBestWriteEnergy() const
 {
   return this->bestWriteEnergy;
 }
 
-bu::quantity<rrs::nanosecond_unit> const &
+bu::quantity<rrs::second_unit> const &
 Bank::getBestWriteTime() const
 {
   return this->bestWriteTime;
@@ -696,9 +752,8 @@ Bank::getBestWriteTime() const
 
 
 void
-Bank::updateAll()
+Bank::updateGeometry()
 {
-try {
   updateNSubarrays();
 
   updatePageSize();
@@ -708,6 +763,14 @@ try {
   updateRowDecoderArea();
   updateColDecoderArea();
   updateArea();
+}
+
+void
+Bank::updateAll()
+{
+  TRACE_SCOPE("Bank::updateAll");
+try {
+  updateGeometry();
 
   updateRowDecoderDelay();
   updateColDecoderDelay();
@@ -805,10 +868,10 @@ try {
   subarray = XPointArray(config);
 
   // Get technology values
-  tech = Technology(techFileName);
+  tech = Technology::fromTechFile(techFileName, config.techJSON);
 
   // Get general values for the bank
-  JsonAssist jsonArch(archFileName);
+  JsonAssist jsonArch(archFileName, config.archJSON);
 
   double magnitude = INVALID_DOUBLE;
 
@@ -817,9 +880,17 @@ try {
         "Optimization mode []", mandatory);
   setOptMode( optModeStr );
 
+  magnitude = jsonArch.getJSONNumber(
+        "Optimization threads []", optional);
+  setNOptimizationThreads( magnitude );
+
+  magnitude = jsonArch.getJSONNumber(
+        "Array sizes per power of two []", optional);
+  setNArraySizesPerPowerOfTwo( magnitude );
+
   magnitude = jsonArch.getJSONNumber(
         "Bank capacity [Gb]", mandatory);
-  setCapacity( magnitude * rrs::gibibits );
+  setCapacity(SCALE_QUANTITY(magnitude * rrs::gibibits, rrs::bit_unit));
 
   magnitude = jsonArch.getJSONNumber(
         "Data bus width [bits]", mandatory);
@@ -835,7 +906,8 @@ try {
 
   magnitude = jsonArch.getJSONNumber(
         "Crosspoint array area [nm^2]", optional);
-  subarray.setArea( magnitude * rrs::square_nanometers );
+  subarray.setArea(SCALE_QUANTITY(magnitude * rrs::square_nanometers,
+                                  rrs::square_meter_unit));
 
   magnitude = jsonArch.getJSONNumber(
         "Number of array columns []", optional);
@@ -861,46 +933,315 @@ Bank::runFixedMode()
 }
 
 
+vector<double>
+Bank::candidateArraySizes() const
+{
+  // Evenly spaced sizes from each power of two up to the next one
+  //  Non integer sizes are skipped
+  vector<double> sizes;
+  double nSizes = nArraySizesPerPowerOfTwo.value();
+  for (double powerOfTwo = 2; powerOfTwo <= 8192; powerOfTwo *= 2) {
+    for (double sizeID = 0; sizeID < nSizes; ++sizeID) {
+      double size = powerOfTwo * (1. + sizeID / nSizes);
+      if ( size > 8192 ) { break; }
+      if ( isInteger(size) ) {
+        sizes.push_back(size);
+      }
+    }
+  }
+  return sizes;
+}
+
+bool
+Bank::isFeasibleSubarraySize()
+{
+  subarray.updateGeometry();
+  // Periphery does not fit underneath the subarray
+  if ( !areEqual(subarray.getAreaEfficiency(), 1.) ) {
+    return false;
+  }
+
+  updateNSubarrays();
+  if ( !isInteger(nSubarrays.value())
+       || nSubarrays < nActiveSubarraysPerAccess ) {
+    return false;
+  }
+  if ( !isInteger(nSubarraysPerRow.value())
+       || !isInteger(nSubarraysPerCol.value()) ) {
+    return false;
+  }
+
+  updatePageSize();
+  if ( !isInteger(pageSize.value() / minAddressableBlock.value()) ) {
+    return false;
+  }
+
+  return true;
+}
+
 void
 Bank::runOptimizationMode()
 {
-  // Run optimization
-  auto bestNRows = subarray.getNRows();
-  auto bestNCols = subarray.getNCols();
+  TRACE_SCOPE("Bank::runOptimizationMode");
+
+  // Candidate array sizes - every combination of rows and columns
+  vector<double> sizes = candidateArraySizes();
+  vector<SolutionCandidate> candidates;
+  for (auto nRows : sizes) {
+    for (auto nCols : sizes) {
+      SolutionCandidate candidate;
+      candidate.nRows = nRows;
+      candidate.nCols = nCols;
+      candidate.feasible = false;
+      candidate.evaluated = false;
+      candidate.failed = false;
+      invalidate(&candidate.tccdw);
+      invalidate(&candidate.writeEnergy);
+      candidates.push_back(candidate);
+    }
+  }
+
+  // Prune candidates that could never be the solution and bound the others
+  //  Only geometry and RC delays are derived, much cheaper than any solve
+  vector<ostringstream> candidateMessages(candidates.size());
+  vector<size_t> feasibleIDs;
+  for (size_t candidateID = 0; candidateID < candidates.size();
+       ++candidateID) {
+    SolutionCandidate& candidate = candidates[candidateID];
+    {
+      MessageRedirection redirection(&candidateMessages[candidateID]);
+      Bank candidateBank(*this);
+      candidateBank.subarray.setNRows(candidate.nRows);
+      candidateBank.subarray.setNCols(candidate.nCols);
+      candidate.feasible = candidateBank.isFeasibleSubarraySize();
+      if ( candidate.feasible ) {
+        candidateBank.updateGeometry();
+        candidateBank.updateInterfaceBusEnergy();
+        candidateBank.subarray.updateDelays();
+
+        candidate.minTccdw = candidateBank.subarray.getMinWriteTime();
+        candidate.minWriteEnergy = candidateBank.nActiveSubarraysPerAccess
+            * candidateBank.subarray.getMinWriteEnergy();
+        candidate.minWriteEnergy += candidateBank.interfaceBusEnergy;
+      }
+    }
+
+    if ( candidate.feasible ) {
+      feasibleIDs.push_back(candidateID);
+    }
+  }
+
+  // Run optimization - branch and bound
+  // Candidates are evaluated from the lowest bound up, in batches of one
+  //  candidate per thread. A candidate is dropped as soon as its bound, or
+  //  its write figures once solved, are strictly worse than the best of the
+  //  previous batches - it can neither win nor tie, so the best solution is
+  //  the same as evaluating every candidate.
+  // Each candidate is evaluated on its own copy of this bank, all starting
+  //  from the same state, so no result depends on the evaluation order or
+  //  on the number of threads. Messages and failures are kept apart per
+  //  candidate and solve, and only the ones of the solves a one by one
+  //  evaluation would have run are reported, in the candidates order
+  stable_sort(feasibleIDs.begin(), feasibleIDs.end(),
+              [&](size_t lhsID, size_t rhsID) {
+    return optimizationObjective(candidates[lhsID].minTccdw,
+                                 candidates[lhsID].minWriteEnergy)
+           < optimizationObjective(candidates[rhsID].minTccdw,
+                                   candidates[rhsID].minWriteEnergy);
+  });
+
+  vector<ostringstream> writeMessages(candidates.size());
+  vector<ostringstream> readMessages(candidates.size());
+  vector<string> candidateFailures(candidates.size());
+  size_t nThreads = size_t(nOptimizationThreads.value());
+  size_t batchSize = nWorkerThreads(nThreads);
+  double bestObjective = numeric_limits<double>::infinity();
+  size_t nextID = 0;
+  while ( nextID < feasibleIDs.size() ) {
+    const SolutionCandidate& nextCandidate = candidates[feasibleIDs[nextID]];
+    if ( optimizationObjective(nextCandidate.minTccdw,
+                               nextCandidate.minWriteEnergy)
+         > bestObjective ) {
+      // Bounds are sorted, so no candidate left can beat the best
+      break;
+    }
+
+    size_t batchEnd = min(nextID + batchSize, feasibleIDs.size());
+    runParallelTasks(batchEnd - nextID, nThreads, [&](size_t taskID) {
+      size_t candidateID = feasibleIDs[nextID + taskID];
+      SolutionCandidate& candidate = candidates[candidateID];
+      TRACE_SCOPE_DETAIL("Bank candidate",
+                         candidate.nRows.value() << " x "
+                         << candidate.nCols.value());
+      MessageRedirection redirection(&writeMessages[candidateID]);
+      Bank candidateBank(*this);
+      candidateBank.subarray.setNRows(candidate.nRows);
+      candidateBank.subarray.setNCols(candidate.nCols);
+
+      // A solve failing - on its limits or diverging - only drops this
+      //  candidate, the others are still evaluated
+      try {
+        candidateBank.subarray.updateGeometry();
+        if ( optimizationObjective(candidate.minTccdw,
+                                   candidate.minWriteEnergy)
+             <= bestObjective ) {
+          candidateBank.subarray.updateDelays();
+          candidateBank.subarray.updateWriteOperation();
+          candidateBank.updateGeometry();
+          candidateBank.updateTccdw();
+          candidateBank.updateInterfaceBusEnergy();
+          candidateBank.updateWriteEnergy();
+          candidate.tccdw = candidateBank.getTccdw();
+          candidate.writeEnergy = candidateBank.getWriteEnergy();
+
+          // The read voltage search is only worth for a possible best
+          if ( optimizationObjective(candidate.tccdw, candidate.writeEnergy)
+               <= bestObjective ) {
+            MessageRedirection readRedirection(&readMessages[candidateID]);
+            candidateBank.subarray.updateReadOperation();
+            candidateBank.updateAll();
+
+            candidate.subarrayAreaEfficiency =
+                candidateBank.subarray.getAreaEfficiency();
+            candidate.tccdw = candidateBank.getTccdw();
+            candidate.writeEnergy = candidateBank.getWriteEnergy();
+            candidate.tccdr = candidateBank.getTccdr();
+            candidate.readEnergy = candidateBank.getReadEnergy();
+            candidate.leakagePower = candidateBank.getLeakagePower();
+            candidate.area = candidateBank.getArea();
+            candidate.evaluated = true;
+          }
+        }
+      } catch(string exceptionMsgThrown) {
+        candidate.failed = true;
+        candidateFailures[candidateID] = exceptionMsgThrown;
+      }
+    });
+
+    for (; nextID < batchEnd; ++nextID) {
+      const SolutionCandidate& candidate = candidates[feasibleIDs[nextID]];
+      if ( candidate.evaluated ) {
+        bestObjective = min(bestObjective,
+                            optimizationObjective(candidate.tccdw,
+                                                  candidate.writeEnergy));
+      }
+    }
+  }
 
-  auto nRows = 2;
-  auto nCols = 2;
-  //TODO proper while
-  bool tic = false;
-  while ( nRows <= 8192 && nCols <= 8192 ) {
-    subarray.setNRows(nRows);
-    subarray.setNCols(nCols);
+  // Replayed one by one from the lowest bound up - a batch may have solved
+  //  more than the best of its own candidates would have let through.
+  //  Failing or not, those solves are dropped
+  double serialBestObjective = numeric_limits<double>::infinity();
+  for (size_t candidateID : feasibleIDs) {
+    SolutionCandidate& candidate = candidates[candidateID];
+    bool writeSolved = optimizationObjective(candidate.minTccdw,
+                                             candidate.minWriteEnergy)
+                       <= serialBestObjective;
+    bool readSolved = writeSolved && isValid(candidate.tccdw)
+                      && optimizationObjective(candidate.tccdw,
+                                               candidate.writeEnergy)
+                         <= serialBestObjective;
+
+    if ( !readSolved ) {
+      readMessages[candidateID] = ostringstream();
+      candidate.evaluated = false;
+      if ( isValid(candidate.tccdw) ) {
+        // Any failure was on the read solves
+        candidate.failed = false;
+      }
+    }
+    if ( !writeSolved ) {
+      writeMessages[candidateID] = ostringstream();
+      candidate.failed = false;
+    }
 
-    subarray.updateXPointArray();
-    updateAll();
+    if ( candidate.evaluated ) {
+      serialBestObjective = min(serialBestObjective,
+                                optimizationObjective(candidate.tccdw,
+                                                      candidate.writeEnergy));
+    }
+  }
 
-    if ( isBetterSolution() ) {
-      bestNCols = nCols;
-      bestNRows = nRows;
+  // Reduced serially, in the candidates order
+  auto bestNRows = subarray.getNRows();
+  auto bestNCols = subarray.getNCols();
+  size_t nEvaluated = 0;
+  size_t nFailed = 0;
+  for (size_t candidateID = 0; candidateID < candidates.size();
+       ++candidateID) {
+    printMessages(candidateMessages[candidateID].str());
+    printMessages(writeMessages[candidateID].str());
+    printMessages(readMessages[candidateID].str());
+
+    if ( candidates[candidateID].failed ) {
+      ++nFailed;
+      const SolutionCandidate& candidate = candidates[candidateID];
+      PRINT_WARNING("Skipped the " << to_string(candidate.nRows)
+                    << " x " << to_string(candidate.nCols)
+                    << " array size, failed with: "
+                    << candidateFailures[candidateID]);
+    }
+    if ( !candidates[candidateID].evaluated ) { continue; }
+    ++nEvaluated;
+    if ( optMode == pareto ) {
+      updateParetoFront(candidates[candidateID]);
     }
+    else if ( isBetterSolution(candidates[candidateID]) ) {
+      bestNCols = candidates[candidateID].nCols;
+      bestNRows = candidates[candidateID].nRows;
+    }
+  }
 
-//   PRINT_VAR(writeEnergy);
-//    PRINT_VAR(readEnergy);
-//    PRINT_VAR(subarray.getReadEnergy());
+  if ( feasibleIDs.empty() ) {
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("No candidate array size fits the bank.");
+    exceptionMsgThrown.append(" The periphery does not fit underneath the");
+    exceptionMsgThrown.append(" array or the bank capacity is not a whole");
+    exceptionMsgThrown.append(" number of arrays.");
+    throw exceptionMsgThrown;
+  }
 
-    if ( tic ) {
-      nCols *= 2;
-      tic = !tic;
-    } else {
-      nRows *= 2;
-      tic = !tic;
+  if ( nFailed > 0 ) {
+    if ( nEvaluated == 0 ) {
+      string exceptionMsgThrown("[ERROR] ");
+      exceptionMsgThrown.append("Every candidate array size evaluated");
+      exceptionMsgThrown.append(" failed - ");
+      exceptionMsgThrown.append(to_string(nFailed));
+      exceptionMsgThrown.append(" of them. See the warnings above.");
+      throw exceptionMsgThrown;
     }
+    PRINT_WARNING(nFailed << " candidate array size(s) failed and were"
+                  << " skipped - the solution is the best of the others.");
   }
 
-  // Get best size values
-  cout<<"-----------------------------------" <<"\n";
-  cout<<"********* Best Solution************" <<"\n";
-  cout<<"-----------------------------------" <<"\n";
+  if ( optMode == pareto ) {
+    if ( paretoFront.empty() ) {
+      string exceptionMsgThrown("[ERROR] ");
+      exceptionMsgThrown.append("No candidate array size could be compared");
+      exceptionMsgThrown.append(" for the Pareto front.");
+      throw exceptionMsgThrown;
+    }
+    // Detailed results for the fastest write of the front
+    bestNRows = paretoFront.front().nRows;
+    bestNCols = paretoFront.front().nCols;
+    auto fastestTccdw = paretoFront.front().tccdw;
+    for (const auto& solution : paretoFront) {
+      if ( solution.tccdw < fastestTccdw ) {
+        fastestTccdw = solution.tccdw;
+        bestNRows = solution.nRows;
+        bestNCols = solution.nCols;
+      }
+    }
+    PRINT_MESSAGE(LOG_LEVEL_INFO, "-----------------------------------");
+    PRINT_MESSAGE(LOG_LEVEL_INFO, "********* Pareto Front ************");
+    PRINT_MESSAGE(LOG_LEVEL_INFO, "-----------------------------------");
+  }
+  else {
+    // Get best size values
+    PRINT_MESSAGE(LOG_LEVEL_INFO, "-----------------------------------");
+    PRINT_MESSAGE(LOG_LEVEL_INFO, "********* Best Solution************");
+    PRINT_MESSAGE(LOG_LEVEL_INFO, "-----------------------------------");
+  }
   subarray.setNRows(bestNRows);
   subarray.setNCols(bestNCols);
   subarray.updateXPointArray();
@@ -908,41 +1249,59 @@ Bank::runOptimizationMode()
 
 }
 
+double
+Bank::optimizationObjective(bu::quantity<rrs::second_unit> tccdw,
+                            bu::quantity<rrs::joule_unit> writeEnergy)
+                            const
+{
+  switch (optMode) {
+    case performance: return tccdw.value();
+    case energy:      return writeEnergy.value();
+    // No bound for the other modes - never reject
+    case pareto: break;
+    case fixed: break;
+    case density: break;
+    case INVALID_OPT_MODE: break;
+  }
+  return -numeric_limits<double>::infinity();
+}
+
 ebool
-Bank::isBetterSolution()
+Bank::isBetterSolution(const SolutionCandidate& candidate)
 {
   ebool returnVal = INVALID_EBOOL;
-  if ( !areEqual(subarray.getAreaEfficiency(), 1.) ) {
+  if ( !areEqual(candidate.subarrayAreaEfficiency, 1.) ) {
     return false;
   }
   switch (optMode) {
     case performance:
       if ( isValid(bestWriteTime)) {
-        if ( tccdw < bestWriteTime ) {
-          bestWriteTime = tccdw;
+        if ( candidate.tccdw < bestWriteTime ) {
+          bestWriteTime = candidate.tccdw;
           returnVal = true;
         } else {
           returnVal = false;
         }
       } else {
-        bestWriteTime = tccdw;
+        bestWriteTime = candidate.tccdw;
         returnVal = true;
       }
       break;
     case energy:
       if ( isValid(bestWriteEnergy) ) {
-        if ( writeEnergy < bestWriteEnergy ) {
-          bestWriteEnergy = writeEnergy;
+        if ( candidate.writeEnergy < bestWriteEnergy ) {
+          bestWriteEnergy = candidate.writeEnergy;
           returnVal = true;
         } else {
           returnVal = false;
         }
       } else {
-        bestWriteEnergy = writeEnergy;
+        bestWriteEnergy = candidate.writeEnergy;
         returnVal = true;
       }
       break;
     // Invalid optmization modes
+    case pareto: break;
     case fixed: break;
     case density: break;
     case INVALID_OPT_MODE: break;
@@ -959,6 +1318,48 @@ Bank::isBetterSolution()
   return returnVal;
 }
 
+vector<double>
+Bank::paretoObjectives(const SolutionCandidate& candidate) const
+{
+  return { candidate.tccdw.value(), candidate.tccdr.value(),
+           candidate.writeEnergy.value(), candidate.readEnergy.value(),
+           candidate.leakagePower.value(), candidate.area.value() };
+}
+
+void
+Bank::updateParetoFront(const SolutionCandidate& candidate)
+{
+  if ( !areEqual(candidate.subarrayAreaEfficiency, 1.) ) {
+    return;
+  }
+  auto candidateObjectives = paretoObjectives(candidate);
+  // Figures that cannot be compared never make a solution
+  for (auto objective : candidateObjectives) {
+    if ( !std::isfinite(objective) ) { return; }
+  }
+
+  // The front is small next to the candidates, so a linear archive is enough
+  //  Equal figures keep the solution found first
+  for (const auto& solution : paretoFront) {
+    auto solutionObjectives = paretoObjectives(solution);
+    if ( solutionObjectives == candidateObjectives
+         || dominates(solutionObjectives, candidateObjectives) ) {
+      return;
+    }
+  }
+  paretoFront.erase(remove_if(paretoFront.begin(), paretoFront.end(),
+                              [&](const SolutionCandidate& solution) {
+    return dominates(candidateObjectives, paretoObjectives(solution));
+  }), paretoFront.end());
+  paretoFront.push_back(candidate);
+}
+
+vector<Bank::SolutionCandidate> const &
+Bank::getParetoFront() const
+{
+  return this->paretoFront;
+}
+
 
 Bank::Bank()
 {
@@ -982,6 +1383,7 @@ Bank::Bank(const Config& config)
       case energy:            runOptimizationMode();  break;
       case performance:       runOptimizationMode();  break;
       case density:           runOptimizationMode();  break;
+      case pareto:            runOptimizationMode();  break;
       case INVALID_OPT_MODE:
         string exceptionMsgThrown("[ERROR] ");
         exceptionMsgThrown.append("Unexpected behaviour - ");
@@ -54,13 +54,40 @@ using namespace std;
 class Bank
 {
 
+public:
+  // Figures of merit of an array size evaluated by the optimization
+  struct SolutionCandidate {
+    bu::quantity<rrs::dimensionless> nRows;
+    bu::quantity<rrs::dimensionless> nCols;
+    bu::quantity<rrs::dimensionless> subarrayAreaEfficiency;
+    bu::quantity<rrs::second_unit> tccdw;
+    bu::quantity<rrs::joule_unit> writeEnergy;
+    bu::quantity<rrs::second_unit> tccdr;
+    bu::quantity<rrs::joule_unit> readEnergy;
+    bu::quantity<rrs::watt_unit> leakagePower;
+    bu::quantity<rrs::square_meter_unit> area;
+    bool feasible;
+    // Lower bounds known before any cell voltage is solved
+    bu::quantity<rrs::second_unit> minTccdw;
+    bu::quantity<rrs::joule_unit> minWriteEnergy;
+    // Fully evaluated - not rejected as worse than the best on the way
+    bool evaluated;
+    // A solve of its evaluation failed - it is reported and skipped
+    bool failed;
+  };
+
+
 private:
 
-  enum optimizationModes { fixed, density, performance, energy,
+  enum optimizationModes { fixed, density, performance, energy, pareto,
                            INVALID_OPT_MODE };
   optimizationModes optMode;
+  // Threads evaluating the candidate array sizes - 0 for all hardware threads
+  bu::quantity<rrs::dimensionless> nOptimizationThreads;
+  // Row and column counts evaluated from each power of two to the next one
+  bu::quantity<rrs::dimensionless> nArraySizesPerPowerOfTwo;
 
-  bu::quantity<rrs::gibibit_unit> capacity;
+  bu::quantity<rrs::bit_unit> capacity;
   bu::quantity<rrs::dimensionless> nDataBusBits;
   bu::quantity<rrs::dimensionless> prefetch;
 
@@ -76,47 +103,47 @@ private:
 
 
   // Mechanical parameters
-  bu::quantity<rrs::nanometer_unit> rowDecoderWidth;
-  bu::quantity<rrs::nanometer_unit> rowDecoderHeight;
-  bu::quantity<rrs::square_nanometer_unit> rowDecoderArea;
-  bu::quantity<rrs::nanometer_unit> colDecoderWidth;
-  bu::quantity<rrs::nanometer_unit> colDecoderHeight;
-  bu::quantity<rrs::square_nanometer_unit> colDecoderArea;
-
-  bu::quantity<rrs::square_nanometer_unit> area;
-  bu::quantity<rrs::nanometer_unit> height;
-  bu::quantity<rrs::nanometer_unit> width;
+  bu::quantity<rrs::meter_unit> rowDecoderWidth;
+  bu::quantity<rrs::meter_unit> rowDecoderHeight;
+  bu::quantity<rrs::square_meter_unit> rowDecoderArea;
+  bu::quantity<rrs::meter_unit> colDecoderWidth;
+  bu::quantity<rrs::meter_unit> colDecoderHeight;
+  bu::quantity<rrs::square_meter_unit> colDecoderArea;
+
+  bu::quantity<rrs::square_meter_unit> area;
+  bu::quantity<rrs::meter_unit> height;
+  bu::quantity<rrs::meter_unit> width;
   bu::quantity<rrs::dimensionless> areaEfficiency;
 
 
   // Timing results
-  bu::quantity<rrs::nanosecond_unit> rowDecoderDelay;
-  bu::quantity<rrs::nanosecond_unit> colDecoderDelay;
+  bu::quantity<rrs::second_unit> rowDecoderDelay;
+  bu::quantity<rrs::second_unit> colDecoderDelay;
 
-  bu::quantity<rrs::nanosecond_unit> globalBusDelay;
+  bu::quantity<rrs::second_unit> globalBusDelay;
 
-  bu::quantity<rrs::nanosecond_unit> prechargeTime;
-  bu::quantity<rrs::nanosecond_unit> writeTime;
-  bu::quantity<rrs::nanosecond_unit> readTime;
+  bu::quantity<rrs::second_unit> prechargeTime;
+  bu::quantity<rrs::second_unit> writeTime;
+  bu::quantity<rrs::second_unit> readTime;
 
-  bu::quantity<rrs::nanosecond_unit> tpd;
-  bu::quantity<rrs::nanosecond_unit> tccdr;
-  bu::quantity<rrs::nanosecond_unit> tccdw;
-  bu::quantity<rrs::nanosecond_unit> trl;
-  bu::quantity<rrs::nanosecond_unit> twl;
+  bu::quantity<rrs::second_unit> tpd;
+  bu::quantity<rrs::second_unit> tccdr;
+  bu::quantity<rrs::second_unit> tccdw;
+  bu::quantity<rrs::second_unit> trl;
+  bu::quantity<rrs::second_unit> twl;
 
   // Power results
-  bu::quantity<rrs::nanowatt_unit> leakagePower;
+  bu::quantity<rrs::watt_unit> leakagePower;
 
   // Energy results
-  bu::quantity<rrs::picojoule_unit> interfaceBusEnergy;
-  bu::quantity<rrs::picojoule_unit> prechargeEnergy;
-  bu::quantity<rrs::picojoule_unit> writeEnergy;
-  bu::quantity<rrs::picojoule_unit> readEnergy;
+  bu::quantity<rrs::joule_unit> interfaceBusEnergy;
+  bu::quantity<rrs::joule_unit> prechargeEnergy;
+  bu::quantity<rrs::joule_unit> writeEnergy;
+  bu::quantity<rrs::joule_unit> readEnergy;
 
   // Best values for different opt modes
-  bu::quantity<rrs::picojoule_unit> bestWriteEnergy;
-  bu::quantity<rrs::nanosecond_unit> bestWriteTime;
+  bu::quantity<rrs::joule_unit> bestWriteEnergy;
+  bu::quantity<rrs::second_unit> bestWriteTime;
 
   // Configuration files
   const char* cellFileName;
@@ -131,8 +158,28 @@ private:
   void runFixedMode();
   void runOptimizationMode();
 
-  // Evaluates if the current solution is a better solution
-  ebool isBetterSolution();
+  // Figure of merit minimized by the optimization mode
+  double optimizationObjective(bu::quantity<rrs::second_unit> tccdw,
+                               bu::quantity<rrs::joule_unit> writeEnergy)
+                              const;
+
+  // Row and column counts evaluated by the optimization
+  vector<double> candidateArraySizes() const;
+
+  // Tests, without solving the subarray, whether its current size can build
+  //  this bank - periphery underneath it and whole subarrays and pages
+  bool isFeasibleSubarraySize();
+
+  // Evaluates if the candidate is better than the best solution so far
+  ebool isBetterSolution(const SolutionCandidate&);
+
+  // Non-dominated candidates of the pareto mode, in the candidates order
+  vector<SolutionCandidate> paretoFront;
+  // Figures traded off by the pareto mode, all minimized
+  vector<double> paretoObjectives(const SolutionCandidate&) const;
+  // Adds the candidate to the front if no solution in it dominates the
+  //  candidate, dropping the solutions the candidate dominates
+  void updateParetoFront(const SolutionCandidate&);
 
   // Constants
   bu::quantity<rrs::dimensionless> nCommandLines = 2;
@@ -140,8 +187,8 @@ private:
   bu::quantity<rrs::dimensionless> nVppDecodedLvls = 4;
 
   // TODO: Temporary variables that could be estimated
-  bu::quantity<rrs::nanoampere_unit> leakagePerVoltageTranslator
-                                      = 50 * rrs::nanoamperes;
+  bu::quantity<rrs::ampere_unit> leakagePerVoltageTranslator
+                                      = 50e-9 * rrs::amperes;
 
   bu::quantity<rrs::dimensionless> nF2PerDecodedAddress = 100;
 
@@ -150,7 +197,7 @@ private:
   bu::quantity<rrs::dimensionless> globalWireResistanceMultiplier = 0.1;
   bu::quantity<rrs::dimensionless> globalWireCapacitanceMultiplier = 2;
 
-  bu::quantity<rrs::nanosecond_unit> decodingDelay = 5 * rrs::nanoseconds;
+  bu::quantity<rrs::second_unit> decodingDelay = 5e-9 * rrs::seconds;
 
 
 public:
@@ -163,16 +210,23 @@ public:
   Technology tech;
 
   void setOptMode( string );
-  string getOptMode();
+  string getOptMode() const;
+  void setNOptimizationThreads(bu::quantity<rrs::dimensionless>);
+  bu::quantity<rrs::dimensionless> const &getNOptimizationThreads() const;
+  void setNArraySizesPerPowerOfTwo(bu::quantity<rrs::dimensionless>);
+  bu::quantity<rrs::dimensionless> const &getNArraySizesPerPowerOfTwo() const;
 
 
-  void setCapacity(bu::quantity<rrs::gibibit_unit>);
-  bu::quantity<rrs::gibibit_unit> const &getCapacity() const;
+  void setCapacity(bu::quantity<rrs::bit_unit>);
+  bu::quantity<rrs::bit_unit> const &getCapacity() const;
   void setNDataBusBits(bu::quantity<rrs::dimensionless>);
   bu::quantity<rrs::dimensionless> const &getNDataBusBits() const;
   void setPrefetch(bu::quantity<rrs::dimensionless>);
   bu::quantity<rrs::dimensionless> const &getPrefetch() const;
 
+  // Subarrays, addressing and area - no timing nor energy
+  void updateGeometry();
+
   void updateNSubarrays();
   bu::quantity<rrs::dimensionless> const &getNSubarrays() const;
   bu::quantity<rrs::dimensionless> const &getNActiveSubarraysPerAccess() const;
@@ -190,67 +244,68 @@ public:
 
 
   void updateRowDecoderArea();
-  bu::quantity<rrs::square_nanometer_unit> const &getRowDecoderArea() const;
-  bu::quantity<rrs::nanometer_unit> const &getRowDecoderWidth() const;
-  bu::quantity<rrs::nanometer_unit> const &getRowDecoderHeight() const;
+  bu::quantity<rrs::square_meter_unit> const &getRowDecoderArea() const;
+  bu::quantity<rrs::meter_unit> const &getRowDecoderWidth() const;
+  bu::quantity<rrs::meter_unit> const &getRowDecoderHeight() const;
 
   void updateColDecoderArea();
-  bu::quantity<rrs::square_nanometer_unit> const &getColDecoderArea() const;
-  bu::quantity<rrs::nanometer_unit> const &getColDecoderWidth() const;
-  bu::quantity<rrs::nanometer_unit> const &getColDecoderHeight() const;
+  bu::quantity<rrs::square_meter_unit> const &getColDecoderArea() const;
+  bu::quantity<rrs::meter_unit> const &getColDecoderWidth() const;
+  bu::quantity<rrs::meter_unit> const &getColDecoderHeight() const;
 
   void updateArea();
-  bu::quantity<rrs::square_nanometer_unit> const &getArea() const;
-  bu::quantity<rrs::nanometer_unit> const &getHeight() const;
-  bu::quantity<rrs::nanometer_unit> const &getWidth() const;
+  bu::quantity<rrs::square_meter_unit> const &getArea() const;
+  bu::quantity<rrs::meter_unit> const &getHeight() const;
+  bu::quantity<rrs::meter_unit> const &getWidth() const;
   bu::quantity<rrs::dimensionless> const &getAreaEfficiency() const;
 
 
   void updateRowDecoderDelay();
-  bu::quantity<rrs::nanosecond_unit> const &getRowDecoderDelay() const;
+  bu::quantity<rrs::second_unit> const &getRowDecoderDelay() const;
   void updateColDecoderDelay();
-  bu::quantity<rrs::nanosecond_unit> const &getColDecoderDelay() const;
+  bu::quantity<rrs::second_unit> const &getColDecoderDelay() const;
   void updateGlobalBusDelay();
-  bu::quantity<rrs::nanosecond_unit> const &getGlobalBusDelay() const;
+  bu::quantity<rrs::second_unit> const &getGlobalBusDelay() const;
 
   void updatePrechargeTime();
-  bu::quantity<rrs::nanosecond_unit> const &getPrechargeTime() const;
+  bu::quantity<rrs::second_unit> const &getPrechargeTime() const;
   void updateWriteTime();
-  bu::quantity<rrs::nanosecond_unit> const &getWriteTime() const;
+  bu::quantity<rrs::second_unit> const &getWriteTime() const;
   void updateReadTime();
-  bu::quantity<rrs::nanosecond_unit> const &getReadTime() const;
+  bu::quantity<rrs::second_unit> const &getReadTime() const;
 
   void updateTpd();
-  bu::quantity<rrs::nanosecond_unit> const &getTpd() const;
+  bu::quantity<rrs::second_unit> const &getTpd() const;
   void updateTccdr();
-  bu::quantity<rrs::nanosecond_unit> const &getTccdr() const;
+  bu::quantity<rrs::second_unit> const &getTccdr() const;
   void updateTccdw();
-  bu::quantity<rrs::nanosecond_unit> const &getTccdw() const;
+  bu::quantity<rrs::second_unit> const &getTccdw() const;
   void updateTrl();
-  bu::quantity<rrs::nanosecond_unit> const &getTrl() const;
+  bu::quantity<rrs::second_unit> const &getTrl() const;
   void updateTwl();
-  bu::quantity<rrs::nanosecond_unit> const &getTwl() const;
+  bu::quantity<rrs::second_unit> const &getTwl() const;
 
 
   void updateLeakagePower();
-  bu::quantity<rrs::nanowatt_unit> const &getLeakagePower() const;
+  bu::quantity<rrs::watt_unit> const &getLeakagePower() const;
 
 
   void updateInterfaceBusEnergy();
-  bu::quantity<rrs::picojoule_unit> const &getInterfaceBusEnergy() const;
+  bu::quantity<rrs::joule_unit> const &getInterfaceBusEnergy() const;
 
   void updatePrechargeEnergy();
-  bu::quantity<rrs::picojoule_unit> const &getPrechargeEnergy() const;
+  bu::quantity<rrs::joule_unit> const &getPrechargeEnergy() const;
   void updateWriteEnergy();
-  bu::quantity<rrs::picojoule_unit> const &getWriteEnergy() const;
+  bu::quantity<rrs::joule_unit> const &getWriteEnergy() const;
   void updateReadEnergy();
-  bu::quantity<rrs::picojoule_unit> const &getReadEnergy() const;
+  bu::quantity<rrs::joule_unit> const &getReadEnergy() const;
 
   void updateAll();
 
   // Best values for different opt modes
-  bu::quantity<rrs::picojoule_unit> const &getBestWriteEnergy() const;
-  bu::quantity<rrs::nanosecond_unit> const &getBestWriteTime() const;
+  bu::quantity<rrs::joule_unit> const &getBestWriteEnergy() const;
+  bu::quantity<rrs::second_unit> const &getBestWriteTime() const;
+  vector<SolutionCandidate> const &getParetoFront() const;
 
 
 };
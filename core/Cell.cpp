@@ -36,11 +36,49 @@
 
 #include "Cell.h"
 
+#ifdef __AVX2__
+#include <immintrin.h>
+
+// Gathers of 4 doubles at 32 bits indices - masked, with a defined source,
+//  since the plain intrinsics leave it undefined
+static inline __m256d
+gatherDoubles(const double* base, __m128i index)
+{
+  return _mm256_mask_i32gather_pd(_mm256_setzero_pd(), base, index,
+                                  _mm256_castsi256_pd(_mm256_set1_epi64x(-1)),
+                                  8);
+}
+#endif
+
+// Raw tables lookup grid - 1 mV bins, up to 8 V cell voltages, leave only a
+//  few table points to scan past in the denser parts of the tables
+#define CELL_IXV_GRID_BINS_PER_VOLT 1e3
+#define CELL_IXV_GRID_MAX_BINS 8192
+
 namespace bu=boost::units;
 namespace rrs=boost::units::rramspec;
 
 using namespace std;
 
+// Cell I-V tables of both resistance states, as built by buildCellIxV
+struct CellIxVTables {
+  vector<vector<bu::quantity<rrs::volt_unit>>> cellVoltageDataPoints;
+  vector<vector<bu::quantity<rrs::ampere_unit>>> cellCurrentDataPoints;
+  vector<vector<double>> rawCellVoltageDataPoints;
+  vector<vector<double>> rawCellCurrentDataPoints;
+  vector<vector<int>> rawCellGridIndex;
+};
+
+// Process-wide cache of cell I-V tables, keyed by cellIxVKey
+//  Entries are never changed once inserted
+static map<vector<double>, CellIxVTables> cellIxVCache;
+static mutex cellIxVCacheMutex;
+
+// Process-wide cache of the cells built by fromCellFile, keyed by file name
+//  Each cell is kept with the stamp of its file when it was built
+static map<string, pair<string, Cell>> parsedCells;
+static mutex parsedCellsMutex;
+
 void
 Cell::initialize()
 {
@@ -52,40 +90,43 @@ Cell::initialize()
   selDevModel = INVALID_MODEL;
 
   selDevSnapVoltage = INVALID_DOUBLE * rrs::volts;
-  selDevLeakageCurrent = INVALID_DOUBLE * rrs::nanoamperes;
-  selDevMaxCurrent = INVALID_DOUBLE * rrs::nanoamperes;
+  selDevLeakageCurrent = INVALID_DOUBLE * rrs::amperes;
+  selDevMaxCurrent = INVALID_DOUBLE * rrs::amperes;
 
   selVoltageDataPoints.push_back(INVALID_DOUBLE * rrs::volts);
-  selCurrentDataPoints.push_back(INVALID_DOUBLE * rrs::nanoamperes);
+  selCurrentDataPoints.push_back(INVALID_DOUBLE * rrs::amperes);
 
   // HRS (0) and LRS (1)
   cellVoltageDataPoints.resize(2);
   cellCurrentDataPoints.resize(2);
   cellVoltageDataPoints.at(0).push_back(INVALID_DOUBLE * rrs::volts);
-  cellCurrentDataPoints.at(0).push_back(INVALID_DOUBLE * rrs::nanoamperes);
+  cellCurrentDataPoints.at(0).push_back(INVALID_DOUBLE * rrs::amperes);
   cellVoltageDataPoints.at(1).push_back(INVALID_DOUBLE * rrs::volts);
-  cellCurrentDataPoints.at(1).push_back(INVALID_DOUBLE * rrs::nanoamperes);
+  cellCurrentDataPoints.at(1).push_back(INVALID_DOUBLE * rrs::amperes);
+  rawCellVoltageDataPoints.assign(2, vector<double>(1, INVALID_DOUBLE));
+  rawCellCurrentDataPoints.assign(2, vector<double>(1, INVALID_DOUBLE));
+  rawCellGridIndex.assign(2, vector<int>());
 
   setVoltage = INVALID_DOUBLE * rrs::volts;
-  setCurrent = INVALID_DOUBLE * rrs::nanoamperes;
-  setComplianceCurrent = INVALID_DOUBLE * rrs::nanoamperes;
+  setCurrent = INVALID_DOUBLE * rrs::amperes;
+  setComplianceCurrent = INVALID_DOUBLE * rrs::amperes;
   resetVoltage = INVALID_DOUBLE * rrs::volts;
-  resetCurrent = INVALID_DOUBLE * rrs::nanoamperes;
+  resetCurrent = INVALID_DOUBLE * rrs::amperes;
   readVoltage = INVALID_DOUBLE * rrs::volts;
-  readCurrent = INVALID_DOUBLE * rrs::nanoamperes;
+  readCurrent = INVALID_DOUBLE * rrs::amperes;
   readCurrentRatio = INVALID_DOUBLE;
 
-  setTime = INVALID_DOUBLE * rrs::nanoseconds;
-  setTimeC = INVALID_DOUBLE * rrs::nanoseconds;
+  setTime = INVALID_DOUBLE * rrs::seconds;
+  setTimeC = INVALID_DOUBLE * rrs::seconds;
   setTimeK = INVALID_DOUBLE * rrs::per_volt;
-  resetTime = INVALID_DOUBLE * rrs::nanoseconds;
-  resetTimeC = INVALID_DOUBLE * rrs::nanoseconds;
+  resetTime = INVALID_DOUBLE * rrs::seconds;
+  resetTimeC = INVALID_DOUBLE * rrs::seconds;
   resetTimeK = INVALID_DOUBLE * rrs::per_volt;
 
-  cellWidth = INVALID_DOUBLE * rrs::nanometers;
-  cellHeight = INVALID_DOUBLE * rrs::nanometers;
-  cellToCellSpacing = INVALID_DOUBLE * rrs::nanometers;
-  cellThickness = INVALID_DOUBLE * rrs::nanometers;
+  cellWidth = INVALID_DOUBLE * rrs::meters;
+  cellHeight = INVALID_DOUBLE * rrs::meters;
+  cellToCellSpacing = INVALID_DOUBLE * rrs::meters;
+  cellThickness = INVALID_DOUBLE * rrs::meters;
 
   maxCurrentRelativeError = INVALID_DOUBLE;
 }
@@ -214,7 +255,7 @@ Cell::setSelDevModel(string selModelStr, settingOptions setOpt)
     bool found_0_0 = false;
     for (size_t i = 0; i < selVoltageDataPoints.size(); ++i) {
       if ( selVoltageDataPoints.at(i) == 0 * rrs::volts
-           && selCurrentDataPoints.at(i) == 0 * rrs::nanoamperes ) {
+           && selCurrentDataPoints.at(i) == 0 * rrs::amperes ) {
         found_0_0 = true;
         break;
       }
@@ -278,13 +319,13 @@ Cell::getSelDevSnapVoltage() const
 
 
 void
-Cell::setSelDevLeakageCurrent(bu::quantity<rrs::nanoampere_unit> iLeak)
+Cell::setSelDevLeakageCurrent(bu::quantity<rrs::ampere_unit> iLeak)
 {
   selDevLeakageCurrent = iLeak;
   selDevModel = INVALID_MODEL;
 }
 
-bu::quantity<rrs::nanoampere_unit> const &
+bu::quantity<rrs::ampere_unit> const &
 Cell::getSelDevLeakageCurrent() const
 {
   return this->selDevLeakageCurrent;
@@ -292,13 +333,13 @@ Cell::getSelDevLeakageCurrent() const
 
 
 void
-Cell::setSelDevMaxCurrent(bu::quantity<rrs::nanoampere_unit> iSelMax)
+Cell::setSelDevMaxCurrent(bu::quantity<rrs::ampere_unit> iSelMax)
 {
   selDevMaxCurrent = iSelMax;
   selDevModel = INVALID_MODEL;
 }
 
-bu::quantity<rrs::nanoampere_unit> const &
+bu::quantity<rrs::ampere_unit> const &
 Cell::getSelDevMaxCurrent() const
 {
   return this->selDevMaxCurrent;
@@ -333,7 +374,7 @@ Cell::getSelVoltageDataPoints() const
 
 
 void
-Cell::setSelCurrentDataPoint(bu::quantity<rrs::nanoampere_unit> iPoint)
+Cell::setSelCurrentDataPoint(bu::quantity<rrs::ampere_unit> iPoint)
 {
   if ( selVoltageDataPoints.empty() ) {
     string exceptionMsgThrown("[ERROR] ");
@@ -351,7 +392,7 @@ Cell::setSelCurrentDataPoint(bu::quantity<rrs::nanoampere_unit> iPoint)
   selDevModel = INVALID_MODEL;
 }
 
-vector<bu::quantity<rrs::nanoampere_unit>> const &
+vector<bu::quantity<rrs::ampere_unit>> const &
 Cell::getSelCurrentDataPoints() const
 {
   return this->selCurrentDataPoints;
@@ -389,7 +430,7 @@ Cell::getCellSetVoltage() const
 }
 
 void
-Cell::setCellSetCurrent(bu::quantity<rrs::nanoampere_unit> iSet,
+Cell::setCellSetCurrent(bu::quantity<rrs::ampere_unit> iSet,
                         settingOptions opt)
 {
   if ( isInvalid(iSet) ) { return; }
@@ -398,26 +439,26 @@ Cell::setCellSetCurrent(bu::quantity<rrs::nanoampere_unit> iSet,
   setCellSetVoltage(getCellVoltage(iSet, false));
 }
 
-bu::quantity<rrs::nanoampere_unit> const &
+bu::quantity<rrs::ampere_unit> const &
 Cell::getCellSetCurrent() const
 {
   return this->setCurrent;
 }
 
 void
-Cell::setCellSetComplianceCurrent(bu::quantity<rrs::nanoampere_unit> icc)
+Cell::setCellSetComplianceCurrent(bu::quantity<rrs::ampere_unit> icc)
 {
   setComplianceCurrent = icc;
 }
 
-bu::quantity<rrs::nanoampere_unit> const &
+bu::quantity<rrs::ampere_unit> const &
 Cell::getCellSetComplianceCurrent() const
 {
   return this->setComplianceCurrent;
 }
 
 void
-Cell::setCellSetTime(bu::quantity<rrs::nanosecond_unit> tSet)
+Cell::setCellSetTime(bu::quantity<rrs::second_unit> tSet)
 {
   if ( isInvalid(tSet) ) { return; }
   setTime = tSet;
@@ -434,7 +475,7 @@ Cell::setCellSetTime(bu::quantity<rrs::volt_unit> VSet)
   }
 }
 
-bu::quantity<rrs::nanosecond_unit> const &
+bu::quantity<rrs::second_unit> const &
 Cell::getCellSetTime() const
 {
   return this->setTime;
@@ -459,7 +500,7 @@ Cell::getCellResetVoltage() const
 }
 
 void
-Cell::setCellResetCurrent(bu::quantity<rrs::nanoampere_unit> iReset,
+Cell::setCellResetCurrent(bu::quantity<rrs::ampere_unit> iReset,
                           settingOptions opt)
 {
   if ( isInvalid(iReset) ) { return; }
@@ -468,14 +509,14 @@ Cell::setCellResetCurrent(bu::quantity<rrs::nanoampere_unit> iReset,
   setCellResetVoltage(getCellVoltage(iReset, true));
 }
 
-bu::quantity<rrs::nanoampere_unit> const &
+bu::quantity<rrs::ampere_unit> const &
 Cell::getCellResetCurrent() const
 {
   return this->resetCurrent;
 }
 
 void
-Cell::setCellResetTime(bu::quantity<rrs::nanosecond_unit> tReset)
+Cell::setCellResetTime(bu::quantity<rrs::second_unit> tReset)
 {
   if ( isInvalid(tReset) ) { return; }
   resetTime = tReset;
@@ -492,7 +533,7 @@ Cell::setCellResetTime(bu::quantity<rrs::volt_unit> vReset)
   }
 }
 
-bu::quantity<rrs::nanosecond_unit> const &
+bu::quantity<rrs::second_unit> const &
 Cell::getCellResetTime() const
 {
   return this->resetTime;
@@ -517,7 +558,7 @@ Cell::getCellReadVoltage() const
 }
 
 void
-Cell::setCellReadCurrent(bu::quantity<rrs::nanoampere_unit> iRead,
+Cell::setCellReadCurrent(bu::quantity<rrs::ampere_unit> iRead,
                          settingOptions opt)
 {
   if ( isInvalid(iRead) ) { return; }
@@ -526,7 +567,7 @@ Cell::setCellReadCurrent(bu::quantity<rrs::nanoampere_unit> iRead,
   setCellReadVoltage(getCellVoltage(iRead, memDevResistanceState));
 }
 
-bu::quantity<rrs::nanoampere_unit> const &
+bu::quantity<rrs::ampere_unit> const &
 Cell::getCellReadCurrent() const
 {
   return this->readCurrent;
@@ -550,12 +591,12 @@ Cell::getCellReadCurrentRatio() const
 
 
 void
-Cell::setCellSetTimeC(bu::quantity<rrs::nanosecond_unit> setC)
+Cell::setCellSetTimeC(bu::quantity<rrs::second_unit> setC)
 {
   setTimeC = setC;
 }
 
-bu::quantity<rrs::nanosecond_unit> const &
+bu::quantity<rrs::second_unit> const &
 Cell::getCellSetTimeC() const
 {
   return this->setTimeC;
@@ -575,12 +616,12 @@ Cell::getCellSetTimeK() const
 
 
 void
-Cell::setCellResetTimeC(bu::quantity<rrs::nanosecond_unit> resetC)
+Cell::setCellResetTimeC(bu::quantity<rrs::second_unit> resetC)
 {
   resetTimeC = resetC;
 }
 
-bu::quantity<rrs::nanosecond_unit> const &
+bu::quantity<rrs::second_unit> const &
 Cell::getCellResetTimeC() const
 {
   return this->resetTimeC;
@@ -601,48 +642,48 @@ Cell::getCellResetTimeK() const
 
 
 void
-Cell::setCellWidth(bu::quantity<rrs::nanometer_unit> width)
+Cell::setCellWidth(bu::quantity<rrs::meter_unit> width)
 {
   cellWidth = width;
 }
 
-bu::quantity<rrs::nanometer_unit> const &
+bu::quantity<rrs::meter_unit> const &
 Cell::getCellWidth() const
 {
   return this->cellWidth;
 }
 
 void
-Cell::setCellHeight(bu::quantity<rrs::nanometer_unit> height)
+Cell::setCellHeight(bu::quantity<rrs::meter_unit> height)
 {
   cellHeight = height;
 }
 
-bu::quantity<rrs::nanometer_unit> const &
+bu::quantity<rrs::meter_unit> const &
 Cell::getCellHeight() const
 {
   return this->cellHeight;
 }
 
 void
-Cell::setCellToCellSpacing(bu::quantity<rrs::nanometer_unit> spacing)
+Cell::setCellToCellSpacing(bu::quantity<rrs::meter_unit> spacing)
 {
   cellToCellSpacing = spacing;
 }
 
-bu::quantity<rrs::nanometer_unit> const &
+bu::quantity<rrs::meter_unit> const &
 Cell::getCellToCellSpacing() const
 {
   return this->cellToCellSpacing;
 }
 
 void
-Cell::setCellThickness(bu::quantity<rrs::nanometer_unit> thickness)
+Cell::setCellThickness(bu::quantity<rrs::meter_unit> thickness)
 {
   cellThickness = thickness;
 }
 
-bu::quantity<rrs::nanometer_unit> const &
+bu::quantity<rrs::meter_unit> const &
 Cell::getCellThickness() const
 {
   return this->cellThickness;
@@ -650,14 +691,14 @@ Cell::getCellThickness() const
 
 
 
-bu::quantity<rrs::nanoampere_unit>
+bu::quantity<rrs::ampere_unit>
 Cell::calcSelCurrent(bu::quantity<rrs::volt_unit> selVoltage)
 {
   if (selDevModel == semiIdeal)
   {
     auto ISel = selDevLeakageCurrent;
     if (selVoltage == 0. * rrs::volts) {
-      return 0. * rrs::nanoamperes;
+      return 0. * rrs::amperes;
     }
     else if (abs(selVoltage) < selDevSnapVoltage) {
       ISel = selDevLeakageCurrent;
@@ -704,15 +745,14 @@ Cell::calcSelCurrent(bu::quantity<rrs::volt_unit> selVoltage)
   }
 }
 
-bu::quantity<rrs::nanoampere_unit>
-Cell::calcCellCurrent(bu::quantity<rrs::volt_unit> cellVoltage,
-                      bu::quantity<rrs::dimensionless> relError)
+bu::quantity<rrs::ampere_unit>
+Cell::calcCellCurrent(bu::quantity<rrs::volt_unit> cellVoltage)
 {
+  COUNT_PERF(cellCurrentEvaluations, 1);
   if ( selDevModel == semiIdeal ) {
     auto absCellVoltage = abs(cellVoltage);
-    bu::quantity<rrs::nanoampere_unit> absCellCurrent;
-    absCellCurrent = absCellVoltage /
-                  SCALE_QUANTITY(memDevInstantResistance, rrs::gigaohm_unit);
+    bu::quantity<rrs::ampere_unit> absCellCurrent;
+    absCellCurrent = absCellVoltage / memDevInstantResistance;
     // Voltage is small enough not to force ILeak through memRes
     if ( absCellCurrent < selDevLeakageCurrent ) {
       if ( cellVoltage > 0 * rrs::volts ) {
@@ -736,7 +776,7 @@ Cell::calcCellCurrent(bu::quantity<rrs::volt_unit> cellVoltage,
 
     // Voltage is larger than the snap voltage
     absCellCurrent = (absCellVoltage - selDevSnapVoltage) /
-                  SCALE_QUANTITY(memDevInstantResistance, rrs::gigaohm_unit);
+                     memDevInstantResistance;
     // Voltage is only slightly higher than the snap voltage
     if ( absCellCurrent < selDevLeakageCurrent ) {
       if ( cellVoltage > 0 * rrs::volts ) {
@@ -772,39 +812,63 @@ Cell::calcCellCurrent(bu::quantity<rrs::volt_unit> cellVoltage,
     exceptionMsgThrown.append("Was unable to calculate cell current ");
     exceptionMsgThrown.append("using semi ideal selector model.");
     throw exceptionMsgThrown;
-    return INVALID_DOUBLE * rrs::nanoamperes;
+    return INVALID_DOUBLE * rrs::amperes;
   }
   else if ( selDevModel == IxV ) {
-    bu::quantity<rrs::volt_unit> memDevVoltage = cellVoltage/2.0;
-    bu::quantity<rrs::volt_unit> selVoltage = cellVoltage/2.0;
-
-    bu::quantity<rrs::nanoampere_unit> memDevCurrent;
-    memDevCurrent = SCALE_QUANTITY(memDevVoltage/memDevInstantResistance,
-                                   rrs::nanoampere_unit);
-
-    bu::quantity<rrs::nanoampere_unit> selCurrent = calcSelCurrent(selVoltage);
-
-    // Voltage resolution starts high (half of VSet)
-    //  and decreases exponetially (binary search)
-    bu::quantity<rrs::volt_unit> voltageResolution = abs(cellVoltage)/2.0;
-    if ( isInvalid(relError) ) {
-      relError = maxCurrentRelativeError;
+    // Memory device and selector share the same current, splitting the
+    //  cell voltage between them. The memory device current falls and the
+    //  selector current rises with the selector voltage, so the first data
+    //  point where the selector takes more current than the memory device
+    //  bounds the selector segment holding the split. On that (linear)
+    //  segment the split is solved exactly.
+    // Raw values - volts and amperes
+    const double absCellVoltage = abs(cellVoltage.value());
+    if ( absCellVoltage == 0. ) {
+      return 0. * rrs::amperes;
+    }
+    const double memDevConductance = 1. / memDevInstantResistance.value();
+
+    const size_t nPoints = selVoltageDataPoints.size();
+    // Only the positive half of the data is used (symmetrical IxV curve)
+    size_t first = 0;
+    while ( first + 1 < nPoints
+            && selVoltageDataPoints[first].value() < 0. ) {
+      ++first;
     }
-    while (!fastAreEqual(memDevCurrent, selCurrent, relError)) {
-      voltageResolution /= 2;
-      if ( memDevCurrent > selCurrent ) {
-        memDevVoltage -= voltageResolution;
-        selVoltage    += voltageResolution;
-      } else {
-        memDevVoltage += voltageResolution;
-        selVoltage    -= voltageResolution;
+    // Binary search on the sign of the current mismatch
+    size_t lo = first;
+    size_t hi = nPoints;
+    while ( lo + 1 < hi ) {
+      const size_t middle = (lo + hi) / 2;
+      const double vSel = selVoltageDataPoints[middle].value();
+      const double iSel = selCurrentDataPoints[middle].value();
+      if ( memDevConductance * (absCellVoltage - vSel) > iSel ) {
+        lo = middle;
+      }
+      else {
+        hi = middle;
       }
-      memDevCurrent = SCALE_QUANTITY(memDevVoltage/memDevInstantResistance,
-                                     rrs::nanoampere_unit);
-      selCurrent = calcSelCurrent(selVoltage);
     }
 
-    return (memDevCurrent + selCurrent) / 2.0;
+    // Selector segment from lo - flat past the last data point
+    const double x0 = selVoltageDataPoints[lo].value();
+    const double y0 = selCurrentDataPoints[lo].value();
+    double selConductance = 0.;
+    if ( hi < nPoints ) {
+      selConductance = (selCurrentDataPoints[hi].value() - y0)
+                       / (selVoltageDataPoints[hi].value() - x0);
+    }
+    //  G_mem (V - V_sel) = y0 + G_sel (V_sel - x0)
+    const double selVoltage =
+        (memDevConductance * absCellVoltage - y0 + selConductance * x0)
+        / (memDevConductance + selConductance);
+    const double cellCurrent =
+        memDevConductance * (absCellVoltage - selVoltage);
+
+    if ( cellVoltage < 0 * rrs::volts ) {
+      return -cellCurrent * rrs::amperes;
+    }
+    return cellCurrent * rrs::amperes;
   }
   else {
     string exceptionMsgThrown("[ERROR] ");
@@ -819,27 +883,41 @@ Cell::calcCellCurrent(bu::quantity<rrs::volt_unit> cellVoltage,
 }
 
 bu::quantity<rrs::volt_unit>
-Cell::calcCellVoltage(bu::quantity<rrs::nanoampere_unit> cellCurrent)
+Cell::calcCellVoltage(bu::quantity<rrs::ampere_unit> cellCurrent)
 {
   bu::quantity<rrs::volt_unit> initVoltage = 5 * rrs::volts;
-  if ( cellCurrent > 0 * rrs::nanoamperes ) {
+  if ( cellCurrent > 0 * rrs::amperes ) {
     initVoltage = initVoltage;
   }
-  else if ( cellCurrent < 0 * rrs::nanoamperes ) {
+  else if ( cellCurrent < 0 * rrs::amperes ) {
     initVoltage = -initVoltage;
   }
   else {
     return 0 * rrs::volts;
   }
 
+  // Clipping selectors never reach currents above their maximum - the
+  //  bracket stops growing at a voltage no cell ever sees
+  const auto maxCellVoltage = 1e3 * rrs::volts;
   while ( abs(calcCellCurrent(initVoltage)) < abs(cellCurrent)  ) {
+    if ( abs(initVoltage) > maxCellVoltage ) {
+      string exceptionMsgThrown("[ERROR] ");
+      exceptionMsgThrown.append("Cell current of ");
+      exceptionMsgThrown.append(to_string(
+          SCALE_QUANTITY(cellCurrent, rrs::nanoampere_unit)));
+      exceptionMsgThrown.append(" is out of reach of the cell - no voltage");
+      exceptionMsgThrown.append(" up to ");
+      exceptionMsgThrown.append(to_string(maxCellVoltage));
+      exceptionMsgThrown.append(" drives it.\n");
+      throw exceptionMsgThrown;
+    }
     initVoltage += initVoltage;
   }
 
 
   bu::quantity<rrs::volt_unit> estCellVoltage;
   estCellVoltage = initVoltage;
-  bu::quantity<rrs::nanoampere_unit> estCellCurrent;
+  bu::quantity<rrs::ampere_unit> estCellCurrent;
   estCellCurrent = calcCellCurrent(estCellVoltage);
 
   bu::quantity<rrs::volt_unit> voltageResolution = abs(estCellVoltage)/2.0;
@@ -863,10 +941,69 @@ Cell::calcCellVoltage(bu::quantity<rrs::nanoampere_unit> cellCurrent)
   return estCellVoltage;
 }
 
+vector<double>
+Cell::cellIxVKey(bu::quantity<rrs::volt_unit> vStep,
+                 bu::quantity<rrs::dimensionless> maxRelError) const
+{
+  vector<double> key = {
+    double(selDevModel),
+    memDevHRSResistance.value(),
+    memDevLRSResistance.value(),
+    vStep.value(),
+    maxRelError.value()
+  };
+  if ( selDevModel == semiIdeal ) {
+    key.push_back(selDevSnapVoltage.value());
+    key.push_back(selDevLeakageCurrent.value());
+    key.push_back(selDevMaxCurrent.value());
+  }
+  else {
+    for ( const auto& vSel : selVoltageDataPoints ) {
+      key.push_back(vSel.value());
+    }
+    for ( const auto& iSel : selCurrentDataPoints ) {
+      key.push_back(iSel.value());
+    }
+  }
+  return key;
+}
+
+size_t
+Cell::getCellIxVCacheSize()
+{
+  lock_guard<mutex> lock(cellIxVCacheMutex);
+  return cellIxVCache.size();
+}
+
+void
+Cell::clearCellIxVCache()
+{
+  lock_guard<mutex> lock(cellIxVCacheMutex);
+  cellIxVCache.clear();
+}
+
 void
 Cell::buildCellIxV(bu::quantity<rrs::volt_unit> vStep,
                    bu::quantity<rrs::dimensionless> maxRelError)
 {
+  // Same selector and resistances give the same tables - reuse them
+  vector<double> key = cellIxVKey(vStep, maxRelError);
+  {
+    lock_guard<mutex> lock(cellIxVCacheMutex);
+    auto cached = cellIxVCache.find(key);
+    if ( cached != cellIxVCache.end() ) {
+      cellVoltageDataPoints = cached->second.cellVoltageDataPoints;
+      cellCurrentDataPoints = cached->second.cellCurrentDataPoints;
+      rawCellVoltageDataPoints = cached->second.rawCellVoltageDataPoints;
+      rawCellCurrentDataPoints = cached->second.rawCellCurrentDataPoints;
+      rawCellGridIndex = cached->second.rawCellGridIndex;
+      COUNT_PERF(cellIxVCacheHits, 1);
+      return;
+    }
+  }
+  TIME_PERF(cellIxVBuildSeconds);
+  TRACE_SCOPE("Cell::buildCellIxV");
+
   // Builds paired vectors of cell voltage and current,
   //  dynamically choosing the voltage step based on the interpolation error.
   // Stops when current reachs the selector maximum current.
@@ -891,18 +1028,18 @@ Cell::buildCellIxV(bu::quantity<rrs::volt_unit> vStep,
     size_t i = 0;
     vCells.at(i) = 0. * rrs::volts;
     auto vCell = vCells.at(i);
-    iCells.at(i) = calcCellCurrent(vCell, 1e-12);
+    iCells.at(i) = calcCellCurrent(vCell);
     ++i;
     vCells.at(i) = vCells.at(i-1) + vStep;
     vCell = vCells.at(i);
-    iCells.at(i) = calcCellCurrent(vCell, 1e-12);
+    iCells.at(i) = calcCellCurrent(vCell);
     ++i;
     vCells.push_back(INVALID_DOUBLE * rrs::volts);
-    iCells.push_back(INVALID_DOUBLE * rrs::nanoamperes);
+    iCells.push_back(INVALID_DOUBLE * rrs::amperes);
     while (iCells.at(i-1) < maxCurrent) {
      vCells.at(i) = vCells.at(i-1) + vStep;
       vCell = vCells.at(i);
-      iCells.at(i) = calcCellCurrent(vCell, 1e-12);
+      iCells.at(i) = calcCellCurrent(vCell);
 
       auto iHat = iCells.at(i-2);
       iHat +=  (vCells.at(i-1) - vCells.at(i-2))
@@ -914,7 +1051,7 @@ Cell::buildCellIxV(bu::quantity<rrs::volt_unit> vStep,
         vStep *= 2;
         ++i;
         vCells.push_back(INVALID_DOUBLE * rrs::volts);
-        iCells.push_back(INVALID_DOUBLE * rrs::nanoamperes);
+        iCells.push_back(INVALID_DOUBLE * rrs::amperes);
       }
       else {
         vStep /= 2;
@@ -929,22 +1066,42 @@ Cell::buildCellIxV(bu::quantity<rrs::volt_unit> vStep,
     cellVoltageDataPoints.at(stateCnt) = vCells;
     cellCurrentDataPoints.at(stateCnt).pop_back();
     cellCurrentDataPoints.at(stateCnt) = iCells;
+    rawCellVoltageDataPoints.at(stateCnt).resize(vCells.size());
+    rawCellCurrentDataPoints.at(stateCnt).resize(iCells.size());
+    for ( size_t j = 0; j < vCells.size(); ++j ) {
+      rawCellVoltageDataPoints.at(stateCnt).at(j) = vCells.at(j).value();
+      rawCellCurrentDataPoints.at(stateCnt).at(j) = iCells.at(j).value();
+    }
     setMemDevResistanceState(true);
     vStep = vStepBkup;
   }
   setMemDevResistanceState(false);
   setMemDevResistanceState(stateBkup);
-}
-
-bu::quantity<rrs::nanoampere_unit>
-Cell::getCellCurrent(bu::quantity<rrs::volt_unit> cellVoltage) {
+  buildRawCellGrid();
+  COUNT_PERF(cellIxVBuilds, 1);
+  COUNT_PERF(cellIxVPoints, cellVoltageDataPoints.at(0).size()
+                            + cellVoltageDataPoints.at(1).size());
+
+  // Tables are built outside the lock - if another cell built the same
+  //  ones meanwhile, they are identical and the first ones are kept
+  lock_guard<mutex> lock(cellIxVCacheMutex);
+  cellIxVCache.emplace(key, CellIxVTables{cellVoltageDataPoints,
+                                          cellCurrentDataPoints,
+                                          rawCellVoltageDataPoints,
+                                          rawCellCurrentDataPoints,
+                                          rawCellGridIndex});
+}
+
+bu::quantity<rrs::ampere_unit>
+Cell::getCellCurrent(bu::quantity<rrs::volt_unit> cellVoltage) const {
   return getCellCurrent(cellVoltage, memDevResistanceState);
 }
 
-bu::quantity<rrs::nanoampere_unit>
+bu::quantity<rrs::ampere_unit>
 Cell::getCellCurrent(bu::quantity<rrs::volt_unit> cellVoltage,
-                     ebool state)
+                     ebool state) const
 {
+  COUNT_PERF(cellCurrentLookups, 1);
   auto firstGreaterIndex =
         findLowestGreater(cellVoltageDataPoints.at(state), abs(cellVoltage));
 
@@ -967,14 +1124,267 @@ Cell::getCellCurrent(bu::quantity<rrs::volt_unit> cellVoltage,
   return iCell;
 }
 
+void
+Cell::buildRawCellGrid()
+{
+  for ( size_t state = 0; state < 2; ++state ) {
+    const vector<double>& vCells = rawCellVoltageDataPoints.at(state);
+    vector<int>& grid = rawCellGridIndex.at(state);
+
+    size_t nBins = size_t(vCells.back() * CELL_IXV_GRID_BINS_PER_VOLT);
+    nBins = min(nBins, size_t(CELL_IXV_GRID_MAX_BINS));
+    // One more bin start, ending the last bin
+    grid.resize(nBins + 1);
+    // Starts one point before the bin, so that a voltage rounded into the
+    //  next bin never starts past its segment
+    size_t firstGreaterIndex = 1;
+    for ( size_t bin = 0; bin <= nBins; ++bin ) {
+      const double binVoltage = bin / CELL_IXV_GRID_BINS_PER_VOLT;
+      while ( firstGreaterIndex < vCells.size()
+              && vCells[firstGreaterIndex] <= binVoltage ) {
+        ++firstGreaterIndex;
+      }
+      grid[bin] = int(max(firstGreaterIndex - 1, size_t(1)));
+    }
+  }
+}
+
+size_t
+Cell::findRawCellSegment(double absCellVoltage) const
+{
+  const vector<double>& vCells =
+      rawCellVoltageDataPoints[memDevResistanceState];
+  const vector<int>& grid = rawCellGridIndex[memDevResistanceState];
+
+  const double binVoltage = absCellVoltage * CELL_IXV_GRID_BINS_PER_VOLT;
+  // Past the grid - plain binary search
+  if ( grid.empty() || !(binVoltage < grid.size() - 1) ) {
+    return upper_bound(vCells.begin(), vCells.end(), absCellVoltage)
+           - vCells.begin();
+  }
+
+  // Searches only the table points within the bin
+  const size_t bin = size_t(binVoltage);
+  const size_t first = grid[bin];
+  const size_t last = min(size_t(grid[bin+1]) + 2, vCells.size());
+  return upper_bound(vCells.begin() + first, vCells.begin() + last,
+                     absCellVoltage) - vCells.begin();
+}
+
+void
+Cell::getRawCellCurrents(const double* cellVoltages, double* cellCurrents,
+                         double* cellConductances, size_t nCells) const
+{
+  COUNT_PERF(rawCellCurrentLookups, nCells);
+  size_t cell = 0;
+
+#ifdef __AVX2__
+  const vector<double>& vCells =
+      rawCellVoltageDataPoints[memDevResistanceState];
+  const vector<double>& iCells =
+      rawCellCurrentDataPoints[memDevResistanceState];
+  const vector<int>& grid = rawCellGridIndex[memDevResistanceState];
+
+  const __m256d signMask = _mm256_set1_pd(-0.);
+  const __m256d binsPerVolt = _mm256_set1_pd(CELL_IXV_GRID_BINS_PER_VOLT);
+  const __m256d nBins =
+      _mm256_set1_pd(grid.empty() ? 0. : double(grid.size() - 1));
+  const __m128i lastIndex = _mm_set1_epi32(int(vCells.size()) - 1);
+  const __m128i one = _mm_set1_epi32(1);
+  // Low halves of the 64 bits lanes, to narrow compare masks to 32 bits
+  const __m256i lowHalves = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+
+  for ( ; cell + 4 <= nCells; cell += 4 ) {
+    const __m256d vCell = _mm256_loadu_pd(cellVoltages + cell);
+    const __m256d absVCell = _mm256_andnot_pd(signMask, vCell);
+    const __m256d binVoltage = _mm256_mul_pd(absVCell, binsPerVolt);
+
+    // Any voltage past the grid - these 4 cells go the scalar way
+    if ( _mm256_movemask_pd(_mm256_cmp_pd(binVoltage, nBins, _CMP_LT_OQ))
+         != 0xF ) {
+      for ( size_t lane = cell; lane < cell + 4; ++lane ) {
+        size_t firstGreaterIndex =
+            findRawCellSegment(abs(cellVoltages[lane]));
+        if ( cellConductances ) {
+          cellCurrents[lane] = interpolateRawCellCurrent(
+                cellVoltages[lane], firstGreaterIndex, cellConductances[lane]);
+        }
+        else {
+          cellCurrents[lane] = interpolateRawCellCurrent(
+                cellVoltages[lane], firstGreaterIndex);
+        }
+      }
+      continue;
+    }
+
+    // Scan from the bin start to the first greater table voltage
+    __m128i index = _mm_i32gather_epi32(grid.data(),
+                                        _mm256_cvttpd_epi32(binVoltage), 4);
+    while ( true ) {
+      const __m128i inTable = _mm_cmpgt_epi32(_mm_add_epi32(lastIndex, one),
+                                              index);
+      const __m256d x = gatherDoubles(vCells.data(),
+                                      _mm_min_epi32(index, lastIndex));
+      const __m256i notGreater = _mm256_permutevar8x32_epi32(
+            _mm256_castpd_si256(_mm256_cmp_pd(x, absVCell, _CMP_LE_OQ)),
+            lowHalves);
+      const __m128i advance = _mm_and_si128(
+            _mm256_castsi256_si128(notGreater), inTable);
+      if ( _mm_testz_si128(advance, advance) ) {
+        break;
+      }
+      index = _mm_sub_epi32(index, advance);
+    }
+
+    // Linear interpolation between two (V,I) pairs - past the last data
+    //  point the current is flat
+    const __m128i pastTable = _mm_cmpgt_epi32(index, lastIndex);
+    const __m128i upper = _mm_min_epi32(index, lastIndex);
+    const __m128i lower = _mm_sub_epi32(upper, one);
+    const __m256d x0 = gatherDoubles(vCells.data(), lower);
+    const __m256d x1 = gatherDoubles(vCells.data(), upper);
+    const __m256d y0 = gatherDoubles(iCells.data(), lower);
+    const __m256d y1 = gatherDoubles(iCells.data(), upper);
+    const __m256d flat = _mm256_castsi256_pd(
+          _mm256_cvtepi32_epi64(pastTable));
+
+    __m256d iCell;
+    if ( cellConductances ) {
+      __m256d gCell = _mm256_div_pd(_mm256_sub_pd(y1, y0),
+                                    _mm256_sub_pd(x1, x0));
+      iCell = _mm256_add_pd(
+            _mm256_mul_pd(_mm256_sub_pd(absVCell, x0), gCell), y0);
+      gCell = _mm256_andnot_pd(flat, gCell);
+      _mm256_storeu_pd(cellConductances + cell, gCell);
+    }
+    else {
+      iCell = _mm256_add_pd(
+            _mm256_div_pd(_mm256_mul_pd(_mm256_sub_pd(absVCell, x0),
+                                        _mm256_sub_pd(y1, y0)),
+                          _mm256_sub_pd(x1, x0)),
+            y0);
+    }
+    iCell = _mm256_blendv_pd(iCell, y1, flat);
+
+    // Assume symmetrical IxV curve
+    const __m256d negative = _mm256_cmp_pd(vCell, _mm256_setzero_pd(),
+                                           _CMP_LT_OQ);
+    iCell = _mm256_xor_pd(iCell, _mm256_and_pd(negative, signMask));
+    _mm256_storeu_pd(cellCurrents + cell, iCell);
+  }
+#endif
+
+  // Cells are independent here, so the grid lookup pays off
+  for ( ; cell < nCells; ++cell ) {
+    size_t firstGreaterIndex = findRawCellSegment(abs(cellVoltages[cell]));
+    if ( cellConductances ) {
+      cellCurrents[cell] = interpolateRawCellCurrent(
+            cellVoltages[cell], firstGreaterIndex, cellConductances[cell]);
+    }
+    else {
+      cellCurrents[cell] = interpolateRawCellCurrent(
+            cellVoltages[cell], firstGreaterIndex);
+    }
+  }
+}
+
+double
+Cell::interpolateRawCellCurrent(double cellVoltage,
+                                size_t firstGreaterIndex) const
+{
+  const vector<double>& vCells =
+      rawCellVoltageDataPoints[memDevResistanceState];
+  const vector<double>& iCells =
+      rawCellCurrentDataPoints[memDevResistanceState];
+  const double absCellVoltage = abs(cellVoltage);
+
+  // If cellVoltage >= max(vCells), get highest current
+  double iCell = iCells[firstGreaterIndex - 1];
+
+  // Linear interpolation between two (V,I) pairs
+  if ( firstGreaterIndex < vCells.size() ) {
+    const double x0 = vCells[firstGreaterIndex - 1];
+    const double x1 = vCells[firstGreaterIndex];
+    const double y0 = iCells[firstGreaterIndex - 1];
+    const double y1 = iCells[firstGreaterIndex];
+
+    iCell = (absCellVoltage - x0) * (y1 - y0) / (x1 - x0) + y0;
+  }
+  // Assume symmetrical IxV curve
+  if ( cellVoltage < 0. ) {
+    return -iCell;
+  }
+  return iCell;
+}
+
+double
+Cell::interpolateRawCellCurrent(double cellVoltage, size_t firstGreaterIndex,
+                                double& cellConductance) const
+{
+  const vector<double>& vCells =
+      rawCellVoltageDataPoints[memDevResistanceState];
+  const vector<double>& iCells =
+      rawCellCurrentDataPoints[memDevResistanceState];
+  const double absCellVoltage = abs(cellVoltage);
+
+  // Beyond the last data point the current is flat
+  double iCell = iCells[firstGreaterIndex - 1];
+  cellConductance = 0.;
+
+  if ( firstGreaterIndex < vCells.size() ) {
+    const double x0 = vCells[firstGreaterIndex - 1];
+    const double x1 = vCells[firstGreaterIndex];
+    const double y0 = iCells[firstGreaterIndex - 1];
+    const double y1 = iCells[firstGreaterIndex];
+
+    cellConductance = (y1 - y0) / (x1 - x0);
+    iCell = (absCellVoltage - x0) * cellConductance + y0;
+  }
+  // Symmetrical IxV curve - the slope is the same on both sides
+  if ( cellVoltage < 0. ) {
+    return -iCell;
+  }
+  return iCell;
+}
+
+// Single evaluations keep the binary search. In the solver sweeps each
+//  cell voltage follows from the previous cell current, and the search
+//  branches are predicted across neighbouring cells - a grid lookup would
+//  only lengthen that chain with dependent loads.
+double
+Cell::getRawCellCurrent(double cellVoltage) const
+{
+  COUNT_PERF(rawCellCurrentLookups, 1);
+  const vector<double>& vCells =
+      rawCellVoltageDataPoints[memDevResistanceState];
+
+  // Same search as findLowestGreater, without recursion or bounds checks
+  size_t firstGreaterIndex = upper_bound(vCells.begin(), vCells.end(),
+                                         abs(cellVoltage)) - vCells.begin();
+  return interpolateRawCellCurrent(cellVoltage, firstGreaterIndex);
+}
+
+double
+Cell::getRawCellCurrent(double cellVoltage, double& cellConductance) const
+{
+  COUNT_PERF(rawCellCurrentLookups, 1);
+  const vector<double>& vCells =
+      rawCellVoltageDataPoints[memDevResistanceState];
+
+  size_t firstGreaterIndex = upper_bound(vCells.begin(), vCells.end(),
+                                         abs(cellVoltage)) - vCells.begin();
+  return interpolateRawCellCurrent(cellVoltage, firstGreaterIndex,
+                                   cellConductance);
+}
+
 bu::quantity<rrs::volt_unit>
-Cell::getCellVoltage(bu::quantity<rrs::nanoampere_unit> cellCurrent)
+Cell::getCellVoltage(bu::quantity<rrs::ampere_unit> cellCurrent)
 {
   return getCellVoltage(cellCurrent, memDevResistanceState);
 }
 
 bu::quantity<rrs::volt_unit>
-Cell::getCellVoltage(bu::quantity<rrs::nanoampere_unit> cellCurrent,
+Cell::getCellVoltage(bu::quantity<rrs::ampere_unit> cellCurrent,
                      ebool state)
 {
   auto firstGreaterIndex =
@@ -985,9 +1395,12 @@ Cell::getCellVoltage(bu::quantity<rrs::nanoampere_unit> cellCurrent,
     string exceptionMsgThrown("[ERROR] ");
     exceptionMsgThrown.append("Tried to assess the voltage in the cell ");
     exceptionMsgThrown.append("for a current (");
-    exceptionMsgThrown.append(to_string(cellCurrent));
+    exceptionMsgThrown.append(to_string(
+        SCALE_QUANTITY(cellCurrent, rrs::nanoampere_unit)));
     exceptionMsgThrown.append(") greater than the maximum cell current (");
-  exceptionMsgThrown.append(to_string(cellCurrentDataPoints.at(state).back()));
+    exceptionMsgThrown.append(to_string(
+        SCALE_QUANTITY(cellCurrentDataPoints.at(state).back(),
+                       rrs::nanoampere_unit)));
     exceptionMsgThrown.append(").");
     throw exceptionMsgThrown;
   }
@@ -1000,17 +1413,17 @@ Cell::getCellVoltage(bu::quantity<rrs::nanoampere_unit> cellCurrent,
 
   auto vCell = (abs(cellCurrent) - x0) * (y1 - y0) / (x1 - x0) + y0;
   // Assume symmetrical IxV curve
-  if(cellCurrent < 0 * rrs::nanoamperes) {
+  if(cellCurrent < 0 * rrs::amperes) {
     return -vCell;
   }
   return vCell;
 }
 
 void
-Cell::buildFromCellFile(const char* cellFileName)
+Cell::buildFromCellFile(const char* cellFileName, const string& cellJSON)
 {
   try {
-    JsonAssist jsonAssist(cellFileName);
+    JsonAssist jsonAssist(cellFileName, cellJSON);
 
     double magnitude = INVALID_DOUBLE;
     string auxStr = INVALID_STRING;
@@ -1037,11 +1450,13 @@ Cell::buildFromCellFile(const char* cellFileName)
 
       magnitude = jsonAssist.getJSONNumber("Selector leakage current [nA]",
                                             mandatory);
-      setSelDevLeakageCurrent(magnitude * rrs::nanoamperes);
+      setSelDevLeakageCurrent(SCALE_QUANTITY(magnitude * rrs::nanoamperes,
+                                             rrs::ampere_unit));
 
       magnitude = jsonAssist.getJSONNumber("Selector maximum current [nA]",
                                             mandatory);
-      setSelDevMaxCurrent(magnitude * rrs::nanoamperes);
+      setSelDevMaxCurrent(SCALE_QUANTITY(magnitude * rrs::nanoamperes,
+                                         rrs::ampere_unit));
     }
     else if ( selDevModel == IxV ) {
       // Mandatory: at least one data points pair
@@ -1053,7 +1468,8 @@ Cell::buildFromCellFile(const char* cellFileName)
       double currentMag;
       currentMag = jsonAssist.getJSONNumber("Selector current point 0 [nA]",
                                             mandatory);
-      setSelCurrentDataPoint(currentMag * rrs::nanoamperes);
+      setSelCurrentDataPoint(SCALE_QUANTITY(currentMag * rrs::nanoamperes,
+                                            rrs::ampere_unit));
 
       // Searchs in order until there is no member in json file
       size_t cnt = 1;
@@ -1073,7 +1489,8 @@ Cell::buildFromCellFile(const char* cellFileName)
         currentMag = jsonAssist.getJSONNumber(auxStr.c_str(),
                                               optional);
         if ( isValid( currentMag ) ) {
-          setSelCurrentDataPoint(currentMag * rrs::nanoamperes);
+          setSelCurrentDataPoint(SCALE_QUANTITY(currentMag * rrs::nanoamperes,
+                                                rrs::ampere_unit));
         }
 
         cnt++;
@@ -1098,7 +1515,8 @@ Cell::buildFromCellFile(const char* cellFileName)
     // Write & read
     magnitude = jsonAssist.getJSONNumber("Cell set time C [ns]",
                                          optional);
-    setCellSetTimeC(magnitude * rrs::nanoseconds );
+    setCellSetTimeC(SCALE_QUANTITY(magnitude * rrs::nanoseconds,
+                                   rrs::second_unit));
 
     magnitude = jsonAssist.getJSONNumber("Cell set time K [V^-1]",
                                          optional);
@@ -1106,7 +1524,8 @@ Cell::buildFromCellFile(const char* cellFileName)
 
     magnitude = jsonAssist.getJSONNumber("Cell set time [ns]",
                                          optional);
-    setCellSetTime(magnitude * rrs::nanoseconds );
+    setCellSetTime(SCALE_QUANTITY(magnitude * rrs::nanoseconds,
+                                  rrs::second_unit));
 
     if ( isInvalid(setTime) && !areValid(setTimeC, setTimeK) ) {
       string exceptionMsgThrown("[ERROR] ");
@@ -1123,11 +1542,13 @@ Cell::buildFromCellFile(const char* cellFileName)
 
     magnitude = jsonAssist.getJSONNumber("Cell set compliance current [nA]",
                                          mandatory);
-    setCellSetComplianceCurrent(magnitude * rrs::nanoamperes );
+    setCellSetComplianceCurrent(SCALE_QUANTITY(magnitude * rrs::nanoamperes,
+                                               rrs::ampere_unit));
 
     magnitude = jsonAssist.getJSONNumber("Cell set current [nA]",
                                          optional);
-    setCellSetCurrent(magnitude * rrs::nanoamperes );
+    setCellSetCurrent(SCALE_QUANTITY(magnitude * rrs::nanoamperes,
+                                     rrs::ampere_unit));
 
     magnitude = jsonAssist.getJSONNumber("Cell set voltage [V]",
                                          optional);
@@ -1136,7 +1557,8 @@ Cell::buildFromCellFile(const char* cellFileName)
 
     magnitude = jsonAssist.getJSONNumber("Cell reset time C [ns]",
                                          optional);
-    setCellResetTimeC(magnitude * rrs::nanoseconds );
+    setCellResetTimeC(SCALE_QUANTITY(magnitude * rrs::nanoseconds,
+                                     rrs::second_unit));
 
     magnitude = jsonAssist.getJSONNumber("Cell reset time K [V^-1]",
                                          optional);
@@ -1144,7 +1566,8 @@ Cell::buildFromCellFile(const char* cellFileName)
 
     magnitude = jsonAssist.getJSONNumber("Cell reset time [ns]",
                                          optional);
-    setCellResetTime(magnitude * rrs::nanoseconds );
+    setCellResetTime(SCALE_QUANTITY(magnitude * rrs::nanoseconds,
+                                    rrs::second_unit));
 
     if ( isInvalid(resetTime) && !areValid(resetTimeC, resetTimeK) ) {
       string exceptionMsgThrown("[ERROR] ");
@@ -1161,7 +1584,8 @@ Cell::buildFromCellFile(const char* cellFileName)
 
     magnitude = jsonAssist.getJSONNumber("Cell reset current [nA]",
                                          optional);
-    setCellResetCurrent(magnitude * rrs::nanoamperes );
+    setCellResetCurrent(SCALE_QUANTITY(magnitude * rrs::nanoamperes,
+                                       rrs::ampere_unit));
 
     magnitude = jsonAssist.getJSONNumber("Cell reset voltage [V]",
                                          optional);
@@ -1174,7 +1598,8 @@ Cell::buildFromCellFile(const char* cellFileName)
 
     magnitude = jsonAssist.getJSONNumber("Cell read current [nA]",
                                          optional);
-    setCellReadCurrent(magnitude * rrs::nanoamperes );
+    setCellReadCurrent(SCALE_QUANTITY(magnitude * rrs::nanoamperes,
+                                      rrs::ampere_unit));
 
     magnitude = jsonAssist.getJSONNumber("LRS/HRS read current ratio []",
                                          optional);
@@ -1196,19 +1621,22 @@ Cell::buildFromCellFile(const char* cellFileName)
     // Mechanical dimensions
     magnitude = jsonAssist.getJSONNumber("Cell width [nm]",
                                          optional);
-    setCellWidth(magnitude * rrs::nanometers );
+    setCellWidth(SCALE_QUANTITY(magnitude * rrs::nanometers, rrs::meter_unit));
 
     magnitude = jsonAssist.getJSONNumber("Cell height [nm]",
                                          optional);
-    setCellHeight(magnitude * rrs::nanometers );
+    setCellHeight(SCALE_QUANTITY(magnitude * rrs::nanometers,
+                                 rrs::meter_unit));
 
     magnitude = jsonAssist.getJSONNumber("Cell to cell spacing [nm]",
                                          optional);
-    setCellHeight(magnitude * rrs::nanometers );
+    setCellHeight(SCALE_QUANTITY(magnitude * rrs::nanometers,
+                                 rrs::meter_unit));
 
     magnitude = jsonAssist.getJSONNumber("Cell thickness [nm]",
                                          optional);
-    setCellThickness(magnitude * rrs::nanometers );
+    setCellThickness(SCALE_QUANTITY(magnitude * rrs::nanometers,
+                                    rrs::meter_unit));
 
   } catch(string exceptionMsgThrown) {
     throw exceptionMsgThrown;
@@ -1221,12 +1649,12 @@ Cell::Cell()
   initialize();
 }
 
-Cell::Cell(const char* cellFileName)
+Cell::Cell(const char* cellFileName, const string& cellJSON)
 {
   initialize();
 
   try {
-    buildFromCellFile(cellFileName);
+    buildFromCellFile(cellFileName, cellJSON);
 
   } catch(string exceptionMsgThrown) {
     throw exceptionMsgThrown;
@@ -1234,6 +1662,30 @@ Cell::Cell(const char* cellFileName)
 
 }
 
+Cell
+Cell::fromCellFile(const char* cellFileName, const string& cellJSON)
+{
+  if ( !cellJSON.empty() ) {
+    return Cell(cellFileName, cellJSON);
+  }
+
+  string stamp = fileStamp(cellFileName);
+  {
+    lock_guard<mutex> lock(parsedCellsMutex);
+    auto parsed = parsedCells.find(cellFileName);
+    if ( parsed != parsedCells.end() && !stamp.empty()
+         && parsed->second.first == stamp ) {
+      return parsed->second.second;
+    }
+  }
+
+  Cell cell(cellFileName);
+
+  lock_guard<mutex> lock(parsedCellsMutex);
+  parsedCells[cellFileName] = make_pair(stamp, cell);
+  return cell;
+}
+
 Cell::~Cell()
 {
 
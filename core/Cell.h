@@ -37,6 +37,9 @@
 #ifndef CELL_H
 #define CELL_H
 
+#include <map>
+#include <mutex>
+
 #include "../utils/constants.h"
 #include "../utils/functions.h"
 
@@ -65,54 +68,84 @@ private:
 
   // Selector device parameters - Semi-ideal model
   bu::quantity<rrs::volt_unit> selDevSnapVoltage;
-  bu::quantity<rrs::nanoampere_unit> selDevLeakageCurrent;
-  bu::quantity<rrs::nanoampere_unit> selDevMaxCurrent;
+  bu::quantity<rrs::ampere_unit> selDevLeakageCurrent;
+  bu::quantity<rrs::ampere_unit> selDevMaxCurrent;
 
   // Selector device parameters - IxV curve model
   vector<bu::quantity<rrs::volt_unit>> selVoltageDataPoints;
-  vector<bu::quantity<rrs::nanoampere_unit>> selCurrentDataPoints;
+  vector<bu::quantity<rrs::ampere_unit>> selCurrentDataPoints;
 
   // Precision parameters
   bu::quantity<rrs::dimensionless> maxCurrentRelativeError;
 
   // Cell electrical parameters
   vector<vector<bu::quantity<rrs::volt_unit>>> cellVoltageDataPoints;
-  vector<vector<bu::quantity<rrs::nanoampere_unit>>> cellCurrentDataPoints;
+  vector<vector<bu::quantity<rrs::ampere_unit>>> cellCurrentDataPoints;
+  // Raw copies of the tables above, in volts and amperes,
+  //  used by the array solver inner loops
+  vector<vector<double>> rawCellVoltageDataPoints;
+  vector<vector<double>> rawCellCurrentDataPoints;
+  // Uniform voltage grid over the raw tables, so that the table segment
+  //  holding a cell voltage is found by indexing instead of searching
+  //  Each bin keeps the raw table index to start scanning from
+  vector<vector<int>> rawCellGridIndex;
+
+  void buildRawCellGrid();
+  // Index of the first raw table voltage greater than absCellVoltage [V]
+  size_t findRawCellSegment(double absCellVoltage) const;
+  // Raw table current [A] (and slope [A/V]) at cellVoltage [V], on the
+  //  segment ending at firstGreaterIndex
+  double interpolateRawCellCurrent(double cellVoltage,
+                                   size_t firstGreaterIndex) const;
+  double interpolateRawCellCurrent(double cellVoltage,
+                                   size_t firstGreaterIndex,
+                                   double& cellConductance) const;
+
+  // Parameters shaping the cell I-V tables, to find them in the cache
+  vector<double> cellIxVKey(bu::quantity<rrs::volt_unit> vStep,
+                            bu::quantity<rrs::dimensionless> maxRelError) const;
 
   bu::quantity<rrs::volt_unit> setVoltage;
-  bu::quantity<rrs::nanoampere_unit> setCurrent;
-  bu::quantity<rrs::nanoampere_unit> setComplianceCurrent;
+  bu::quantity<rrs::ampere_unit> setCurrent;
+  bu::quantity<rrs::ampere_unit> setComplianceCurrent;
   bu::quantity<rrs::volt_unit> resetVoltage;
-  bu::quantity<rrs::nanoampere_unit> resetCurrent;
+  bu::quantity<rrs::ampere_unit> resetCurrent;
   bu::quantity<rrs::volt_unit> readVoltage;
-  bu::quantity<rrs::nanoampere_unit> readCurrent;
+  bu::quantity<rrs::ampere_unit> readCurrent;
   bu::quantity<rrs::dimensionless> readCurrentRatio;
 
   // Cell timing parameters
-  bu::quantity<rrs::nanosecond_unit> setTime;
-  bu::quantity<rrs::nanosecond_unit> resetTime;
-  bu::quantity<rrs::nanosecond_unit> setTimeC;
+  bu::quantity<rrs::second_unit> setTime;
+  bu::quantity<rrs::second_unit> resetTime;
+  bu::quantity<rrs::second_unit> setTimeC;
   bu::quantity<rrs::per_volt_unit> setTimeK;
-  bu::quantity<rrs::nanosecond_unit> resetTimeC;
+  bu::quantity<rrs::second_unit> resetTimeC;
   bu::quantity<rrs::per_volt_unit> resetTimeK;
 
   // Cell mechanical parameters
   //  Width - in the wordlines (rows) direction
-  bu::quantity<rrs::nanometer_unit> cellWidth;
+  bu::quantity<rrs::meter_unit> cellWidth;
   //  Height - in the bitlines (columns) direction
-  bu::quantity<rrs::nanometer_unit> cellHeight;
+  bu::quantity<rrs::meter_unit> cellHeight;
   //  Spacing in between cells
-  bu::quantity<rrs::nanometer_unit> cellToCellSpacing;
+  bu::quantity<rrs::meter_unit> cellToCellSpacing;
   //  Thickness - in the die thickness direction
-  bu::quantity<rrs::nanometer_unit> cellThickness;
+  bu::quantity<rrs::meter_unit> cellThickness;
 
 public:
   Cell();
-  Cell(const char* cellFileName);
+  // Cell described by cellJSON, or by the file when the text is empty
+  Cell(const char* cellFileName, const string& cellJSON = "");
   ~Cell();
+  // Cell built from the file - a copy of the last one built from it while
+  //  the file is unchanged, so each file is parsed once per process. A
+  //  description given in cellJSON is parsed each time instead
+  static Cell fromCellFile(const char* cellFileName,
+                           const string& cellJSON = "");
 
   void initialize();
-  void buildFromCellFile(const char* cellFileName);
+  void buildFromCellFile(const char* cellFileName,
+                         const string& cellJSON = "");
 
   // Set/Get memory device maximum resistance (High Resistance State)
   void setMemDevHRSResistance(bu::quantity<rrs::ohm_unit>);
@@ -136,11 +169,11 @@ public:
   void setSelDevSnapVoltage(bu::quantity<rrs::volt_unit>);
   bu::quantity<rrs::volt_unit> const &getSelDevSnapVoltage() const;
   // Selector device leakage current (ISel @ VSel < VSnap)
-  void setSelDevLeakageCurrent(bu::quantity<rrs::nanoampere_unit>);
-  bu::quantity<rrs::nanoampere_unit> const &getSelDevLeakageCurrent() const;
+  void setSelDevLeakageCurrent(bu::quantity<rrs::ampere_unit>);
+  bu::quantity<rrs::ampere_unit> const &getSelDevLeakageCurrent() const;
   // Maximum selector device current (max ISel @ VSel >= VSnap)
-  void setSelDevMaxCurrent(bu::quantity<rrs::nanoampere_unit>);
-  bu::quantity<rrs::nanoampere_unit> const &getSelDevMaxCurrent() const;
+  void setSelDevMaxCurrent(bu::quantity<rrs::ampere_unit>);
+  bu::quantity<rrs::ampere_unit> const &getSelDevMaxCurrent() const;
 
   // Selector device model based on I x V curve data points
   //  For a voltage drop of selVoltageDataPoints.at(i) at the selector
@@ -152,8 +185,8 @@ public:
   //    some kind of interplolation might be used.
   void setSelVoltageDataPoint(bu::quantity<rrs::volt_unit>);
   vector<bu::quantity<rrs::volt_unit>> const &getSelVoltageDataPoints() const;
-  void setSelCurrentDataPoint(bu::quantity<rrs::nanoampere_unit>);
-  vector<bu::quantity<rrs::nanoampere_unit>>
+  void setSelCurrentDataPoint(bu::quantity<rrs::ampere_unit>);
+  vector<bu::quantity<rrs::ampere_unit>>
                                        const &getSelCurrentDataPoints() const;
 
 
@@ -166,90 +199,104 @@ public:
   void setCellSetVoltage(bu::quantity<rrs::volt_unit>,
                          settingOptions opt = normal_opt);
   bu::quantity<rrs::volt_unit> const &getCellSetVoltage() const;
-  void setCellSetCurrent(bu::quantity<rrs::nanoampere_unit>,
+  void setCellSetCurrent(bu::quantity<rrs::ampere_unit>,
                          settingOptions opt = normal_opt);
-  bu::quantity<rrs::nanoampere_unit> const &getCellSetCurrent() const;
-  void setCellSetComplianceCurrent(bu::quantity<rrs::nanoampere_unit>);
-  bu::quantity<rrs::nanoampere_unit> const &getCellSetComplianceCurrent() const;
+  bu::quantity<rrs::ampere_unit> const &getCellSetCurrent() const;
+  void setCellSetComplianceCurrent(bu::quantity<rrs::ampere_unit>);
+  bu::quantity<rrs::ampere_unit> const &getCellSetComplianceCurrent() const;
 
   void setCellResetVoltage(bu::quantity<rrs::volt_unit>,
                            settingOptions opt = normal_opt);
   bu::quantity<rrs::volt_unit> const &getCellResetVoltage() const;
-  void setCellResetCurrent(bu::quantity<rrs::nanoampere_unit>,
+  void setCellResetCurrent(bu::quantity<rrs::ampere_unit>,
                            settingOptions opt = normal_opt);
-  bu::quantity<rrs::nanoampere_unit> const &getCellResetCurrent() const;
+  bu::quantity<rrs::ampere_unit> const &getCellResetCurrent() const;
 
   void setCellReadVoltage(bu::quantity<rrs::volt_unit>,
                           settingOptions opt = normal_opt);
   bu::quantity<rrs::volt_unit> const &getCellReadVoltage() const;
-  void setCellReadCurrent(bu::quantity<rrs::nanoampere_unit>,
+  void setCellReadCurrent(bu::quantity<rrs::ampere_unit>,
                           settingOptions opt = normal_opt);
-  bu::quantity<rrs::nanoampere_unit> const &getCellReadCurrent() const;
+  bu::quantity<rrs::ampere_unit> const &getCellReadCurrent() const;
   void setCellReadCurrentRatio(bu::quantity<rrs::dimensionless>,
                                settingOptions opt = normal_opt);
   bu::quantity<rrs::dimensionless> const &getCellReadCurrentRatio() const;
 
   //Set/Get set/reset time
-  void setCellSetTime(bu::quantity<rrs::nanosecond_unit>);
+  void setCellSetTime(bu::quantity<rrs::second_unit>);
   void setCellSetTime(bu::quantity<rrs::volt_unit>);
-  bu::quantity<rrs::nanosecond_unit> const &getCellSetTime() const;
-  void setCellResetTime(bu::quantity<rrs::nanosecond_unit>);
+  bu::quantity<rrs::second_unit> const &getCellSetTime() const;
+  void setCellResetTime(bu::quantity<rrs::second_unit>);
   void setCellResetTime(bu::quantity<rrs::volt_unit>);
-  bu::quantity<rrs::nanosecond_unit> const &getCellResetTime() const;
+  bu::quantity<rrs::second_unit> const &getCellResetTime() const;
 
   //Set/Get set/reset time scaling factors
-  void setCellSetTimeC(bu::quantity<rrs::nanosecond_unit>);
-  bu::quantity<rrs::nanosecond_unit> const &getCellSetTimeC() const;
+  void setCellSetTimeC(bu::quantity<rrs::second_unit>);
+  bu::quantity<rrs::second_unit> const &getCellSetTimeC() const;
   void setCellSetTimeK(bu::quantity<rrs::per_volt_unit>);
   bu::quantity<rrs::per_volt_unit> const &getCellSetTimeK() const;
 
-  void setCellResetTimeC(bu::quantity<rrs::nanosecond_unit>);
-  bu::quantity<rrs::nanosecond_unit> const &getCellResetTimeC() const;
+  void setCellResetTimeC(bu::quantity<rrs::second_unit>);
+  bu::quantity<rrs::second_unit> const &getCellResetTimeC() const;
   void setCellResetTimeK(bu::quantity<rrs::per_volt_unit>);
   bu::quantity<rrs::per_volt_unit> const &getCellResetTimeK() const;
 
 
   //Set/Get cell mechanical parameters
-  void setCellWidth(bu::quantity<rrs::nanometer_unit>);
-  bu::quantity<rrs::nanometer_unit> const &getCellWidth() const;
+  void setCellWidth(bu::quantity<rrs::meter_unit>);
+  bu::quantity<rrs::meter_unit> const &getCellWidth() const;
 
-  void setCellHeight(bu::quantity<rrs::nanometer_unit>);
-  bu::quantity<rrs::nanometer_unit> const &getCellHeight() const;
+  void setCellHeight(bu::quantity<rrs::meter_unit>);
+  bu::quantity<rrs::meter_unit> const &getCellHeight() const;
 
-  void setCellToCellSpacing(bu::quantity<rrs::nanometer_unit>);
-  bu::quantity<rrs::nanometer_unit> const &getCellToCellSpacing() const;
+  void setCellToCellSpacing(bu::quantity<rrs::meter_unit>);
+  bu::quantity<rrs::meter_unit> const &getCellToCellSpacing() const;
 
-  void setCellThickness(bu::quantity<rrs::nanometer_unit>);
-  bu::quantity<rrs::nanometer_unit> const &getCellThickness() const;
+  void setCellThickness(bu::quantity<rrs::meter_unit>);
+  bu::quantity<rrs::meter_unit> const &getCellThickness() const;
 
 
   // Calculates current through selector device given applied voltage
   // Made public simply to enable testing - NOT TO USE ELSEWHERE!
-  bu::quantity<rrs::nanoampere_unit> calcSelCurrent(
+  bu::quantity<rrs::ampere_unit> calcSelCurrent(
       bu::quantity<rrs::volt_unit>);
 
   // Calculates current through cell (memory + selector devices)
-  //  given applied voltage
-  bu::quantity<rrs::nanoampere_unit> calcCellCurrent(
-      bu::quantity<rrs::volt_unit>,
-      bu::quantity<rrs::dimensionless> relError = INVALID_DOUBLE);
+  //  given applied voltage - exact for both selector models
+  bu::quantity<rrs::ampere_unit> calcCellCurrent(
+      bu::quantity<rrs::volt_unit>);
 
   // Calculates voltage across cell given current flow
   // Made public simply to enable testing - NOT TO USE ELSEWHERE!
   bu::quantity<rrs::volt_unit> calcCellVoltage(
-      bu::quantity<rrs::nanoampere_unit>);
+      bu::quantity<rrs::ampere_unit>);
 
   void buildCellIxV(bu::quantity<rrs::volt_unit> vStep = 1e-6 * rrs::volts,
                     bu::quantity<rrs::dimensionless> maxRelError = 1e-3);
-  bu::quantity<rrs::nanoampere_unit> getCellCurrent(
-      bu::quantity<rrs::volt_unit> cellVoltage);
-  bu::quantity<rrs::nanoampere_unit> getCellCurrent(
+  // Cell I-V tables built by any cell are kept for the whole process, so
+  //  cells with the same selector and memory device resistances (as the
+  //  half selected cells of every array size and operation) reuse them
+  static size_t getCellIxVCacheSize();
+  static void clearCellIxVCache();
+  bu::quantity<rrs::ampere_unit> getCellCurrent(
+      bu::quantity<rrs::volt_unit> cellVoltage) const;
+  bu::quantity<rrs::ampere_unit> getCellCurrent(
       bu::quantity<rrs::volt_unit> cellVoltage,
-      ebool state);
+      ebool state) const;
+  // Same as getCellCurrent, but on raw values (volts in, amperes out)
+  //  for the array solver inner loops, where units are handled outside
+  double getRawCellCurrent(double cellVoltage) const;
+  // Also returns the I-V curve slope (dI/dV) [A/V] at cellVoltage
+  double getRawCellCurrent(double cellVoltage, double& cellConductance) const;
+  // Same as getRawCellCurrent over nCells voltages at once - cellCurrents
+  //  may be the same array as cellVoltages and cellConductances may be null
+  //  Vectorized (AVX2) when built for it
+  void getRawCellCurrents(const double* cellVoltages, double* cellCurrents,
+                          double* cellConductances, size_t nCells) const;
   bu::quantity<rrs::volt_unit> getCellVoltage(
-      bu::quantity<rrs::nanoampere_unit> cellCurrent);
+      bu::quantity<rrs::ampere_unit> cellCurrent);
   bu::quantity<rrs::volt_unit> getCellVoltage(
-      bu::quantity<rrs::nanoampere_unit> cellCurrent,
+      bu::quantity<rrs::ampere_unit> cellCurrent,
       ebool state);
 
 
@@ -0,0 +1,1531 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+
+#include "LineSolver.h"
+
+using namespace std;
+
+void
+LineSolver::checkSetup() const
+{
+  if ( nPLSegs < 1 || nNLSegs < 1 ||
+       selectedCell == nullptr || HSCellPL == nullptr || HSCellNL == nullptr ||
+       vPLSegs.size() != nPLSegs || vNLSegs.size() != nNLSegs ||
+       accRPL.size() != nPLSegs + 1 || accRNL.size() != nNLSegs ) {
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("Unexpected behaviour - ");
+    exceptionMsgThrown.append("tried to run the line solver");
+    exceptionMsgThrown.append(" before its lines and cells were set.\n");
+    throw exceptionMsgThrown;
+  }
+}
+
+void
+LineSolver::setLines(size_t _nPLSegs, size_t _nNLSegs,
+                     double _PLResistancePerCell, double _NLResistancePerCell,
+                     double _PAMUXResistance, double _NAMUXResistance)
+{
+  if ( _nPLSegs < 1 || _nNLSegs < 1 ||
+       !areValid(_PLResistancePerCell, _NLResistancePerCell,
+                 _PAMUXResistance, _NAMUXResistance) ) {
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("Unexpected behaviour - ");
+    exceptionMsgThrown.append("tried to set up the line solver");
+    exceptionMsgThrown.append(" with empty lines or unknown resistances.\n");
+    throw exceptionMsgThrown;
+  }
+
+  nPLSegs = _nPLSegs;
+  nNLSegs = _nNLSegs;
+  PLResistancePerCell = _PLResistancePerCell;
+  NLResistancePerCell = _NLResistancePerCell;
+  PAMUXResistance = _PAMUXResistance;
+  NAMUXResistance = _NAMUXResistance;
+
+  vPLSegs.assign(nPLSegs, 0.);
+  iPLCells.assign(nPLSegs, 0.);
+  vNLSegs.assign(nNLSegs, 0.);
+  iNLCells.assign(nNLSegs, 0.);
+  hasInitialState = false;
+  lastAppliedVoltage = INVALID_DOUBLE;
+  guessVPLCells.assign(nPLSegs, 0.);
+  guessVNLCells.assign(nNLSegs, 0.);
+
+  // Accumulated resistance from the begining of the line (AMUX)
+  //  until the PL segment
+  // nPLSegs+1 to avoid reading past the end during VEdge calculation
+  accRPL.assign(nPLSegs + 1, 0.);
+  accRPL[0] = PAMUXResistance + PLResistancePerCell;
+  for (size_t PLSeg = 1; PLSeg < nPLSegs + 1; ++PLSeg) {
+    accRPL[PLSeg] = accRPL[PLSeg - 1] + PLResistancePerCell;
+  }
+
+  // Accumulated resistance from the NL segment until the NL AMUX
+  accRNL.assign(nNLSegs, 0.);
+  accRNL[0] = NAMUXResistance + nNLSegs * NLResistancePerCell;
+  for (size_t NLSeg = 1; NLSeg < nNLSegs; ++NLSeg) {
+    accRNL[NLSeg] = accRNL[NLSeg - 1] - NLResistancePerCell;
+  }
+
+  size_t nNodes = nPLSegs + nNLSegs;
+  jacLower.assign(nNodes, 0.);
+  jacDiag.assign(nNodes, 0.);
+  jacUpper.assign(nNodes, 0.);
+  nodeResidual.assign(nNodes, 0.);
+  nodeDelta.assign(nNodes, 0.);
+  nodeCellConductance.assign(nNodes, 0.);
+}
+
+void
+LineSolver::setCells(const Cell* _selectedCell,
+                     const Cell* _HSCellPL, const Cell* _HSCellNL,
+                     const Cell* _unselectedCell)
+{
+  selectedCell = _selectedCell;
+  HSCellPL = _HSCellPL;
+  HSCellNL = _HSCellNL;
+  unselectedCell = _unselectedCell;
+}
+
+void
+LineSolver::setMethod(string methodStr)
+{
+  if ( methodStr == "fixed-point" ) {
+    method = fixedPoint;
+  }
+  else if ( methodStr == "jacobi" ) {
+    method = jacobi;
+  }
+  else if ( methodStr == "newton" ) {
+    method = newton;
+  }
+  else {
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("Tried to set a line solver method for");
+    exceptionMsgThrown.append(" crosspoint array, \"");
+    exceptionMsgThrown.append(methodStr);
+    exceptionMsgThrown.append("\", different from the ones supported:\n");
+    exceptionMsgThrown.append("  \"fixed-point\"\n");
+    exceptionMsgThrown.append("  \"jacobi\"\n");
+    exceptionMsgThrown.append("  \"newton\"\n");
+    throw exceptionMsgThrown;
+  }
+}
+
+string
+LineSolver::getMethod() const
+{
+  string methodStr;
+  switch (method) {
+    case fixedPoint:      methodStr = "fixed-point";  break;
+    case jacobi:          methodStr = "jacobi";       break;
+    case newton:          methodStr = "newton";       break;
+    case INVALID_METHOD:  methodStr = INVALID_STRING; break;
+  }
+  return methodStr;
+}
+
+void
+LineSolver::setBiasScheme(biasSchemes scheme)
+{
+  if ( scheme == invalid_bias ) {
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("Unexpected behaviour - ");
+    exceptionMsgThrown.append("tried to set an invalid bias scheme");
+    exceptionMsgThrown.append(" in the line solver.\n");
+    throw exceptionMsgThrown;
+  }
+  biasScheme = scheme;
+}
+
+biasSchemes
+LineSolver::getBiasScheme() const
+{
+  return biasScheme;
+}
+
+void
+LineSolver::setLimits(const SolverLimits& _limits)
+{
+  limits = _limits;
+}
+
+const SolverLimits&
+LineSolver::getLimits() const
+{
+  return limits;
+}
+
+void
+LineSolver::setAcceleration(string accelerationStr)
+{
+  if ( accelerationStr == "none" ) {
+    acceleration = noAcceleration;
+  }
+  else if ( accelerationStr == "sor" ) {
+    acceleration = sor;
+  }
+  else if ( accelerationStr == "anderson" ) {
+    acceleration = anderson;
+  }
+  else {
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("Tried to set a line solver acceleration for");
+    exceptionMsgThrown.append(" crosspoint array, \"");
+    exceptionMsgThrown.append(accelerationStr);
+    exceptionMsgThrown.append("\", different from the ones supported:\n");
+    exceptionMsgThrown.append("  \"none\"\n");
+    exceptionMsgThrown.append("  \"sor\"\n");
+    exceptionMsgThrown.append("  \"anderson\"\n");
+    throw exceptionMsgThrown;
+  }
+}
+
+string
+LineSolver::getAcceleration() const
+{
+  string accelerationStr;
+  switch (acceleration) {
+    case noAcceleration:        accelerationStr = "none";         break;
+    case sor:                   accelerationStr = "sor";          break;
+    case anderson:              accelerationStr = "anderson";     break;
+    case INVALID_ACCELERATION:  accelerationStr = INVALID_STRING; break;
+  }
+  return accelerationStr;
+}
+
+void
+LineSolver::setSORFactor(double factor)
+{
+  // Successive over-relaxation only converges for factors within (0, 2)
+  if ( !(factor > 0. && factor < 2.) ) {
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("Line solver SOR factor must be between");
+    exceptionMsgThrown.append(" 0 and 2, got ");
+    exceptionMsgThrown.append(to_string(factor));
+    exceptionMsgThrown.append(".\n");
+    throw exceptionMsgThrown;
+  }
+  SORFactor = factor;
+}
+
+double
+LineSolver::getSORFactor() const
+{
+  return SORFactor;
+}
+
+void
+LineSolver::setAndersonDepth(size_t depth)
+{
+  if ( depth == 0 ) {
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("Line solver Anderson depth must be at");
+    exceptionMsgThrown.append(" least 1.\n");
+    throw exceptionMsgThrown;
+  }
+  andersonDepth = depth;
+}
+
+size_t
+LineSolver::getAndersonDepth() const
+{
+  return andersonDepth;
+}
+
+void
+LineSolver::updateUnselectedVoltages(double vBias)
+{
+  if ( biasScheme != floating_bias ) {
+    vUnselPL = vBias * unselectedLineBias(biasScheme, true);
+    vUnselNL = vBias * unselectedLineBias(biasScheme, false);
+  }
+}
+
+void
+LineSolver::updateFloatingVoltage()
+{
+  const double* vPL = vPLSegs.data();
+  const double* vNL = vNLSegs.data();
+
+  // Nothing hangs on the floating node
+  if ( nPLSegs == 1 && nNLSegs == 1 ) {
+    return;
+  }
+
+  // Current into the floating node is monotonically decreasing with its
+  //  voltage, and changes sign between the lowest and highest line voltages
+  double vLow = numeric_limits<double>::infinity();
+  double vHigh = -numeric_limits<double>::infinity();
+  for (size_t PLSeg = 0; PLSeg < nPLSegs-1; ++PLSeg) {
+    vLow = min(vLow, vPL[PLSeg]);
+    vHigh = max(vHigh, vPL[PLSeg]);
+  }
+  for (size_t NLSeg = 1; NLSeg < nNLSegs; ++NLSeg) {
+    vLow = min(vLow, vNL[NLSeg]);
+    vHigh = max(vHigh, vNL[NLSeg]);
+  }
+  const double vTolerance = 1e-12 * max(max(abs(vLow), abs(vHigh)), 1.);
+
+  // Safeguarded Newton - bisection whenever the step leaves the bracket
+  double vF = min(max(vUnselPL, vLow), vHigh);
+  for (size_t iteration = 0; iteration < 200; ++iteration) {
+    double iIn = 0.;
+    double gIn = 0.;
+    double g;
+    for (size_t PLSeg = 0; PLSeg < nPLSegs-1; ++PLSeg) {
+      iIn += HSCellPL->getRawCellCurrent(vPL[PLSeg] - vF, g);
+      gIn += g;
+    }
+    for (size_t NLSeg = 1; NLSeg < nNLSegs; ++NLSeg) {
+      iIn -= HSCellNL->getRawCellCurrent(vF - vNL[NLSeg], g);
+      gIn += g;
+    }
+
+    if ( iIn > 0. ) {
+      vLow = vF;
+    }
+    else {
+      vHigh = vF;
+    }
+
+    double vNext = (gIn > 0.) ? vF + iIn / gIn : vF;
+    if ( !(vNext > vLow && vNext < vHigh) ) {
+      vNext = (vLow + vHigh) / 2.;
+    }
+    bool converged = abs(vNext - vF) <= vTolerance;
+    vF = vNext;
+    if ( converged || vHigh - vLow <= vTolerance ) {
+      break;
+    }
+  }
+
+  vUnselPL = vF;
+  vUnselNL = vF;
+}
+
+double
+LineSolver::calcVEdge(double vSC, double vBias, bool trackBias)
+{
+  checkSetup();
+
+  updateUnselectedVoltages(vBias);
+  double vP;
+  if ( method == newton ) {
+    vP = calcVEdgeNewton(vSC, trackBias);
+  }
+  else if ( method == jacobi ) {
+    vP = calcVEdgeJacobi(vSC, trackBias);
+  }
+  else {
+    vP = calcVEdgeFixedPoint(vSC, trackBias);
+  }
+  lastAppliedVoltage = vP;
+  return vP;
+}
+
+double
+LineSolver::calcVSelectedCell(double vP, double vBias, double vN)
+{
+  checkSetup();
+
+  updateUnselectedVoltages(vBias);
+  double vSC;
+  if ( method == newton ) {
+    vSC = calcVSelectedCellNewton(vP, vN);
+  }
+  else if ( method == jacobi ) {
+    vSC = calcVSelectedCellJacobi(vP, vN);
+  }
+  else {
+    vSC = calcVSelectedCellFixedPoint(vP, vN);
+  }
+  lastAppliedVoltage = vP - vN;
+  return vSC;
+}
+
+void
+LineSolver::updateNLVoltages(double vN)
+{
+  double* vNL = vNLSegs.data();
+  const double* iNL = iNLCells.data();
+
+  double accINL = 0.;
+  for (size_t NLSeg = 0; NLSeg < nNLSegs; ++NLSeg) {
+    accINL += iNL[NLSeg];
+  }
+  vNL[nNLSegs-1] = vN + accINL * (NAMUXResistance + NLResistancePerCell);
+  for (size_t NLSeg = nNLSegs-1; NLSeg-- > 0; ) {
+    accINL -= iNL[NLSeg+1];
+    vNL[NLSeg] = vNL[NLSeg+1] + accINL * NLResistancePerCell;
+  }
+}
+
+void
+LineSolver::updatePLVoltages(double vP)
+{
+  double* vPL = vPLSegs.data();
+  const double* iPL = iPLCells.data();
+
+  double accIPL = 0.;
+  for (size_t PLSeg = 0; PLSeg < nPLSegs; ++PLSeg) {
+    accIPL += iPL[PLSeg];
+  }
+  vPL[0] = vP - accIPL * (PAMUXResistance + PLResistancePerCell);
+  for (size_t PLSeg = 1; PLSeg < nPLSegs; ++PLSeg ) {
+    accIPL -= iPL[PLSeg-1];
+    vPL[PLSeg] = vPL[PLSeg-1] - accIPL * PLResistancePerCell;
+  }
+}
+
+double
+LineSolver::updatePLVoltagesFromSC(double vSC)
+{
+  double* vPL = vPLSegs.data();
+  const double* iPL = iPLCells.data();
+  const double* vNL = vNLSegs.data();
+
+  double accIPL = iPL[nPLSegs-1];
+  vPL[nPLSegs-1] = vNL[0] + vSC;
+  for (size_t PLSeg = nPLSegs-1; PLSeg-- > 0;) {
+    vPL[PLSeg] = vPL[PLSeg+1] + PLResistancePerCell * accIPL;
+    accIPL += iPL[PLSeg];
+  }
+  return vPL[0] + accRPL[0] * accIPL;
+}
+
+void
+LineSolver::updateHSCurrents(double relaxation)
+{
+  double* iPL = iPLCells.data();
+  double* iNL = iNLCells.data();
+  const double* vPL = vPLSegs.data();
+  const double* vNL = vNLSegs.data();
+
+  if ( relaxation != 1. ) {
+    // New currents go to the Newton scratch, laid out as its nodes, and
+    //  the old ones move towards them
+    double* iNew = nodeDelta.data();
+    for (size_t PLSeg = 0; PLSeg < nPLSegs-1; ++PLSeg) {
+      iNew[PLSeg] = vPL[PLSeg] - vUnselNL;
+    }
+    HSCellPL->getRawCellCurrents(iNew, iNew, nullptr, nPLSegs-1);
+    for (size_t NLSeg = 1; NLSeg < nNLSegs; ++NLSeg) {
+      iNew[nPLSegs + NLSeg] = vUnselPL - vNL[NLSeg];
+    }
+    HSCellNL->getRawCellCurrents(iNew + nPLSegs + 1, iNew + nPLSegs + 1,
+                                 nullptr, nNLSegs-1);
+    for (size_t PLSeg = 0; PLSeg < nPLSegs-1; ++PLSeg) {
+      iPL[PLSeg] = relaxedUpdate(iPL[PLSeg], iNew[PLSeg], relaxation);
+    }
+    for (size_t NLSeg = 1; NLSeg < nNLSegs; ++NLSeg) {
+      iNL[NLSeg] = relaxedUpdate(iNL[NLSeg], iNew[nPLSegs + NLSeg],
+                                 relaxation);
+    }
+    return;
+  }
+
+  // Cell voltages first, turned into currents in place
+  for (size_t PLSeg = 0; PLSeg < nPLSegs-1; ++PLSeg) {
+    iPL[PLSeg] = vPL[PLSeg] - vUnselNL;
+  }
+  HSCellPL->getRawCellCurrents(iPL, iPL, nullptr, nPLSegs-1);
+  for (size_t NLSeg = 1; NLSeg < nNLSegs; ++NLSeg) {
+    iNL[NLSeg] = vUnselPL - vNL[NLSeg];
+  }
+  HSCellNL->getRawCellCurrents(iNL + 1, iNL + 1, nullptr, nNLSegs-1);
+}
+
+void
+LineSolver::initializeGuessedCurrents(double vApplied)
+{
+  double* iPL = iPLCells.data();
+  double* iNL = iNLCells.data();
+  const double* vPLCell = guessVPLCells.data();
+  const double* vNLCell = guessVNLCells.data();
+
+  // Cell voltages first, turned into currents in place
+  for (size_t PLSeg = 0; PLSeg < nPLSegs-1; ++PLSeg) {
+    iPL[PLSeg] = vPLCell[PLSeg] * vApplied;
+  }
+  HSCellPL->getRawCellCurrents(iPL, iPL, nullptr, nPLSegs-1);
+  for (size_t NLSeg = 1; NLSeg < nNLSegs; ++NLSeg) {
+    iNL[NLSeg] = vNLCell[NLSeg] * vApplied;
+  }
+  HSCellNL->getRawCellCurrents(iNL + 1, iNL + 1, nullptr, nNLSegs-1);
+  iNL[0] = selectedCell->getRawCellCurrent(vNLCell[0] * vApplied);
+  iPL[nPLSegs-1] = iNL[0];
+}
+
+double
+LineSolver::initializeLinesForVEdge(double vSC)
+{
+  double* vPL = vPLSegs.data();
+  double* iPL = iPLCells.data();
+  double* vNL = vNLSegs.data();
+  double* iNL = iNLCells.data();
+  const double* rPL = accRPL.data();
+  const double* rNL = accRNL.data();
+
+  // Current and voltage necessary on selected cell
+  double iSC = selectedCell->getRawCellCurrent(vSC);
+
+  // The guess also gives the driver voltage, from its selected cell share
+  if ( hasInitialState && guessVNLCells[0] > 0. ) {
+    initializeGuessedCurrents(vSC / guessVNLCells[0]);
+  }
+  iNL[0] = iSC;
+  iPL[nPLSegs-1] = iSC;
+
+  if ( hasInitialState && guessVNLCells[0] > 0. ) {
+    // Voltage drop across lines due to all guessed cell currents
+    //  The PL is walked back from the selected cell to its driver
+    updateNLVoltages(0.);
+    return updatePLVoltagesFromSC(vSC);
+  }
+
+  /*** Voltage drop across lines due to selected cell current ***/
+  vNL[nNLSegs-1] = iSC * rNL[nNLSegs-1];
+  for (size_t NLSeg = nNLSegs-1; NLSeg-- > 0;) {
+    vNL[NLSeg] = vNL[NLSeg+1] + NLResistancePerCell * iSC;
+  }
+
+  vPL[nPLSegs-1] = vNL[0] + vSC;
+  for (size_t PLSeg = nPLSegs-1; PLSeg-- > 0;) {
+    vPL[PLSeg] = vPL[PLSeg+1] + PLResistancePerCell * iSC;
+  }
+
+  // PL AMUX 'input' voltage - yet to be found
+  // NL AMUX 'input' voltage is considered to be grounded
+  return vPL[0] + rPL[0] * iSC;
+}
+
+void
+LineSolver::initializeLinesForVSC(double vP, double vN)
+{
+  if ( hasInitialState ) {
+    initializeGuessedCurrents(vP - vN);
+    updateNLVoltages(vN);
+    updatePLVoltages(vP);
+    return;
+  }
+  fill(vPLSegs.begin(), vPLSegs.end(), vP);
+  fill(vNLSegs.begin(), vNLSegs.end(), vN);
+}
+
+void
+LineSolver::startAnderson()
+{
+  size_t nNodes = nPLSegs + nNLSegs;
+  andersonResidual.assign(nNodes, 0.);
+  andersonLastState.assign(nNodes, 0.);
+  andersonLastResidual.assign(nNodes, 0.);
+  andersonDeltaStates.assign(andersonDepth * nNodes, 0.);
+  andersonDeltaResiduals.assign(andersonDepth * nNodes, 0.);
+  andersonNSweeps = 0;
+  andersonNStored = 0;
+}
+
+void
+LineSolver::keepSweepStart()
+{
+  double* x = nodeResidual.data();
+  copy(iPLCells.begin(), iPLCells.end(), x);
+  copy(iNLCells.begin(), iNLCells.end(), x + nPLSegs);
+}
+
+void
+LineSolver::mixAnderson()
+{
+  const size_t nNodes = nPLSegs + nNLSegs;
+  const double* x = nodeResidual.data();
+  double* g = nodeDelta.data();
+  double* f = andersonResidual.data();
+  double* lastG = andersonLastState.data();
+  double* lastF = andersonLastResidual.data();
+
+  copy(iPLCells.begin(), iPLCells.end(), g);
+  copy(iNLCells.begin(), iNLCells.end(), g + nPLSegs);
+  for (size_t node = 0; node < nNodes; ++node) {
+    f[node] = g[node] - x[node];
+  }
+
+  // Changes since the last sweep go in the oldest column of the ring
+  if ( andersonNSweeps > 0 ) {
+    size_t column = (andersonNSweeps - 1) % andersonDepth;
+    double* deltaG = &andersonDeltaStates[column * nNodes];
+    double* deltaF = &andersonDeltaResiduals[column * nNodes];
+    for (size_t node = 0; node < nNodes; ++node) {
+      deltaG[node] = g[node] - lastG[node];
+      deltaF[node] = f[node] - lastF[node];
+    }
+    andersonNStored = min(andersonNStored + 1, andersonDepth);
+  }
+  ++andersonNSweeps;
+  copy(g, g + nNodes, lastG);
+  copy(f, f + nNodes, lastF);
+  if ( andersonNStored == 0 ) {
+    return;
+  }
+
+  // Weights of the kept changes best cancelling the residual
+  //  min |f - deltaF * gamma|, from the normal equations - a handful of
+  //  unknowns - slightly regularized, as successive changes get parallel
+  const size_t m = andersonNStored;
+  vector<double> normal(m * (m + 1), 0.);
+  for (size_t row = 0; row < m; ++row) {
+    const double* deltaFRow = &andersonDeltaResiduals[row * nNodes];
+    for (size_t col = row; col < m; ++col) {
+      const double* deltaFCol = &andersonDeltaResiduals[col * nNodes];
+      double product = 0.;
+      for (size_t node = 0; node < nNodes; ++node) {
+        product += deltaFRow[node] * deltaFCol[node];
+      }
+      normal[row * (m + 1) + col] = product;
+      normal[col * (m + 1) + row] = product;
+    }
+    double product = 0.;
+    for (size_t node = 0; node < nNodes; ++node) {
+      product += deltaFRow[node] * f[node];
+    }
+    normal[row * (m + 1) + m] = product;
+  }
+  double maxDiagonal = 0.;
+  for (size_t row = 0; row < m; ++row) {
+    maxDiagonal = max(maxDiagonal, normal[row * (m + 1) + row]);
+  }
+  for (size_t row = 0; row < m; ++row) {
+    normal[row * (m + 1) + row] += 1e-12 * maxDiagonal;
+  }
+
+  // Gaussian elimination - symmetric positive definite, no pivoting
+  bool solved = maxDiagonal > 0.;
+  for (size_t pivot = 0; solved && pivot < m; ++pivot) {
+    double pivotValue = normal[pivot * (m + 1) + pivot];
+    if ( !(pivotValue > 0.) ) {
+      solved = false;
+      break;
+    }
+    for (size_t row = pivot + 1; row < m; ++row) {
+      double factor = normal[row * (m + 1) + pivot] / pivotValue;
+      for (size_t col = pivot; col <= m; ++col) {
+        normal[row * (m + 1) + col] -= factor * normal[pivot * (m + 1) + col];
+      }
+    }
+  }
+  vector<double> gamma(m, 0.);
+  for (size_t row = m; solved && row-- > 0;) {
+    double value = normal[row * (m + 1) + m];
+    for (size_t col = row + 1; col < m; ++col) {
+      value -= normal[row * (m + 1) + col] * gamma[col];
+    }
+    gamma[row] = value / normal[row * (m + 1) + row];
+    solved = isfinite(gamma[row]);
+  }
+  // Degenerate history - start over from this sweep, left unmixed
+  if ( !solved ) {
+    andersonNStored = 0;
+    return;
+  }
+
+  for (size_t col = 0; col < m; ++col) {
+    const double* deltaG = &andersonDeltaStates[col * nNodes];
+    for (size_t node = 0; node < nNodes; ++node) {
+      g[node] -= gamma[col] * deltaG[node];
+    }
+  }
+  // The selected cell sits on both lines - both copies are mixed alike
+  copy(g, g + nPLSegs, iPLCells.begin());
+  copy(g + nPLSegs, g + nNodes, iNLCells.begin());
+}
+
+void
+LineSolver::countAcceleratedSolve(size_t nIterations) const
+{
+  if ( acceleration != noAcceleration ) {
+    COUNT_PERF(acceleratedSolves, 1);
+    COUNT_PERF(acceleratedIterations, nIterations);
+  }
+}
+
+double
+LineSolver::calcVEdgeFixedPoint(double vSC, bool trackBias)
+{
+  double* vPL = vPLSegs.data();
+  double* iPL = iPLCells.data();
+  double* vNL = vNLSegs.data();
+  double* iNL = iNLCells.data();
+  const double* rPL = accRPL.data();
+  const double* rNL = accRNL.data();
+
+  double vP = initializeLinesForVEdge(vSC);
+  if ( trackBias ) {
+    updateUnselectedVoltages(vP);
+  }
+
+  // PL AMUX voltage relative error between iterations
+  double relError = numeric_limits<double>::infinity();
+
+  SolverGuard guard(limits, "Line solver");
+  if ( acceleration == anderson ) {
+    startAnderson();
+  }
+
+  /*** ************************ Main algorithm ************************ ***/
+  /* Updates sneak current while updating AMUX voltage */
+  while ( abs(relError) > 1e-6 ) {
+    guard.startIteration();
+    COUNT_SOLVER_ITERATION();
+    // Cell currents take only part of their change once under-relaxed,
+    //  and more than all of it when over-relaxed
+    const double relaxation = guard.getRelaxation()
+                              * (acceleration == sor ? SORFactor : 1.);
+    // Mixing stops once the solve had to be under-relaxed
+    const bool mixing = acceleration == anderson
+                        && guard.getRelaxation() == 1.;
+    if ( mixing ) {
+      keepSweepStart();
+    }
+    double lastVP = vP;
+    double lastVFloating = vUnselPL;
+    double accDeltaV = 0.;
+    if ( biasScheme == floating_bias ) {
+      updateFloatingVoltage();
+    }
+
+    double lastI;
+    double deltaI = 0.;
+    double deltaV;
+    // Update NL cell currents and next cell (and AMUX) voltage
+    for (size_t NLSeg = nNLSegs-1; NLSeg >= 1; --NLSeg) {
+      lastI = iNL[NLSeg];
+      iNL[NLSeg] = relaxedUpdate(
+          lastI, HSCellNL->getRawCellCurrent(vUnselPL - vNL[NLSeg]),
+          relaxation);
+      deltaI = iNL[NLSeg] - lastI;
+
+      deltaV = rNL[NLSeg] * deltaI;
+      accDeltaV += deltaV;
+
+      vNL[NLSeg - 1] += accDeltaV;
+      vP += deltaV;
+      if ( trackBias ) {
+        updateUnselectedVoltages(vP);
+      }
+    }
+
+    deltaI = 0.;
+    double accDeltaI = 0.;
+    // Update PL cell currents and "previous" cell (and AMUX) voltage
+    vPL[nPLSegs - 1] += accDeltaV;
+    for (size_t PLSeg = nPLSegs-1; PLSeg-- > 0;) {
+      deltaV = PLResistancePerCell * accDeltaI;
+      accDeltaV += deltaV;
+
+      vP += rPL[PLSeg+1] * deltaI;
+      if ( trackBias ) {
+        updateUnselectedVoltages(vP);
+      }
+
+      vPL[PLSeg] += accDeltaV;
+
+      lastI = iPL[PLSeg];
+      iPL[PLSeg] = relaxedUpdate(
+          lastI, HSCellPL->getRawCellCurrent(vPL[PLSeg] - vUnselNL),
+          relaxation);
+
+      deltaI = iPL[PLSeg] - lastI;
+      accDeltaI += deltaI;
+    }
+    vP += rPL[0] * deltaI;
+    if ( trackBias ) {
+      updateUnselectedVoltages(vP);
+    }
+
+    // Update NL segments voltages
+    updateNLVoltages(0.);
+
+    // Mixed currents give the lines voltages, walking back from the
+    //  selected cell
+    if ( mixing ) {
+      mixAnderson();
+      updateNLVoltages(0.);
+      vP = updatePLVoltagesFromSC(vSC);
+      if ( trackBias ) {
+        updateUnselectedVoltages(vP);
+      }
+    }
+
+    // Change of an unrelaxed iteration
+    //  The floating node only moves once per sweep, so the lines are not
+    //  settled before it stops moving as well
+    relError = (lastVP - vP) / (relaxation * vP);
+    if ( biasScheme == floating_bias ) {
+      double floatingError = (lastVFloating - vUnselPL) / (relaxation * vP);
+      if ( abs(floatingError) > abs(relError) ) {
+        relError = floatingError;
+      }
+    }
+    guard.checkError(relError);
+  }
+  countAcceleratedSolve(guard.getIteration());
+
+  if ( iNL[0] != iPL[nPLSegs-1] ) {
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("Unexpected behaviour - ");
+    exceptionMsgThrown.append("somthing worng with selected cell current.");
+    throw exceptionMsgThrown;
+  }
+
+  return vP;
+}
+
+double
+LineSolver::calcVSelectedCellFixedPoint(double vP, double vN)
+{
+  double* vPL = vPLSegs.data();
+  double* iPL = iPLCells.data();
+  double* vNL = vNLSegs.data();
+  double* iNL = iNLCells.data();
+  const double* rPL = accRPL.data();
+  const double* rNL = accRNL.data();
+
+  initializeLinesForVSC(vP, vN);
+
+  // Voltage across the selected cell
+  // Index is the iteration - 0 for this, 1 for last, 2 for second last
+  double vSC[3] = {0., 0., 0.};
+
+  // Selected cell voltage relative error between iterations
+  double relError = numeric_limits<double>::infinity();
+
+  // Factor to slow down vSC variation to improve convergence
+  double slowDownFactor = 1.;
+
+  SolverGuard guard(limits, "Line solver");
+  if ( acceleration == anderson ) {
+    startAnderson();
+  }
+
+  /*** ************************ Main algorithm ************************ ***/
+  /* Updates sneak current while updating driver voltage */
+  while ( abs(relError) > 1e-6 ) {
+    guard.startIteration();
+    COUNT_SOLVER_ITERATION();
+    // Half selected cells currents are over-relaxed by SOR - less so once
+    //  the solve stalled
+    const double cellsRelaxation =
+        (acceleration == sor ? SORFactor * guard.getRelaxation() : 1.);
+    // Mixing stops once the solve had to be under-relaxed
+    const bool mixing = acceleration == anderson
+                        && guard.getRelaxation() == 1.;
+    if ( mixing ) {
+      keepSweepStart();
+    }
+
+    double lastI;
+    double accDeltaV;
+
+    double lastVFloating = vUnselPL;
+    if ( biasScheme == floating_bias ) {
+      updateFloatingVoltage();
+    }
+
+    // Update NL cell currents and next cell voltage
+    accDeltaV = 0.;
+    for (size_t NLSeg = nNLSegs-1; NLSeg >= 1; --NLSeg) {
+      lastI = iNL[NLSeg];
+      iNL[NLSeg] = relaxedUpdate(
+          lastI, HSCellNL->getRawCellCurrent(vUnselPL - vNL[NLSeg]),
+          cellsRelaxation);
+
+      accDeltaV += rNL[NLSeg] * (iNL[NLSeg] - lastI);
+
+      vNL[NLSeg - 1] += accDeltaV;
+    }
+
+    // Update PL cell currents and next cell voltage
+    accDeltaV = 0.;
+    for (size_t PLSeg = 0; PLSeg < nPLSegs-1; ++PLSeg) {
+      lastI = iPL[PLSeg];
+      iPL[PLSeg] = relaxedUpdate(
+          lastI, HSCellPL->getRawCellCurrent(vPL[PLSeg] - vUnselNL),
+          cellsRelaxation);
+
+      accDeltaV += rPL[PLSeg] * (iPL[PLSeg] - lastI);
+
+      vPL[PLSeg + 1] -= accDeltaV;
+    }
+
+    vSC[2] = vSC[1];
+    vSC[1] = vSC[0];
+    vSC[0] = vPL[nPLSegs-1] - vNL[0];
+    if ( areEqual(vSC[0], vSC[2], 1e-3) ) {
+      if ( !areEqual(vSC[0], vSC[1], 1e-3) ) {
+        slowDownFactor *= 2.;
+      }
+    }
+    // Slow down voltage variation to improve convergence
+    //  Beyond the period two oscillations caught above, the solve is
+    //  under-relaxed whenever its error stalls
+    const double relaxation = guard.getRelaxation();
+    vSC[0] = vSC[1] + (vSC[0] - vSC[1]) / (slowDownFactor / relaxation);
+    iNL[0] = selectedCell->getRawCellCurrent(vSC[0]);
+    iPL[nPLSegs-1] = iNL[0];
+    relError = (vSC[1] - vSC[0]) / (relaxation * vSC[0]);
+    // The floating node only moves once per sweep, so the lines are not
+    //  settled before it stops moving as well
+    if ( biasScheme == floating_bias ) {
+      double floatingError = (lastVFloating - vUnselPL)
+                             / (relaxation * (vP - vN));
+      if ( abs(floatingError) > abs(relError) ) {
+        relError = floatingError;
+      }
+    }
+    guard.checkError(relError);
+
+    if ( mixing ) {
+      mixAnderson();
+    }
+
+    // Update lines segments voltages
+    updateNLVoltages(vN);
+    updatePLVoltages(vP);
+
+  }
+  countAcceleratedSolve(guard.getIteration());
+
+  if ( iNL[0] != iPL[nPLSegs-1] ) {
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("Unexpected behaviour - ");
+    exceptionMsgThrown.append("somthing worng with selected cell current.");
+    throw exceptionMsgThrown;
+  }
+
+  return vSC[0];
+}
+
+double
+LineSolver::calcVEdgeJacobi(double vSC, bool trackBias)
+{
+  double vP = initializeLinesForVEdge(vSC);
+  if ( trackBias ) {
+    updateUnselectedVoltages(vP);
+  }
+
+  // PL AMUX voltage relative error between iterations
+  double relError = numeric_limits<double>::infinity();
+
+  SolverGuard guard(limits, "Line solver");
+
+  // The selected cell current is fixed by vSC - only the half selected
+  //  cells move the lines voltages
+  while ( abs(relError) > 1e-6 ) {
+    guard.startIteration();
+    COUNT_SOLVER_ITERATION();
+    const double relaxation = guard.getRelaxation();
+    double lastVP = vP;
+    if ( biasScheme == floating_bias ) {
+      updateFloatingVoltage();
+    }
+
+    updateHSCurrents(relaxation);
+    updateNLVoltages(0.);
+    vP = updatePLVoltagesFromSC(vSC);
+    if ( trackBias ) {
+      updateUnselectedVoltages(vP);
+    }
+
+    // Change of an unrelaxed iteration
+    relError = (lastVP - vP) / (relaxation * vP);
+    guard.checkError(relError);
+  }
+
+  return vP;
+}
+
+double
+LineSolver::solveSelectedCell(double vOpen, double rSeries, double vSC) const
+{
+  // v + rSeries * i(v) is monotonically increasing, and crosses vOpen
+  //  between 0 and vOpen
+  double vLow = min(0., vOpen);
+  double vHigh = max(0., vOpen);
+  const double vTolerance = 1e-12 * max(abs(vOpen), 1.);
+
+  // Safeguarded Newton from the given guess - exact within a segment of
+  //  the piecewise linear I-V curve
+  double v = min(max(vSC, vLow), vHigh);
+  for (size_t iteration = 0; iteration < 200; ++iteration) {
+    double g;
+    double residual = v + rSeries * selectedCell->getRawCellCurrent(v, g)
+                      - vOpen;
+    if ( residual == 0. ) {
+      break;
+    }
+    if ( residual < 0. ) {
+      vLow = v;
+    }
+    else {
+      vHigh = v;
+    }
+
+    double vNext = v - residual / (1. + rSeries * g);
+    if ( !(vNext > vLow && vNext < vHigh) ) {
+      vNext = (vLow + vHigh) / 2.;
+    }
+    bool converged = abs(vNext - v) <= vTolerance;
+    v = vNext;
+    if ( converged || vHigh - vLow <= vTolerance ) {
+      break;
+    }
+  }
+  return v;
+}
+
+double
+LineSolver::calcVSelectedCellJacobi(double vP, double vN)
+{
+  double* vPL = vPLSegs.data();
+  double* iPL = iPLCells.data();
+  double* vNL = vNLSegs.data();
+  double* iNL = iNLCells.data();
+  const double* rPL = accRPL.data();
+  const double* rNL = accRNL.data();
+  // Newton scratch - new currents and slopes, laid out as its nodes
+  double* iNew = nodeDelta.data();
+  double* gCell = nodeCellConductance.data();
+
+  initializeLinesForVSC(vP, vN);
+
+  // Selected cell voltage [V], and the lines resistance it sees [ohm]
+  double vSC = vPL[nPLSegs-1] - vNL[0];
+  const double rSC = rPL[nPLSegs-1] + rNL[0];
+
+  // Selected cell voltage relative error between iterations
+  double relError = numeric_limits<double>::infinity();
+
+  // Fraction of the Jacobi step taken, and the largest change of a half
+  //  selected cell current it was taken on [A]
+  double damping = 1.;
+  double lastStep = numeric_limits<double>::infinity();
+
+  SolverGuard guard(limits, "Line solver");
+
+  /*** ************************ Main algorithm ************************ ***/
+  /* Each cell current raises its own line drop, so all cells moving at
+   *  once overshoot. Linearized, the sweep converges for any damping
+   *  factor below 2 / (1 + l), l being the largest eigenvalue of the lines
+   *  resistances times the cells slopes - bound here by their trace.
+   * The selected cell, far stronger coupled, is solved exactly against
+   *  the lines left by the half selected ones */
+  while ( abs(relError) > 1e-6 ) {
+    guard.startIteration();
+    COUNT_SOLVER_ITERATION();
+    if ( biasScheme == floating_bias ) {
+      updateFloatingVoltage();
+    }
+
+    for (size_t PLSeg = 0; PLSeg < nPLSegs-1; ++PLSeg) {
+      iNew[PLSeg] = vPL[PLSeg] - vUnselNL;
+    }
+    HSCellPL->getRawCellCurrents(iNew, iNew, gCell, nPLSegs-1);
+    for (size_t NLSeg = 1; NLSeg < nNLSegs; ++NLSeg) {
+      iNew[nPLSegs + NLSeg] = vUnselPL - vNL[NLSeg];
+    }
+    HSCellNL->getRawCellCurrents(iNew + nPLSegs + 1, iNew + nPLSegs + 1,
+                                 gCell + nPLSegs + 1, nNLSegs-1);
+
+    // Slopes are local and the I-V curves steepen with the voltage, so
+    //  the factor is halved whenever a step does not shrink - as vSC is
+    //  slowed down in the Gauss-Seidel sweeps - and only grows back
+    //  slowly while the steps shrink
+    double coupling = 0.;
+    double step = 0.;
+    for (size_t PLSeg = 0; PLSeg < nPLSegs-1; ++PLSeg) {
+      coupling += rPL[PLSeg] * gCell[PLSeg];
+      step = max(step, abs(iNew[PLSeg] - iPL[PLSeg]));
+    }
+    for (size_t NLSeg = 1; NLSeg < nNLSegs; ++NLSeg) {
+      coupling += rNL[NLSeg] * gCell[nPLSegs + NLSeg];
+      step = max(step, abs(iNew[nPLSegs + NLSeg] - iNL[NLSeg]));
+    }
+    if ( step > 0. && step >= lastStep ) {
+      damping /= 2.;
+    }
+    else {
+      damping *= 1.25;
+    }
+    damping = min(damping, 2. / (2. + coupling));
+    lastStep = step;
+    // Errors stalling even so - the steps shrink, but bounce around - are
+    //  caught by the guard
+    const double stepDamping = damping * guard.getRelaxation();
+
+    for (size_t PLSeg = 0; PLSeg < nPLSegs-1; ++PLSeg) {
+      iPL[PLSeg] += stepDamping * (iNew[PLSeg] - iPL[PLSeg]);
+    }
+    for (size_t NLSeg = 1; NLSeg < nNLSegs; ++NLSeg) {
+      iNL[NLSeg] += stepDamping * (iNew[nPLSegs + NLSeg] - iNL[NLSeg]);
+    }
+
+    updateNLVoltages(vN);
+    updatePLVoltages(vP);
+
+    double lastVSC = vSC;
+    double vOpen = vPL[nPLSegs-1] - vNL[0] + rSC * iNL[0];
+    vSC = solveSelectedCell(vOpen, rSC, vSC);
+    double iSC = selectedCell->getRawCellCurrent(vSC);
+    double deltaISC = iSC - iNL[0];
+    iNL[0] = iSC;
+    iPL[nPLSegs-1] = iSC;
+    // The selected cell current flows through every segment of both lines
+    for (size_t PLSeg = 0; PLSeg < nPLSegs; ++PLSeg) {
+      vPL[PLSeg] -= rPL[PLSeg] * deltaISC;
+    }
+    for (size_t NLSeg = 0; NLSeg < nNLSegs; ++NLSeg) {
+      vNL[NLSeg] += rNL[NLSeg] * deltaISC;
+    }
+
+    // Change of an undamped sweep
+    relError = (lastVSC - vSC) / (stepDamping * vSC);
+    guard.checkError(relError);
+  }
+
+  return vSC;
+}
+
+double
+LineSolver::buildNewtonSystem(double vP, double vN)
+{
+  // Newton needs finite conductances - ideal wires get a negligible resistance
+  const double minResistance = 1e-6;
+  const double gPLDriver =
+      1. / max(PAMUXResistance + PLResistancePerCell, minResistance);
+  const double gNLDriver =
+      1. / max(NAMUXResistance + NLResistancePerCell, minResistance);
+  const double gPL = 1. / max(PLResistancePerCell, minResistance);
+  const double gNL = 1. / max(NLResistancePerCell, minResistance);
+
+  const double* vPL = vPLSegs.data();
+  const double* vNL = vNLSegs.data();
+  double* iPL = iPLCells.data();
+  double* iNL = iNLCells.data();
+  double* lower = jacLower.data();
+  double* diag = jacDiag.data();
+  double* upper = jacUpper.data();
+  double* res = nodeResidual.data();
+  double* gCell = nodeCellConductance.data();
+
+  // Half selected cells currents and slopes, all at once
+  for (size_t PLSeg = 0; PLSeg < nPLSegs-1; ++PLSeg) {
+    iPL[PLSeg] = vPL[PLSeg] - vUnselNL;
+  }
+  HSCellPL->getRawCellCurrents(iPL, iPL, gCell, nPLSegs-1);
+  for (size_t NLSeg = 1; NLSeg < nNLSegs; ++NLSeg) {
+    iNL[NLSeg] = vUnselPL - vNL[NLSeg];
+  }
+  HSCellNL->getRawCellCurrents(iNL + 1, iNL + 1, gCell + nPLSegs + 1,
+                               nNLSegs-1);
+
+  // Residuals are the currents leaving each node
+  // PL nodes - fed by the PL driver, sinking current into the cells
+  for (size_t PLSeg = 0; PLSeg < nPLSegs; ++PLSeg) {
+    double gLeft = (PLSeg == 0) ? gPLDriver : gPL;
+    double vLeft = (PLSeg == 0) ? vP : vPL[PLSeg-1];
+
+    res[PLSeg] = gLeft * (vPL[PLSeg] - vLeft);
+    diag[PLSeg] = gLeft;
+    lower[PLSeg] = (PLSeg == 0) ? 0. : -gLeft;
+    upper[PLSeg] = 0.;
+
+    if ( PLSeg < nPLSegs-1 ) {
+      res[PLSeg] += gPL * (vPL[PLSeg] - vPL[PLSeg+1]);
+      diag[PLSeg] += gPL;
+      upper[PLSeg] = -gPL;
+    }
+    else {
+      // Selected cell, coupling the last PL node to the first NL node
+      iPL[PLSeg] = selectedCell->getRawCellCurrent(vPL[PLSeg] - vNL[0],
+                                                   gCell[PLSeg]);
+      upper[PLSeg] = -gCell[PLSeg];
+    }
+    res[PLSeg] += iPL[PLSeg];
+    diag[PLSeg] += gCell[PLSeg];
+  }
+
+  // NL nodes - fed by the cells, drained by the NL driver
+  for (size_t NLSeg = 0; NLSeg < nNLSegs; ++NLSeg) {
+    size_t node = nPLSegs + NLSeg;
+
+    if ( NLSeg == 0 ) {
+      iNL[NLSeg] = iPL[nPLSegs-1];
+      gCell[node] = gCell[nPLSegs-1];
+      res[node] = -iNL[NLSeg];
+      diag[node] = gCell[node];
+      lower[node] = -gCell[node];
+    }
+    else {
+      res[node] = gNL * (vNL[NLSeg] - vNL[NLSeg-1]) - iNL[NLSeg];
+      diag[node] = gNL + gCell[node];
+      lower[node] = -gNL;
+    }
+
+    if ( NLSeg < nNLSegs-1 ) {
+      res[node] += gNL * (vNL[NLSeg] - vNL[NLSeg+1]);
+      diag[node] += gNL;
+      upper[node] = -gNL;
+    }
+    else {
+      res[node] += gNLDriver * (vNL[NLSeg] - vN);
+      diag[node] += gNLDriver;
+      upper[node] = 0.;
+    }
+  }
+
+  double maxResidual = 0.;
+  for (size_t node = 0; node < nPLSegs + nNLSegs; ++node) {
+    maxResidual = maxMagnitude(maxResidual, res[node]);
+  }
+  return maxResidual;
+}
+
+void
+LineSolver::factorJacobian()
+{
+  // Forward sweep of the Thomas algorithm
+  //  upper becomes the modified super-diagonal and diag the pivots
+  size_t nNodes = nPLSegs + nNLSegs;
+  double* lower = jacLower.data();
+  double* diag = jacDiag.data();
+  double* upper = jacUpper.data();
+
+  upper[0] /= diag[0];
+  for (size_t node = 1; node < nNodes; ++node) {
+    diag[node] -= lower[node] * upper[node-1];
+    upper[node] /= diag[node];
+  }
+}
+
+void
+LineSolver::solveJacobian(vector<double>& rhs) const
+{
+  size_t nNodes = nPLSegs + nNLSegs;
+  const double* lower = jacLower.data();
+  const double* diag = jacDiag.data();
+  const double* upper = jacUpper.data();
+  double* x = rhs.data();
+
+  x[0] /= diag[0];
+  for (size_t node = 1; node < nNodes; ++node) {
+    x[node] = (x[node] - lower[node] * x[node-1]) / diag[node];
+  }
+  for (size_t node = nNodes-1; node-- > 0;) {
+    x[node] -= upper[node] * x[node+1];
+  }
+}
+
+void
+LineSolver::solveNodesNewton(double vP, double vN)
+{
+  // Largest voltage change of a node per iteration is a tenth of the
+  //  applied voltages, so kinks of the cell curves are not jumped over
+  const double vRef = max(max(abs(vP), abs(vN)),
+                          max(max(abs(vUnselPL), abs(vUnselNL)), 1.));
+  const double maxStep = 0.1 * vRef;
+  const double vTolerance = 1e-9 * vRef;
+
+  size_t nNodes = nPLSegs + nNLSegs;
+  double* vPL = vPLSegs.data();
+  double* vNL = vNLSegs.data();
+  const double* delta = nodeDelta.data();
+
+  // Moves all nodes by factor * delta
+  auto stepNodes = [&](double factor) {
+    for (size_t PLSeg = 0; PLSeg < nPLSegs; ++PLSeg) {
+      vPL[PLSeg] += factor * delta[PLSeg];
+    }
+    for (size_t NLSeg = 0; NLSeg < nNLSegs; ++NLSeg) {
+      vNL[NLSeg] += factor * delta[nPLSegs + NLSeg];
+    }
+  };
+
+  if ( biasScheme == floating_bias ) {
+    updateFloatingVoltage();
+  }
+  double residual = buildNewtonSystem(vP, vN);
+
+  SolverGuard guard(limits, "Line solver");
+
+  while ( true ) {
+    guard.startIteration();
+    COUNT_SOLVER_ITERATION();
+    for (size_t node = 0; node < nNodes; ++node) {
+      nodeDelta[node] = -nodeResidual[node];
+    }
+    factorJacobian();
+    solveJacobian(nodeDelta);
+
+    double maxDelta = 0.;
+    for (size_t node = 0; node < nNodes; ++node) {
+      maxDelta = maxMagnitude(maxDelta, delta[node]);
+    }
+    guard.checkFinite(maxDelta / vRef);
+    double stepFactor = min(1., maxStep / maxDelta);
+    stepNodes(stepFactor);
+    double newResidual = buildNewtonSystem(vP, vN);
+
+    // Converged - the residual is down to rounding noise
+    //  A floating node is then moved to balance the new currents, and
+    //  the lines solved again until it stops moving
+    if ( maxDelta <= vTolerance ) {
+      if ( biasScheme != floating_bias ) {
+        return;
+      }
+      double lastVFloating = vUnselPL;
+      updateFloatingVoltage();
+      if ( abs(vUnselPL - lastVFloating) <= vTolerance ) {
+        return;
+      }
+      residual = buildNewtonSystem(vP, vN);
+      continue;
+    }
+
+    // A full step may take a node of a piecewise linear cell across a
+    //  kink and back on the next one - halve it while the largest node
+    //  residual grows
+    for (size_t halving = 0;
+         newResidual > residual && halving < 30; ++halving) {
+      stepFactor /= 2.;
+      stepNodes(-stepFactor);
+      newResidual = buildNewtonSystem(vP, vN);
+    }
+    residual = newResidual;
+  }
+}
+
+double
+LineSolver::calcVSelectedCellNewton(double vP, double vN)
+{
+  initializeLinesForVSC(vP, vN);
+
+  solveNodesNewton(vP, vN);
+
+  return vPLSegs[nPLSegs-1] - vNLSegs[0];
+}
+
+double
+LineSolver::calcVEdgeNewton(double vSC, bool trackBias)
+{
+  const double* vPL = vPLSegs.data();
+  const double* vNL = vNLSegs.data();
+  const double* gCell = nodeCellConductance.data();
+
+  double vP = initializeLinesForVEdge(vSC);
+
+  SolverGuard guard(limits, "Line solver");
+
+  // Newton on the driver voltage, each step solving all lines nodes
+  //  The sensitivity of the nodes to vP reuses the lines Jacobian
+  while ( true ) {
+    guard.startIteration();
+    if ( trackBias ) {
+      updateUnselectedVoltages(vP);
+    }
+    solveNodesNewton(vP, 0.);
+    double vSCGot = vPL[nPLSegs-1] - vNL[0];
+
+    // d(node currents)/d(vP), moved to the right hand side
+    fill(nodeDelta.begin(), nodeDelta.end(), 0.);
+    nodeDelta[0] = 1. / max(PAMUXResistance + PLResistancePerCell, 1e-6);
+    // A floating node is left out - its drift is picked up by the
+    //  following iterations
+    if ( trackBias && biasScheme != floating_bias ) {
+      double fPL = unselectedLineBias(biasScheme, true);
+      double fNL = unselectedLineBias(biasScheme, false);
+      for (size_t PLSeg = 0; PLSeg < nPLSegs-1; ++PLSeg) {
+        nodeDelta[PLSeg] += gCell[PLSeg] * fNL;
+      }
+      for (size_t NLSeg = 1; NLSeg < nNLSegs; ++NLSeg) {
+        nodeDelta[nPLSegs + NLSeg] += gCell[nPLSegs + NLSeg] * fPL;
+      }
+    }
+    factorJacobian();
+    solveJacobian(nodeDelta);
+    double dVSCdVP = nodeDelta[nPLSegs-1] - nodeDelta[nPLSegs];
+
+    if ( !(dVSCdVP > 0.) ) {
+      string exceptionMsgThrown("[ERROR] ");
+      exceptionMsgThrown.append("Unexpected behaviour - ");
+      exceptionMsgThrown.append("selected cell voltage does not increase");
+      exceptionMsgThrown.append(" with the driver voltage.\n");
+      throw exceptionMsgThrown;
+    }
+
+    double deltaVP = (vSC - vSCGot) / dVSCdVP;
+    vP += deltaVP;
+    guard.checkFinite(deltaVP / vP);
+
+    if ( abs(deltaVP) <= 1e-9 * abs(vP) ) {
+      if ( trackBias ) {
+        updateUnselectedVoltages(vP);
+      }
+      solveNodesNewton(vP, 0.);
+      return vP;
+    }
+  }
+}
+
+LineSolver::State
+LineSolver::getState() const
+{
+  State state;
+  if ( lastAppliedVoltage == INVALID_DOUBLE || lastAppliedVoltage <= 0. ) {
+    return state;
+  }
+
+  state.vPLCells.resize(nPLSegs);
+  state.vNLCells.resize(nNLSegs);
+  for (size_t PLSeg = 0; PLSeg < nPLSegs-1; ++PLSeg) {
+    state.vPLCells[PLSeg] = (vPLSegs[PLSeg] - vUnselNL) / lastAppliedVoltage;
+  }
+  for (size_t NLSeg = 1; NLSeg < nNLSegs; ++NLSeg) {
+    state.vNLCells[NLSeg] = (vUnselPL - vNLSegs[NLSeg]) / lastAppliedVoltage;
+  }
+  state.vNLCells[0] = (vPLSegs[nPLSegs-1] - vNLSegs[0]) / lastAppliedVoltage;
+  state.vPLCells[nPLSegs-1] = state.vNLCells[0];
+  return state;
+}
+
+// Linear interpolation of the half selected cells values of a line onto
+//  another number of cells, by relative position along the line
+//  The selected cell sits at the same end of both lines
+static void
+resampleLineCells(const vector<double>& from, vector<double>& to,
+                  bool selectedFirst)
+{
+  size_t nFrom = from.size() - 1;
+  size_t nTo = to.size() - 1;
+  size_t offset = selectedFirst ? 1 : 0;
+  to[selectedFirst ? 0 : nTo] = from[selectedFirst ? 0 : nFrom];
+
+  for (size_t cell = 0; cell < nTo; ++cell) {
+    if ( nFrom == 0 ) {
+      to[cell + offset] = 0.;
+      continue;
+    }
+    double position = (nTo == 1) ?
+                        0. : double(cell) * (nFrom - 1) / (nTo - 1);
+    size_t below = min(size_t(position), nFrom - 1);
+    size_t above = min(below + 1, nFrom - 1);
+    double weight = position - below;
+    to[cell + offset] = from[below + offset] * (1. - weight)
+                        + from[above + offset] * weight;
+  }
+}
+
+void
+LineSolver::setInitialState(const State& state)
+{
+  if ( state.vPLCells.empty() || state.vNLCells.empty() ) {
+    return;
+  }
+  checkSetup();
+
+  resampleLineCells(state.vPLCells, guessVPLCells, false);
+  resampleLineCells(state.vNLCells, guessVNLCells, true);
+  hasInitialState = true;
+}
+
+double
+LineSolver::getSCCurrent() const
+{
+  return iNLCells.front();
+}
+
+double
+LineSolver::getSPCurrent() const
+{
+  double SPCurrent = accumulate(iPLCells.begin(), iPLCells.end()-1, 0.);
+  SPCurrent += accumulate(iNLCells.begin()+1, iNLCells.end(), 0.);
+  return SPCurrent;
+}
+
+double
+LineSolver::getUCCurrent() const
+{
+  if ( unselectedCell == nullptr || nPLSegs < 1 || nNLSegs < 1 ) {
+    return 0.;
+  }
+  double nUnselectedCells = double(nPLSegs - 1) * double(nNLSegs - 1);
+  return nUnselectedCells
+         * abs(unselectedCell->getRawCellCurrent(vUnselPL - vUnselNL));
+}
+
+LineSolver::LineSolver()
+{
+  method = fixedPoint;
+  biasScheme = half_bias;
+  vUnselPL = 0.;
+  vUnselNL = 0.;
+
+  nPLSegs = 0;
+  nNLSegs = 0;
+
+  PAMUXResistance = INVALID_DOUBLE;
+  NAMUXResistance = INVALID_DOUBLE;
+  PLResistancePerCell = INVALID_DOUBLE;
+  NLResistancePerCell = INVALID_DOUBLE;
+
+  selectedCell = nullptr;
+  HSCellPL = nullptr;
+  HSCellNL = nullptr;
+  unselectedCell = nullptr;
+
+  hasInitialState = false;
+  lastAppliedVoltage = INVALID_DOUBLE;
+
+  acceleration = noAcceleration;
+  SORFactor = 1.2;
+  andersonDepth = 5;
+  andersonNSweeps = 0;
+  andersonNStored = 0;
+}
+
+LineSolver::~LineSolver()
+{
+
+}
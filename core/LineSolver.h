@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+#ifndef LINESOLVER_H
+#define LINESOLVER_H
+
+#include "../utils/constants.h"
+#include "../utils/functions.h"
+#include "../utils/SolverGuard.h"
+
+#include "../core/Cell.h"
+
+using namespace std;
+
+// Iterative solver for the two selected lines of a crosspoint array
+//  (PL, where the positive voltage is applied, and NL, the grounded one).
+// All state is kept in contiguous raw-double vectors in a single fixed
+//  unit system - volts, amperes and ohms - so the inner loops are free of
+//  unit conversions and bounds checks. Unit-checked quantities are only
+//  used by the caller (XPointArray), when entering and leaving the solver.
+class LineSolver
+{
+
+public:
+  // Fixed-point sweeps over the lines cells - each cell seeing the ones
+  //  updated before it (Gauss-Seidel) or all cells updated at once from
+  //  the last sweep (Jacobi) - or Newton-Raphson iterations over all
+  //  lines nodes at once
+  enum solverMethods { fixedPoint, jacobi, newton, INVALID_METHOD };
+
+  // Acceleration of the fixed-point (Gauss-Seidel) sweeps - successive
+  //  over-relaxation of each half selected cell current update, or
+  //  Anderson mixing of the lines state with the one of the last sweeps
+  enum accelerations { noAcceleration, sor, anderson,
+                       INVALID_ACCELERATION };
+
+  // Cell voltages along both lines after a solve, relative to the voltage
+  //  applied across the selected lines (vP - vN)
+  //  Given back to a later solve, possibly on lines of other lengths or
+  //  under another applied voltage, they are its initial guess
+  struct State {
+    vector<double> vPLCells;
+    vector<double> vNLCells;
+  };
+
+private:
+  solverMethods method;
+  biasSchemes biasScheme;
+  SolverLimits limits;
+
+  accelerations acceleration;
+  // Over-relaxation factor of the half selected cells currents updates
+  double SORFactor;
+  // Sweeps whose lines states are mixed
+  size_t andersonDepth;
+
+  // Voltages [V] of the unselected lines parallel to the PL and to the NL
+  //  HSCellNL cells hang between the NL and the former, HSCellPL cells
+  //  between the PL and the latter
+  double vUnselPL;
+  double vUnselNL;
+
+  // Line topology
+  size_t nPLSegs;
+  size_t nNLSegs;
+
+  // Resistances [ohm]
+  double PAMUXResistance;
+  double NAMUXResistance;
+  double PLResistancePerCell;
+  double NLResistancePerCell;
+
+  // Segment voltages [V] and cell currents [A]
+  vector<double> vPLSegs;
+  vector<double> iPLCells;
+  vector<double> vNLSegs;
+  vector<double> iNLCells;
+
+  // Accumulated resistance from each segment to its line driver [ohm]
+  vector<double> accRPL;
+  vector<double> accRNL;
+
+  // Initial guess from a previous solve, resampled onto these lines
+  bool hasInitialState;
+  vector<double> guessVPLCells;
+  vector<double> guessVNLCells;
+  // Voltage applied across the selected lines in the last solve [V]
+  double lastAppliedVoltage;
+
+  // Cells seen by the solver - not owned
+  const Cell* selectedCell;
+  const Cell* HSCellPL;
+  const Cell* HSCellNL;
+  // Cell between the unselected lines, if their leakage is wanted
+  const Cell* unselectedCell;
+
+  // Newton-Raphson state
+  // Nodes are ordered as all PL segments followed by all NL segments
+  //  so the selected cell couples the last PL node to the first NL one
+  //  and the Jacobian of the node currents is tridiagonal
+  vector<double> jacLower;
+  vector<double> jacDiag;
+  vector<double> jacUpper;
+  vector<double> nodeResidual;
+  vector<double> nodeDelta;
+  // Slope of the I-V curve of the cell hanging on each node [A/V]
+  vector<double> nodeCellConductance;
+
+  // Anderson mixing state
+  // The lines state is the cells currents [A], laid out as the Newton
+  //  nodes - the lines voltages follow from them. The state before a
+  //  sweep is kept in the Newton residual, the one after it in the Newton
+  //  step. Changes of the states after the sweeps (g) and of their
+  //  residuals (f, the change a sweep makes) are kept for the last
+  //  andersonDepth sweeps, one node-long column each, as a ring
+  vector<double> andersonResidual;
+  vector<double> andersonLastState;
+  vector<double> andersonLastResidual;
+  vector<double> andersonDeltaStates;
+  vector<double> andersonDeltaResiduals;
+  size_t andersonNSweeps;
+  size_t andersonNStored;
+
+  void checkSetup() const;
+
+  // Segment voltages [V] from the cell currents and the driver voltage [V]
+  void updateNLVoltages(double vN);
+  void updatePLVoltages(double vP);
+  // PL segment voltages [V] walking back from the selected cell, at vSC [V]
+  //  above the first NL segment - returns the PL driver voltage [V]
+  double updatePLVoltagesFromSC(double vSC);
+  // All half selected cells currents at once, from the segment voltages
+  //  Each current moves by the relaxation factor towards its new value
+  void updateHSCurrents(double relaxation);
+  // Cell currents from the guessed cell voltages, scaled to the voltage [V]
+  //  applied across the selected lines
+  void initializeGuessedCurrents(double vApplied);
+  // Initial lines state for each solve - either carrying only the selected
+  //  cell current or, when warm started, the guessed cell currents as well
+  //  Returns the driver voltage [V] matching vSC [V]
+  double initializeLinesForVEdge(double vSC);
+  void initializeLinesForVSC(double vP, double vN);
+
+  // Driven schemes - unselected lines follow the bias voltage [V]
+  void updateUnselectedVoltages(double vBias);
+  // Floating scheme - all unselected lines are lumped in a single node,
+  //  left at the voltage where the half selected cells currents balance
+  void updateFloatingVoltage();
+
+  double calcVEdgeFixedPoint(double vSC, bool trackBias);
+  double calcVSelectedCellFixedPoint(double vP, double vN);
+
+  // Anderson mixing - clears the sweeps kept, then, around each sweep,
+  //  keeps the state before it and mixes the state it left with the
+  //  states of the last sweeps, writing the mixed currents back
+  void startAnderson();
+  void keepSweepStart();
+  void mixAnderson();
+  // Counts an accelerated solve of the given iterations
+  void countAcceleratedSolve(size_t nIterations) const;
+
+  // Jacobi sweeps - the cells of a sweep are independent, so their
+  //  currents are evaluated in a single batch and the lines voltages
+  //  rebuilt from the accumulated currents
+  double calcVEdgeJacobi(double vSC, bool trackBias);
+  double calcVSelectedCellJacobi(double vP, double vN);
+  // Selected cell voltage [V] in series with rSeries [ohm] across vOpen [V]
+  //  vSC [V] is the initial guess
+  double solveSelectedCell(double vOpen, double rSeries, double vSC) const;
+
+  double calcVEdgeNewton(double vSC, bool trackBias);
+  double calcVSelectedCellNewton(double vP, double vN);
+
+  // Newton iterations on the node voltages, starting from the current
+  //  ones, until the lines currents balance for the given driver voltages
+  void solveNodesNewton(double vP, double vN);
+  // Fills cell currents, node current residuals and their Jacobian
+  //  Returns the largest residual [A]
+  double buildNewtonSystem(double vP, double vN);
+  // Thomas algorithm - solves the Jacobian system in place on rhs
+  //  Jacobian diagonals are overwritten by their factorization
+  void factorJacobian();
+  void solveJacobian(vector<double>& rhs) const;
+
+public:
+  LineSolver();
+  ~LineSolver();
+
+  // Sets lines lengths and resistances, (re)allocating and zeroing state
+  void setLines(size_t _nPLSegs, size_t _nNLSegs,
+                double _PLResistancePerCell, double _NLResistancePerCell,
+                double _PAMUXResistance, double _NAMUXResistance);
+  void setCells(const Cell* _selectedCell,
+                const Cell* _HSCellPL, const Cell* _HSCellNL,
+                const Cell* _unselectedCell = nullptr);
+
+  void setMethod(string);
+  string getMethod() const;
+
+  void setBiasScheme(biasSchemes);
+  biasSchemes getBiasScheme() const;
+
+  // Every solve failing on these limits throws the [ERROR] message string
+  void setLimits(const SolverLimits&);
+  const SolverLimits& getLimits() const;
+
+  // Set/Get the acceleration of the fixed-point method - "none", "sor" or
+  //  "anderson" - and its parameters
+  void setAcceleration(string);
+  string getAcceleration() const;
+  void setSORFactor(double);
+  double getSORFactor() const;
+  void setAndersonDepth(size_t);
+  size_t getAndersonDepth() const;
+
+  // Driver voltage [V] needed to get vSC [V] at the selected cell
+  //  Unselected lines are biased as a fraction of vBias, set by the bias
+  //  scheme. If trackBias, vBias follows the driver voltage,
+  //  otherwise it is kept fixed at the given value
+  double calcVEdge(double vSC, double vBias, bool trackBias);
+
+  // Selected cell voltage [V] given the driver voltages [V]
+  double calcVSelectedCell(double vP, double vBias, double vN);
+
+  State getState() const;
+  // Resamples a previous state onto the current lines - call after setLines
+  void setInitialState(const State&);
+
+  // Results of the last solve [A]
+  //  Unselected cell current sums the magnitudes of the cells between
+  //  the unselected lines, all at the same voltage in this model - none
+  //  without an unselected cell
+  double getSCCurrent() const;
+  double getSPCurrent() const;
+  double getUCCurrent() const;
+
+};
+#endif // LINESOLVER_H
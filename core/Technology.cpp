@@ -36,55 +36,63 @@
 
 #include "Technology.h"
 
+#include <map>
+#include <mutex>
+
 namespace bu=boost::units;
 namespace rrs=boost::units::rramspec;
 
 using namespace std;
 
+// Process-wide cache of the technologies built by fromTechFile, keyed by
+//  file name. Each one is kept with the stamp of its file when it was built
+static map<string, pair<string, Technology>> parsedTechnologies;
+static mutex parsedTechnologiesMutex;
+
 void
 Technology::initialize()
 {
-  technologyNode = INVALID_DOUBLE * rrs::nanometers;
+  technologyNode = INVALID_DOUBLE * rrs::meters;
 
   vcc = INVALID_DOUBLE * rrs::volts;
 
-  metalHalfPitch = INVALID_DOUBLE * rrs::nanometers;
-  metalThickness = INVALID_DOUBLE * rrs::nanometers;
+  metalHalfPitch = INVALID_DOUBLE * rrs::meters;
+  metalThickness = INVALID_DOUBLE * rrs::meters;
 
   metalResistivity = INVALID_DOUBLE * rrs::ohm_meters;
   metalSheetResistance = INVALID_DOUBLE * rrs::ohms;
-  metalResistancePerLength = INVALID_DOUBLE * rrs::ohms_per_nanometer;
+  metalResistancePerLength = INVALID_DOUBLE * rrs::ohms_per_meter;
 
-  metalCapacitancePerLength = INVALID_DOUBLE * rrs::nanofarads_per_meter;
+  metalCapacitancePerLength = INVALID_DOUBLE * rrs::farads_per_meter;
 
   substrateRelativePermittivity = INVALID_DOUBLE;
-  substrateAbsolutePermittivity = INVALID_DOUBLE * rrs::picofarads_per_meter;
+  substrateAbsolutePermittivity = INVALID_DOUBLE * rrs::farads_per_meter;
 
   breakdownVoltage = INVALID_DOUBLE * rrs::volts;
 
-  minPMOSChannelLength = INVALID_DOUBLE * rrs::nanometers;
-  minPMOSChannelWidth = INVALID_DOUBLE * rrs::nanometers;
-  minNMOSChannelLength = INVALID_DOUBLE * rrs::nanometers;
-  minNMOSChannelWidth = INVALID_DOUBLE * rrs::nanometers;
+  minPMOSChannelLength = INVALID_DOUBLE * rrs::meters;
+  minPMOSChannelWidth = INVALID_DOUBLE * rrs::meters;
+  minNMOSChannelLength = INVALID_DOUBLE * rrs::meters;
+  minNMOSChannelWidth = INVALID_DOUBLE * rrs::meters;
 
-  nMOSResistanceWidthProduct = INVALID_DOUBLE * rrs::nanoohm_meters;
-  pMOSResistanceWidthProduct = INVALID_DOUBLE * rrs::nanoohm_meters;
+  nMOSResistanceWidthProduct = INVALID_DOUBLE * rrs::ohm_meters;
+  pMOSResistanceWidthProduct = INVALID_DOUBLE * rrs::ohm_meters;
 
-  gateExtensionOfActive = INVALID_DOUBLE * rrs::nanometers;
-  polyToPolySpacing = INVALID_DOUBLE * rrs::nanometers;
-  activeExtensionOfPoly = INVALID_DOUBLE * rrs::nanometers;
-  activeToActiveSpacing = INVALID_DOUBLE * rrs::nanometers;
+  gateExtensionOfActive = INVALID_DOUBLE * rrs::meters;
+  polyToPolySpacing = INVALID_DOUBLE * rrs::meters;
+  activeExtensionOfPoly = INVALID_DOUBLE * rrs::meters;
+  activeToActiveSpacing = INVALID_DOUBLE * rrs::meters;
 
 }
 
 
 void
-Technology::setTechnologyNode(bu::quantity<rrs::nanometer_unit> node)
+Technology::setTechnologyNode(bu::quantity<rrs::meter_unit> node)
 {
   technologyNode = node;
 }
 
-bu::quantity<rrs::nanometer_unit> const &
+bu::quantity<rrs::meter_unit> const &
 Technology::getTechnologyNode() const
 {
   return this->technologyNode;
@@ -103,24 +111,24 @@ Technology::getVcc() const
 }
 
 void
-Technology::setMetalHalfPitch(bu::quantity<rrs::nanometer_unit> halfPitch)
+Technology::setMetalHalfPitch(bu::quantity<rrs::meter_unit> halfPitch)
 {
   metalHalfPitch = halfPitch;
 }
 
-bu::quantity<rrs::nanometer_unit> const &
+bu::quantity<rrs::meter_unit> const &
 Technology::getMetalHalfPitch() const
 {
   return this->metalHalfPitch;
 }
 
 void
-Technology::setMetalThickness(bu::quantity<rrs::nanometer_unit> thickness)
+Technology::setMetalThickness(bu::quantity<rrs::meter_unit> thickness)
 {
   metalThickness = thickness;
 }
 
-bu::quantity<rrs::nanometer_unit> const &
+bu::quantity<rrs::meter_unit> const &
 Technology::getMetalThickness() const
 {
   return this->metalThickness;
@@ -177,7 +185,8 @@ Technology::setMetalSheetResistance(bu::quantity<rrs::ohm_unit> resistance,
       exceptionMsgThrown.append(") based on the metal resistivity (");
       exceptionMsgThrown.append(to_string(metalResistivity));
       exceptionMsgThrown.append(") and the metal thickness (");
-      exceptionMsgThrown.append(to_string(metalThickness));
+      exceptionMsgThrown.append(to_string(
+          SCALE_QUANTITY(metalThickness, rrs::nanometer_unit)));
       exceptionMsgThrown.append("). Difference is ");
       exceptionMsgThrown.append(to_string(resistance - derivedRes));
       exceptionMsgThrown.append(".");
@@ -206,7 +215,7 @@ Technology::setMetalSheetResistance(bu::quantity<rrs::ohm_unit> resistance,
 void
 Technology::setMetalSheetResistance(
     bu::quantity<rrs::ohm_meter_unit> resistivity,
-    bu::quantity<rrs::nanometer_unit> thickness)
+    bu::quantity<rrs::meter_unit> thickness)
 {
   if ( !areValid( resistivity, thickness ) ) {
     string exceptionMsgThrown("[ERROR] ");
@@ -217,8 +226,7 @@ Technology::setMetalSheetResistance(
     exceptionMsgThrown.append(" not valid.");
     throw exceptionMsgThrown;
   }
-  metalSheetResistance = resistivity
-                         / SCALE_QUANTITY(thickness, rrs::meter_unit);
+  metalSheetResistance = resistivity / thickness;
 }
 
 bu::quantity<rrs::ohm_unit> const &
@@ -229,7 +237,7 @@ Technology::getMetalSheetResistance() const
 
 void
 Technology::setMetalResistancePerLength(
-    bu::quantity<rrs::ohm_per_nanometer_unit> resL,
+    bu::quantity<rrs::ohm_per_meter_unit> resL,
     settingOptions setOpt)
 {
   if ( isInvalid(resL) ) { return; }
@@ -242,7 +250,7 @@ Technology::setMetalResistancePerLength(
   metalSheetResistance = metalResistancePerLength * metalHalfPitch;
 }
 
-bu::quantity<rrs::ohm_per_nanometer_unit> const &
+bu::quantity<rrs::ohm_per_meter_unit> const &
 Technology::getMetalResistancePerLength() const
 {
   return this->metalResistancePerLength;
@@ -252,12 +260,12 @@ Technology::getMetalResistancePerLength() const
 
 void
 Technology::setMetalCapacitancePerLength(
-    bu::quantity<rrs::nanofarad_per_meter_unit> capL)
+    bu::quantity<rrs::farad_per_meter_unit> capL)
 {
   metalCapacitancePerLength = capL;
 }
 
-bu::quantity<rrs::nanofarad_per_meter_unit> const &
+bu::quantity<rrs::farad_per_meter_unit> const &
 Technology::getMetalCapacitancePerLength() const
 {
   return this->metalCapacitancePerLength;
@@ -280,7 +288,7 @@ Technology::getSubsRelPermtvt() const
 
 void
 Technology::setSubsAbsPermtvt (
-    bu::quantity<rrs::picofarad_per_meter_unit> absPermittivity,
+    bu::quantity<rrs::farad_per_meter_unit> absPermittivity,
     settingOptions setOpt)
 {
   // If forced, ignore all tests
@@ -316,13 +324,17 @@ Technology::setSubsAbsPermtvt (
       string exceptionMsgThrown("[ERROR] ");
       exceptionMsgThrown.append("Inconsistent data.");
       exceptionMsgThrown.append(" Substrate absolute permittivity given (");
-      exceptionMsgThrown.append(to_string(absPermittivity));
+      exceptionMsgThrown.append(to_string(
+          SCALE_QUANTITY(absPermittivity, rrs::picofarad_per_meter_unit)));
       exceptionMsgThrown.append(") does not match with calculated (");
-      exceptionMsgThrown.append(to_string(derivedPermtvt));
+      exceptionMsgThrown.append(to_string(
+          SCALE_QUANTITY(derivedPermtvt, rrs::picofarad_per_meter_unit)));
       exceptionMsgThrown.append(") based on the relative permittivity (");
       exceptionMsgThrown.append(to_string(substrateRelativePermittivity));
       exceptionMsgThrown.append("). Difference is ");
-      exceptionMsgThrown.append(to_string(absPermittivity - derivedPermtvt));
+      exceptionMsgThrown.append(to_string(
+          SCALE_QUANTITY(absPermittivity - derivedPermtvt,
+                         rrs::picofarad_per_meter_unit)));
       exceptionMsgThrown.append(".");
       throw exceptionMsgThrown;
     }
@@ -356,11 +368,11 @@ Technology::setSubsAbsPermtvt(bu::quantity<rrs::dimensionless> relPer)
     exceptionMsgThrown.append(" not valid.");
     throw exceptionMsgThrown;
   }
-  substrateAbsolutePermittivity = relPer * 8.8541878*rrs::picofarads_per_meter;
+  substrateAbsolutePermittivity = relPer * 8.8541878e-12*rrs::farads_per_meter;
 }
 
 
-bu::quantity<rrs::picofarad_per_meter_unit> const &
+bu::quantity<rrs::farad_per_meter_unit> const &
 Technology::getSubsAbsPermtvt() const
 {
   return this->substrateAbsolutePermittivity;
@@ -383,48 +395,48 @@ Technology::getBreakdownVoltage() const
 
 
 void
-Technology::setMinPMOSChannelLength(bu::quantity<rrs::nanometer_unit> length)
+Technology::setMinPMOSChannelLength(bu::quantity<rrs::meter_unit> length)
 {
   minPMOSChannelLength = length;
 }
 
-bu::quantity<rrs::nanometer_unit> const &
+bu::quantity<rrs::meter_unit> const &
 Technology::getMinPMOSChannelLength() const
 {
   return this->minPMOSChannelLength;
 }
 
 void
-Technology::setMinPMOSChannelWidth(bu::quantity<rrs::nanometer_unit> width)
+Technology::setMinPMOSChannelWidth(bu::quantity<rrs::meter_unit> width)
 {
   minPMOSChannelWidth = width;
 }
 
-bu::quantity<rrs::nanometer_unit> const &
+bu::quantity<rrs::meter_unit> const &
 Technology::getMinPMOSChannelWidth() const
 {
   return this->minPMOSChannelWidth;
 }
 
 void
-Technology::setMinNMOSChannelLength(bu::quantity<rrs::nanometer_unit> length)
+Technology::setMinNMOSChannelLength(bu::quantity<rrs::meter_unit> length)
 {
   minNMOSChannelLength = length;
 }
 
-bu::quantity<rrs::nanometer_unit> const &
+bu::quantity<rrs::meter_unit> const &
 Technology::getMinNMOSChannelLength() const
 {
   return this->minNMOSChannelLength;
 }
 
 void
-Technology::setMinNMOSChannelWidth(bu::quantity<rrs::nanometer_unit> width)
+Technology::setMinNMOSChannelWidth(bu::quantity<rrs::meter_unit> width)
 {
   minNMOSChannelWidth = width;
 }
 
-bu::quantity<rrs::nanometer_unit> const &
+bu::quantity<rrs::meter_unit> const &
 Technology::getMinNMOSChannelWidth() const
 {
   return this->minNMOSChannelWidth;
@@ -433,24 +445,24 @@ Technology::getMinNMOSChannelWidth() const
 
 
 void
-Technology::setNMOSResWidthProduct(bu::quantity<rrs::microohm_meter_unit> prod)
+Technology::setNMOSResWidthProduct(bu::quantity<rrs::ohm_meter_unit> prod)
 {
-  nMOSResistanceWidthProduct = SCALE_QUANTITY(prod, rrs::nanoohm_meter_unit);
+  nMOSResistanceWidthProduct = prod;
 }
 
-bu::quantity<rrs::nanoohm_meter_unit> const &
+bu::quantity<rrs::ohm_meter_unit> const &
 Technology::getNMOSResWidthProduct() const
 {
   return this->nMOSResistanceWidthProduct;
 }
 
 void
-Technology::setPMOSResWidthProduct(bu::quantity<rrs::microohm_meter_unit> prod)
+Technology::setPMOSResWidthProduct(bu::quantity<rrs::ohm_meter_unit> prod)
 {
-  pMOSResistanceWidthProduct = SCALE_QUANTITY(prod, rrs::nanoohm_meter_unit);
+  pMOSResistanceWidthProduct = prod;
 }
 
-bu::quantity<rrs::nanoohm_meter_unit> const &
+bu::quantity<rrs::ohm_meter_unit> const &
 Technology::getPMOSResWidthProduct() const
 {
   return this->pMOSResistanceWidthProduct;
@@ -458,48 +470,48 @@ Technology::getPMOSResWidthProduct() const
 
 
 void
-Technology::setGateExtensionOfActive(bu::quantity<rrs::nanometer_unit> length)
+Technology::setGateExtensionOfActive(bu::quantity<rrs::meter_unit> length)
 {
   gateExtensionOfActive = length;
 }
 
-bu::quantity<rrs::nanometer_unit> const &
+bu::quantity<rrs::meter_unit> const &
 Technology::getGateExtensionOfActive() const
 {
   return this->gateExtensionOfActive;
 }
 
 void
-Technology::setPolyToPolySpacing(bu::quantity<rrs::nanometer_unit> length)
+Technology::setPolyToPolySpacing(bu::quantity<rrs::meter_unit> length)
 {
   polyToPolySpacing = length;
 }
 
-bu::quantity<rrs::nanometer_unit> const &
+bu::quantity<rrs::meter_unit> const &
 Technology::getPolyToPolySpacing() const
 {
   return this->polyToPolySpacing;
 }
 
 void
-Technology::setActiveExtensionOfPoly(bu::quantity<rrs::nanometer_unit> length)
+Technology::setActiveExtensionOfPoly(bu::quantity<rrs::meter_unit> length)
 {
   activeExtensionOfPoly = length;
 }
 
-bu::quantity<rrs::nanometer_unit> const &
+bu::quantity<rrs::meter_unit> const &
 Technology::getActiveExtensionOfPoly() const
 {
   return this->activeExtensionOfPoly;
 }
 
 void
-Technology::setActiveToActiveSpacing(bu::quantity<rrs::nanometer_unit> length)
+Technology::setActiveToActiveSpacing(bu::quantity<rrs::meter_unit> length)
 {
   activeToActiveSpacing = length;
 }
 
-bu::quantity<rrs::nanometer_unit> const &
+bu::quantity<rrs::meter_unit> const &
 Technology::getActiveToActiveSpacing() const
 {
   return this->activeToActiveSpacing;
@@ -508,15 +520,17 @@ Technology::getActiveToActiveSpacing() const
 
 
 void
-Technology::buildFromTechFile(const char* techFileName)
+Technology::buildFromTechFile(const char* techFileName,
+                              const string& techJSON)
 {
-  JsonAssist jsonTech(techFileName);
+  JsonAssist jsonTech(techFileName, techJSON);
 
   double magnitude = INVALID_DOUBLE;
 
   magnitude = jsonTech.getJSONNumber("Technology node [nm]",
                                         mandatory);
-  setTechnologyNode( magnitude * rrs::nanometers );
+  setTechnologyNode(SCALE_QUANTITY(magnitude * rrs::nanometers,
+                                   rrs::meter_unit));
 
   magnitude = jsonTech.getJSONNumber("Vcc [V]",
                                         mandatory);
@@ -524,11 +538,13 @@ Technology::buildFromTechFile(const char* techFileName)
 
   magnitude = jsonTech.getJSONNumber("Metal half pitch [nm]",
                                         mandatory);
-  setMetalHalfPitch( magnitude * rrs::nanometers );
+  setMetalHalfPitch(SCALE_QUANTITY(magnitude * rrs::nanometers,
+                                   rrs::meter_unit));
 
   magnitude = jsonTech.getJSONNumber("Metal thickness [nm]",
                                         mandatory);
-  setMetalThickness( magnitude * rrs::nanometers );
+  setMetalThickness(SCALE_QUANTITY(magnitude * rrs::nanometers,
+                                   rrs::meter_unit));
 
   magnitude = jsonTech.getJSONNumber("Metal resistivity [Ohm m]",
                                         optional);
@@ -540,11 +556,15 @@ Technology::buildFromTechFile(const char* techFileName)
 
   magnitude = jsonTech.getJSONNumber("Metal resistance per length [Ohm/nm]",
                                         optional);
-  setMetalResistancePerLength( magnitude * rrs::ohms_per_nanometer );
+  setMetalResistancePerLength(SCALE_QUANTITY(magnitude
+                                             * rrs::ohms_per_nanometer,
+                                             rrs::ohm_per_meter_unit));
 
   magnitude = jsonTech.getJSONNumber("Metal capacitance per length [aF/nm]",
                                         optional);
-  setMetalCapacitancePerLength( magnitude * rrs::nanofarads_per_meter );
+  setMetalCapacitancePerLength(SCALE_QUANTITY(magnitude
+                                              * rrs::nanofarads_per_meter,
+                                              rrs::farad_per_meter_unit));
 
   magnitude = jsonTech.getJSONNumber("Substrate relative permittivity []",
                                         optional);
@@ -552,7 +572,8 @@ Technology::buildFromTechFile(const char* techFileName)
 
   magnitude = jsonTech.getJSONNumber("Substrate absolute permittivity [pF/m]",
                                         optional);
-  setSubsAbsPermtvt( magnitude * rrs::picofarads_per_meter );
+  setSubsAbsPermtvt(SCALE_QUANTITY(magnitude * rrs::picofarads_per_meter,
+                                   rrs::farad_per_meter_unit));
 
   magnitude = jsonTech.getJSONNumber("MOS breakdown voltage [V]",
                                         mandatory);
@@ -560,47 +581,57 @@ Technology::buildFromTechFile(const char* techFileName)
 
   magnitude = jsonTech.getJSONNumber("Minimum PMOS channel length [nm]",
                                         mandatory);
-  setMinPMOSChannelLength( magnitude * rrs::nanometers );
+  setMinPMOSChannelLength(SCALE_QUANTITY(magnitude * rrs::nanometers,
+                                         rrs::meter_unit));
 
   magnitude = jsonTech.getJSONNumber("Minimum PMOS channel width [nm]",
                                         mandatory);
-  setMinPMOSChannelWidth( magnitude * rrs::nanometers );
+  setMinPMOSChannelWidth(SCALE_QUANTITY(magnitude * rrs::nanometers,
+                                        rrs::meter_unit));
 
   magnitude = jsonTech.getJSONNumber("Minimum NMOS channel length [nm]",
                                         mandatory);
-  setMinNMOSChannelLength( magnitude * rrs::nanometers );
+  setMinNMOSChannelLength(SCALE_QUANTITY(magnitude * rrs::nanometers,
+                                         rrs::meter_unit));
 
   magnitude = jsonTech.getJSONNumber("Minimum NMOS channel width [nm]",
                                         mandatory);
-  setMinNMOSChannelWidth( magnitude * rrs::nanometers );
+  setMinNMOSChannelWidth(SCALE_QUANTITY(magnitude * rrs::nanometers,
+                                        rrs::meter_unit));
 
   magnitude = jsonTech.getJSONNumber(
         "Minimum length NMOS resistance-width product"
         " [kohm_nm]",
         mandatory);
-  setNMOSResWidthProduct( magnitude * rrs::microohm_meters );
+  setNMOSResWidthProduct(SCALE_QUANTITY(magnitude * rrs::microohm_meters,
+                                        rrs::ohm_meter_unit));
 
   magnitude = jsonTech.getJSONNumber(
         "Minimum length PMOS resistance-width product"
         " [kohm_nm]",
         mandatory);
-  setPMOSResWidthProduct( magnitude * rrs::microohm_meters );
+  setPMOSResWidthProduct(SCALE_QUANTITY(magnitude * rrs::microohm_meters,
+                                        rrs::ohm_meter_unit));
 
   magnitude = jsonTech.getJSONNumber("Gate extension of active layer [nm]",
                                         mandatory);
-  setGateExtensionOfActive( magnitude * rrs::nanometers );
+  setGateExtensionOfActive(SCALE_QUANTITY(magnitude * rrs::nanometers,
+                                          rrs::meter_unit));
 
   magnitude = jsonTech.getJSONNumber("Poly to poly spacing [nm]",
                                         mandatory);
-  setPolyToPolySpacing( magnitude * rrs::nanometers );
+  setPolyToPolySpacing(SCALE_QUANTITY(magnitude * rrs::nanometers,
+                                      rrs::meter_unit));
 
   magnitude = jsonTech.getJSONNumber("Active layer extension of poly [nm]",
                                         mandatory);
-  setActiveExtensionOfPoly( magnitude * rrs::nanometers );
+  setActiveExtensionOfPoly(SCALE_QUANTITY(magnitude * rrs::nanometers,
+                                          rrs::meter_unit));
 
   magnitude = jsonTech.getJSONNumber("Active to active spacing [nm]",
                                         mandatory);
-  setActiveToActiveSpacing( magnitude * rrs::nanometers );
+  setActiveToActiveSpacing(SCALE_QUANTITY(magnitude * rrs::nanometers,
+                                          rrs::meter_unit));
 
 }
 
@@ -611,18 +642,42 @@ Technology::Technology()
   initialize();
 }
 
-Technology::Technology(const char* techFileName)
+Technology::Technology(const char* techFileName, const string& techJSON)
 {
   initialize();
 
   try {
-    buildFromTechFile(techFileName);
+    buildFromTechFile(techFileName, techJSON);
   } catch(string exceptionMsgThrown) {
     throw exceptionMsgThrown;
   }
 
 }
 
+Technology
+Technology::fromTechFile(const char* techFileName, const string& techJSON)
+{
+  if ( !techJSON.empty() ) {
+    return Technology(techFileName, techJSON);
+  }
+
+  string stamp = fileStamp(techFileName);
+  {
+    lock_guard<mutex> lock(parsedTechnologiesMutex);
+    auto parsed = parsedTechnologies.find(techFileName);
+    if ( parsed != parsedTechnologies.end() && !stamp.empty()
+         && parsed->second.first == stamp ) {
+      return parsed->second.second;
+    }
+  }
+
+  Technology tech(techFileName);
+
+  lock_guard<mutex> lock(parsedTechnologiesMutex);
+  parsedTechnologies[techFileName] = make_pair(stamp, tech);
+  return tech;
+}
+
 Technology::~Technology()
 {
 
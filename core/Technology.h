@@ -53,63 +53,68 @@ class Technology
 {
 
 private:
-  bu::quantity<rrs::nanometer_unit> technologyNode;
+  bu::quantity<rrs::meter_unit> technologyNode;
 
   bu::quantity<rrs::volt_unit> vcc;
 
   // Metal (WLs and BLs) parameters
-  bu::quantity<rrs::nanometer_unit> metalHalfPitch;
-  bu::quantity<rrs::nanometer_unit> metalThickness;
+  bu::quantity<rrs::meter_unit> metalHalfPitch;
+  bu::quantity<rrs::meter_unit> metalThickness;
 
   bu::quantity<rrs::ohm_meter_unit> metalResistivity;
   bu::quantity<rrs::ohm_unit> metalSheetResistance;
-  bu::quantity<rrs::ohm_per_nanometer_unit> metalResistancePerLength;
+  bu::quantity<rrs::ohm_per_meter_unit> metalResistancePerLength;
 
 
   // Substrate parameters (for capacitances calculation)
-  bu::quantity<rrs::nanofarad_per_meter_unit> metalCapacitancePerLength;
+  bu::quantity<rrs::farad_per_meter_unit> metalCapacitancePerLength;
   bu::quantity<rrs::dimensionless> substrateRelativePermittivity;
-  bu::quantity<rrs::picofarad_per_meter_unit> substrateAbsolutePermittivity;
+  bu::quantity<rrs::farad_per_meter_unit> substrateAbsolutePermittivity;
 
   // Array periphery transistor parameters
   bu::quantity<rrs::volt_unit> breakdownVoltage;
 
-  bu::quantity<rrs::nanometer_unit> minPMOSChannelLength;
-  bu::quantity<rrs::nanometer_unit> minPMOSChannelWidth;
-  bu::quantity<rrs::nanometer_unit> minNMOSChannelLength;
-  bu::quantity<rrs::nanometer_unit> minNMOSChannelWidth;
+  bu::quantity<rrs::meter_unit> minPMOSChannelLength;
+  bu::quantity<rrs::meter_unit> minPMOSChannelWidth;
+  bu::quantity<rrs::meter_unit> minNMOSChannelLength;
+  bu::quantity<rrs::meter_unit> minNMOSChannelWidth;
 
-  bu::quantity<rrs::nanoohm_meter_unit> nMOSResistanceWidthProduct;
-  bu::quantity<rrs::nanoohm_meter_unit> pMOSResistanceWidthProduct;
+  bu::quantity<rrs::ohm_meter_unit> nMOSResistanceWidthProduct;
+  bu::quantity<rrs::ohm_meter_unit> pMOSResistanceWidthProduct;
 
   // Technology design rules
-  bu::quantity<rrs::nanometer_unit> gateExtensionOfActive;
-  bu::quantity<rrs::nanometer_unit> polyToPolySpacing;
-  bu::quantity<rrs::nanometer_unit> activeExtensionOfPoly;
-  bu::quantity<rrs::nanometer_unit> activeToActiveSpacing;
+  bu::quantity<rrs::meter_unit> gateExtensionOfActive;
+  bu::quantity<rrs::meter_unit> polyToPolySpacing;
+  bu::quantity<rrs::meter_unit> activeExtensionOfPoly;
+  bu::quantity<rrs::meter_unit> activeToActiveSpacing;
 
 
   // Private setters
   void setMetalSheetResistance(bu::quantity<rrs::ohm_meter_unit>,
-                               bu::quantity<rrs::nanometer_unit>);
+                               bu::quantity<rrs::meter_unit>);
   void setSubsAbsPermtvt(bu::quantity<rrs::dimensionless>);
 
 public:
   Technology();
-  Technology(const char*);
+  // Technology described by the text, or by the file when it is empty
+  Technology(const char*, const string& techJSON = "");
   ~Technology();
+  // Technology built from the file - a copy of the last one built from it
+  //  while the file is unchanged, so each file is parsed once per process.
+  //  A description given in techJSON is parsed each time instead
+  static Technology fromTechFile(const char*, const string& techJSON = "");
 
   void initialize();
-  void buildFromTechFile(const char*);
+  void buildFromTechFile(const char*, const string& techJSON = "");
 
-  void setTechnologyNode(bu::quantity<rrs::nanometer_unit>);
-  bu::quantity<rrs::nanometer_unit> const &getTechnologyNode() const;
+  void setTechnologyNode(bu::quantity<rrs::meter_unit>);
+  bu::quantity<rrs::meter_unit> const &getTechnologyNode() const;
   void setVcc(bu::quantity<rrs::volt_unit>);
   bu::quantity<rrs::volt_unit> const &getVcc() const;
-  void setMetalHalfPitch(bu::quantity<rrs::nanometer_unit>);
-  bu::quantity<rrs::nanometer_unit> const &getMetalHalfPitch() const;
-  void setMetalThickness(bu::quantity<rrs::nanometer_unit>);
-  bu::quantity<rrs::nanometer_unit> const &getMetalThickness() const;
+  void setMetalHalfPitch(bu::quantity<rrs::meter_unit>);
+  bu::quantity<rrs::meter_unit> const &getMetalHalfPitch() const;
+  void setMetalThickness(bu::quantity<rrs::meter_unit>);
+  bu::quantity<rrs::meter_unit> const &getMetalThickness() const;
 
   void setMetalResistivity(bu::quantity<rrs::ohm_meter_unit>);
   bu::quantity<rrs::ohm_meter_unit> const &getMetalResistivity() const;
@@ -117,48 +122,48 @@ public:
                                settingOptions setOpt = normal_opt);
   bu::quantity<rrs::ohm_unit> const &getMetalSheetResistance() const;
   void setMetalResistancePerLength(
-      bu::quantity<rrs::ohm_per_nanometer_unit>,
+      bu::quantity<rrs::ohm_per_meter_unit>,
       settingOptions setOpt = normal_opt);
-  bu::quantity<rrs::ohm_per_nanometer_unit>
+  bu::quantity<rrs::ohm_per_meter_unit>
       const &getMetalResistancePerLength() const;
 
   void setMetalCapacitancePerLength(
-      bu::quantity<rrs::nanofarad_per_meter_unit>);
-  bu::quantity<rrs::nanofarad_per_meter_unit>
+      bu::quantity<rrs::farad_per_meter_unit>);
+  bu::quantity<rrs::farad_per_meter_unit>
       const &getMetalCapacitancePerLength() const;
 
   void setSubsRelPermtvt(bu::quantity<rrs::dimensionless>);
   bu::quantity<rrs::dimensionless> const &getSubsRelPermtvt() const;
-  void setSubsAbsPermtvt(bu::quantity<rrs::picofarad_per_meter_unit>,
+  void setSubsAbsPermtvt(bu::quantity<rrs::farad_per_meter_unit>,
                          settingOptions setOpt = normal_opt);
-  bu::quantity<rrs::picofarad_per_meter_unit> const &getSubsAbsPermtvt() const;
+  bu::quantity<rrs::farad_per_meter_unit> const &getSubsAbsPermtvt() const;
 
   // Thick oxide transistor parameters
   void setBreakdownVoltage(bu::quantity<rrs::volt_unit>);
   bu::quantity<rrs::volt_unit> const &getBreakdownVoltage() const;
 
-  void setMinPMOSChannelLength(bu::quantity<rrs::nanometer_unit>);
-  bu::quantity<rrs::nanometer_unit> const &getMinPMOSChannelLength() const;
-  void setMinPMOSChannelWidth(bu::quantity<rrs::nanometer_unit>);
-  bu::quantity<rrs::nanometer_unit> const &getMinPMOSChannelWidth() const;
-  void setMinNMOSChannelLength(bu::quantity<rrs::nanometer_unit>);
-  bu::quantity<rrs::nanometer_unit> const &getMinNMOSChannelLength() const;
-  void setMinNMOSChannelWidth(bu::quantity<rrs::nanometer_unit>);
-  bu::quantity<rrs::nanometer_unit> const &getMinNMOSChannelWidth() const;
-
-  void setNMOSResWidthProduct(bu::quantity<rrs::microohm_meter_unit>);
-  bu::quantity<rrs::nanoohm_meter_unit> const &getNMOSResWidthProduct() const;
-  void setPMOSResWidthProduct(bu::quantity<rrs::microohm_meter_unit>);
-  bu::quantity<rrs::nanoohm_meter_unit> const &getPMOSResWidthProduct() const;
-
-  void setGateExtensionOfActive(bu::quantity<rrs::nanometer_unit>);
-  bu::quantity<rrs::nanometer_unit> const &getGateExtensionOfActive() const;
-  void setPolyToPolySpacing(bu::quantity<rrs::nanometer_unit>);
-  bu::quantity<rrs::nanometer_unit> const &getPolyToPolySpacing() const;
-  void setActiveExtensionOfPoly(bu::quantity<rrs::nanometer_unit>);
-  bu::quantity<rrs::nanometer_unit> const &getActiveExtensionOfPoly() const;
-  void setActiveToActiveSpacing(bu::quantity<rrs::nanometer_unit>);
-  bu::quantity<rrs::nanometer_unit> const &getActiveToActiveSpacing() const;
+  void setMinPMOSChannelLength(bu::quantity<rrs::meter_unit>);
+  bu::quantity<rrs::meter_unit> const &getMinPMOSChannelLength() const;
+  void setMinPMOSChannelWidth(bu::quantity<rrs::meter_unit>);
+  bu::quantity<rrs::meter_unit> const &getMinPMOSChannelWidth() const;
+  void setMinNMOSChannelLength(bu::quantity<rrs::meter_unit>);
+  bu::quantity<rrs::meter_unit> const &getMinNMOSChannelLength() const;
+  void setMinNMOSChannelWidth(bu::quantity<rrs::meter_unit>);
+  bu::quantity<rrs::meter_unit> const &getMinNMOSChannelWidth() const;
+
+  void setNMOSResWidthProduct(bu::quantity<rrs::ohm_meter_unit>);
+  bu::quantity<rrs::ohm_meter_unit> const &getNMOSResWidthProduct() const;
+  void setPMOSResWidthProduct(bu::quantity<rrs::ohm_meter_unit>);
+  bu::quantity<rrs::ohm_meter_unit> const &getPMOSResWidthProduct() const;
+
+  void setGateExtensionOfActive(bu::quantity<rrs::meter_unit>);
+  bu::quantity<rrs::meter_unit> const &getGateExtensionOfActive() const;
+  void setPolyToPolySpacing(bu::quantity<rrs::meter_unit>);
+  bu::quantity<rrs::meter_unit> const &getPolyToPolySpacing() const;
+  void setActiveExtensionOfPoly(bu::quantity<rrs::meter_unit>);
+  bu::quantity<rrs::meter_unit> const &getActiveExtensionOfPoly() const;
+  void setActiveToActiveSpacing(bu::quantity<rrs::meter_unit>);
+  bu::quantity<rrs::meter_unit> const &getActiveToActiveSpacing() const;
 
 };
 #endif //TECHNOLOGY_H
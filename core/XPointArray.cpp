@@ -41,19 +41,62 @@ namespace rrs=boost::units::rramspec;
 
 using namespace std;
 
+namespace {
+
+// Stages of the solves held by a result cache record
+const uint64_t cachedWriteStage = 1;
+const uint64_t cachedReadStage = 2;
+
+// Position of each solver result in a result cache record
+enum cachedValueIDs {
+  cachedResetVoltage, cachedSetVoltage,
+  cachedResetSCCurrent, cachedResetSPCurrent,
+  cachedSetSCCurrent, cachedSetSPCurrent,
+  cachedReadVoltage,
+  cachedReadHRSSCCurrent, cachedReadHRSSPCurrent,
+  cachedReadLRSSCCurrent, cachedReadLRSSPCurrent,
+  cachedResetUCCurrent, cachedSetUCCurrent,
+  cachedReadHRSUCCurrent, cachedReadLRSUCCurrent,
+  nCachedValues
+};
+static_assert(nCachedValues <= ResultCache::nRecordValues,
+              "Solver results do not fit a result cache record");
+
+// Name of the operation in the trace events
+const char* operationName(rramOperations op)
+{
+  switch (op) {
+    case read_op:             return "read";
+    case read_hrs_op:         return "read HRS";
+    case read_lrs_op:         return "read LRS";
+    case write_op:            return "write";
+    case set_op:              return "set";
+    case reset_op:            return "reset";
+    case half_select:         return "half select";
+    case precharge_op:        return "precharge";
+    case calib_wr_all_hrs_op: return "calibration write all HRS";
+    case calib_wr_all_lrs_op: return "calibration write all LRS";
+    case calib_rd_all_hrs_op: return "calibration read all HRS";
+    case calib_rd_all_lrs_op: return "calibration read all LRS";
+    default:                  return "any";
+  }
+}
+
+}
+
 void
 XPointArray::initialize()
 {
-  WLMetalWidth = INVALID_DOUBLE * rrs::nanometers;
-  BLMetalWidth = INVALID_DOUBLE * rrs::nanometers;
+  WLMetalWidth = INVALID_DOUBLE * rrs::meters;
+  BLMetalWidth = INVALID_DOUBLE * rrs::meters;
 
-  heightwiseCellPitch = INVALID_DOUBLE * rrs::nanometers;
-  widthwiseCellPitch = INVALID_DOUBLE * rrs::nanometers;
-  area4F2 = INVALID_DOUBLE * rrs::square_nanometers;
+  heightwiseCellPitch = INVALID_DOUBLE * rrs::meters;
+  widthwiseCellPitch = INVALID_DOUBLE * rrs::meters;
+  area4F2 = INVALID_DOUBLE * rrs::square_meters;
 
-  height = INVALID_DOUBLE * rrs::nanometers;
-  width = INVALID_DOUBLE * rrs::nanometers;
-  area = INVALID_DOUBLE * rrs::square_nanometers;
+  height = INVALID_DOUBLE * rrs::meters;
+  width = INVALID_DOUBLE * rrs::meters;
+  area = INVALID_DOUBLE * rrs::square_meters;
   areaEfficiency = INVALID_DOUBLE;
 
   nCols = INVALID_DOUBLE;
@@ -63,13 +106,13 @@ XPointArray::initialize()
 
   WLResistancePerCell = INVALID_DOUBLE * rrs::ohms;
   BLResistancePerCell = INVALID_DOUBLE * rrs::ohms;
-  WLCapacitancePerCell = INVALID_DOUBLE * rrs::attofarads;
-  BLCapacitancePerCell = INVALID_DOUBLE * rrs::attofarads;
+  WLCapacitancePerCell = INVALID_DOUBLE * rrs::farads;
+  BLCapacitancePerCell = INVALID_DOUBLE * rrs::farads;
 
-  WLResistancePerLength = INVALID_DOUBLE * rrs::ohms_per_nanometer;
-  BLResistancePerLength = INVALID_DOUBLE * rrs::ohms_per_nanometer;
-  WLCapacitancePerLength = INVALID_DOUBLE * rrs::nanofarads_per_meter;
-  BLCapacitancePerLength = INVALID_DOUBLE * rrs::nanofarads_per_meter;
+  WLResistancePerLength = INVALID_DOUBLE * rrs::ohms_per_meter;
+  BLResistancePerLength = INVALID_DOUBLE * rrs::ohms_per_meter;
+  WLCapacitancePerLength = INVALID_DOUBLE * rrs::farads_per_meter;
+  BLCapacitancePerLength = INVALID_DOUBLE * rrs::farads_per_meter;
 
   WLWriteDriverResistance = INVALID_DOUBLE * rrs::ohms;
   BLWriteDriverResistance = INVALID_DOUBLE * rrs::ohms;
@@ -83,44 +126,55 @@ XPointArray::initialize()
   writeVoltage = INVALID_DOUBLE * rrs::volts;
   readVoltage = INVALID_DOUBLE * rrs::volts;
 
-  adjWLDelay = INVALID_DOUBLE * rrs::nanoseconds;
-  adjBLDelay = INVALID_DOUBLE * rrs::nanoseconds;
-  adjLineMaxDelay = INVALID_DOUBLE * rrs::nanoseconds;
-  WLDelay = INVALID_DOUBLE * rrs::nanoseconds;
-  BLDelay = INVALID_DOUBLE * rrs::nanoseconds;
-  lineMaxDelay = INVALID_DOUBLE * rrs::nanoseconds;
-
-  prechargeTime = INVALID_DOUBLE * rrs::nanoseconds;
-  calibrationDelay = INVALID_DOUBLE * rrs::nanoseconds;
-  setTime = INVALID_DOUBLE * rrs::nanoseconds;
-  resetTime = INVALID_DOUBLE * rrs::nanoseconds;
-  writeTime = INVALID_DOUBLE * rrs::nanoseconds;
-  readTime = INVALID_DOUBLE * rrs::nanoseconds;
-
-  prechargeCurrent = INVALID_DOUBLE * rrs::nanoamperes;
-
-  setSCCurrent = INVALID_DOUBLE * rrs::nanoamperes;
-  setSPCurrent = INVALID_DOUBLE * rrs::nanoamperes;
-  setCurrent = INVALID_DOUBLE * rrs::nanoamperes;
-  resetSCCurrent = INVALID_DOUBLE * rrs::nanoamperes;
-  resetSPCurrent = INVALID_DOUBLE * rrs::nanoamperes;
-  resetCurrent = INVALID_DOUBLE * rrs::nanoamperes;
-  writeCurrent = INVALID_DOUBLE * rrs::nanoamperes;
-
-  readHRSSCCurrent = INVALID_DOUBLE * rrs::nanoamperes;
-  readHRSSPCurrent = INVALID_DOUBLE * rrs::nanoamperes;
-  readLRSSCCurrent = INVALID_DOUBLE * rrs::nanoamperes;
-  readLRSSPCurrent = INVALID_DOUBLE * rrs::nanoamperes;
-  readCurrent = INVALID_DOUBLE * rrs::nanoamperes;
-
-  prechargeEnergy = INVALID_DOUBLE * rrs::picojoules;
-  writeEnergy = INVALID_DOUBLE * rrs::picojoules;
-  readEnergy = INVALID_DOUBLE * rrs::picojoules;
+  arrayModel = lumped;
+  biasScheme = half_bias;
+
+  adjWLDelay = INVALID_DOUBLE * rrs::seconds;
+  adjBLDelay = INVALID_DOUBLE * rrs::seconds;
+  adjLineMaxDelay = INVALID_DOUBLE * rrs::seconds;
+  WLDelay = INVALID_DOUBLE * rrs::seconds;
+  BLDelay = INVALID_DOUBLE * rrs::seconds;
+  lineMaxDelay = INVALID_DOUBLE * rrs::seconds;
+
+  prechargeTime = INVALID_DOUBLE * rrs::seconds;
+  calibrationDelay = INVALID_DOUBLE * rrs::seconds;
+  setTime = INVALID_DOUBLE * rrs::seconds;
+  resetTime = INVALID_DOUBLE * rrs::seconds;
+  writeTime = INVALID_DOUBLE * rrs::seconds;
+  readTime = INVALID_DOUBLE * rrs::seconds;
+
+  prechargeCurrent = INVALID_DOUBLE * rrs::amperes;
+
+  setSCCurrent = INVALID_DOUBLE * rrs::amperes;
+  setSPCurrent = INVALID_DOUBLE * rrs::amperes;
+  setUCCurrent = INVALID_DOUBLE * rrs::amperes;
+  setCurrent = INVALID_DOUBLE * rrs::amperes;
+  resetSCCurrent = INVALID_DOUBLE * rrs::amperes;
+  resetSPCurrent = INVALID_DOUBLE * rrs::amperes;
+  resetUCCurrent = INVALID_DOUBLE * rrs::amperes;
+  resetCurrent = INVALID_DOUBLE * rrs::amperes;
+  writeCurrent = INVALID_DOUBLE * rrs::amperes;
+
+  readHRSSCCurrent = INVALID_DOUBLE * rrs::amperes;
+  readHRSSPCurrent = INVALID_DOUBLE * rrs::amperes;
+  readHRSUCCurrent = INVALID_DOUBLE * rrs::amperes;
+  readLRSSCCurrent = INVALID_DOUBLE * rrs::amperes;
+  readLRSSPCurrent = INVALID_DOUBLE * rrs::amperes;
+  readLRSUCCurrent = INVALID_DOUBLE * rrs::amperes;
+  readCurrent = INVALID_DOUBLE * rrs::amperes;
+
+  prechargeEnergy = INVALID_DOUBLE * rrs::joules;
+  writeEnergy = INVALID_DOUBLE * rrs::joules;
+  readEnergy = INVALID_DOUBLE * rrs::joules;
+
+  cachedResults.key = 0;
+  cachedResults.stages = 0;
+  writeOperationRestored = false;
 
 }
 
 void
-XPointArray::setWLMetalWidth(bu::quantity<rrs::nanometer_unit> width,
+XPointArray::setWLMetalWidth(bu::quantity<rrs::meter_unit> width,
                              settingOptions setOpt)
 {
   WLMetalWidth = width;
@@ -134,11 +188,12 @@ XPointArray::setWLMetalWidth(bu::quantity<rrs::nanometer_unit> width,
     WLMetalWidth = width;
   }
   else {
-    WLMetalWidth = INVALID_DOUBLE * rrs::nanometers;
+    WLMetalWidth = INVALID_DOUBLE * rrs::meters;
 
     string exceptionMsgThrown("[ERROR] ");
     exceptionMsgThrown.append("Wordline metal width (");
-    exceptionMsgThrown.append(to_string(width));
+    exceptionMsgThrown.append(to_string(
+        SCALE_QUANTITY(width, rrs::nanometer_unit)));
     exceptionMsgThrown.append(") is too narrow");
     exceptionMsgThrown.append(" for given technology and cell.");
     throw exceptionMsgThrown;
@@ -157,7 +212,7 @@ XPointArray::updateWLMetalWidth()
   }
 }
 
-bu::quantity<rrs::nanometer_unit> const &
+bu::quantity<rrs::meter_unit> const &
 XPointArray::getWLMetalWidth() const
 {
   return this->WLMetalWidth;
@@ -165,7 +220,7 @@ XPointArray::getWLMetalWidth() const
 
 
 void
-XPointArray::setBLMetalWidth(bu::quantity<rrs::nanometer_unit> width,
+XPointArray::setBLMetalWidth(bu::quantity<rrs::meter_unit> width,
                              settingOptions setOpt)
 {
   BLMetalWidth = width;
@@ -179,11 +234,12 @@ XPointArray::setBLMetalWidth(bu::quantity<rrs::nanometer_unit> width,
     BLMetalWidth = width;
   }
   else {
-    BLMetalWidth = INVALID_DOUBLE * rrs::nanometers;
+    BLMetalWidth = INVALID_DOUBLE * rrs::meters;
 
     string exceptionMsgThrown("[ERROR] ");
     exceptionMsgThrown.append("Bitline metal width (");
-    exceptionMsgThrown.append(to_string(width));
+    exceptionMsgThrown.append(to_string(
+        SCALE_QUANTITY(width, rrs::nanometer_unit)));
     exceptionMsgThrown.append(") is too narrow");
     exceptionMsgThrown.append(" for given technology and cell.");
     throw exceptionMsgThrown;
@@ -203,7 +259,7 @@ XPointArray::updateBLMetalWidth()
   }
 }
 
-bu::quantity<rrs::nanometer_unit> const &
+bu::quantity<rrs::meter_unit> const &
 XPointArray::getBLMetalWidth() const
 {
   return this->BLMetalWidth;
@@ -215,7 +271,7 @@ void
 XPointArray::updateHeightwiseCellPitch()
 {
   if ( !areValid(WLMetalWidth) ) {
-    heightwiseCellPitch = INVALID_DOUBLE * rrs::nanometers;
+    heightwiseCellPitch = INVALID_DOUBLE * rrs::meters;
 
     string exceptionMsgThrown("[ERROR] ");
     exceptionMsgThrown.append("Unexpected behaviour - ");
@@ -238,7 +294,7 @@ XPointArray::updateHeightwiseCellPitch()
   }
 }
 
-bu::quantity<rrs::nanometer_unit> const &
+bu::quantity<rrs::meter_unit> const &
 XPointArray::getHeightwiseCellPitch() const
 {
   return this->heightwiseCellPitch;
@@ -248,7 +304,7 @@ void
 XPointArray::updateWidthwiseCellPitch()
 {
   if ( !areValid(BLMetalWidth) ) {
-    widthwiseCellPitch = INVALID_DOUBLE * rrs::nanometers;
+    widthwiseCellPitch = INVALID_DOUBLE * rrs::meters;
 
     string exceptionMsgThrown("[ERROR] ");
     exceptionMsgThrown.append("Unexpected behaviour - ");
@@ -272,7 +328,7 @@ XPointArray::updateWidthwiseCellPitch()
 
 }
 
-bu::quantity<rrs::nanometer_unit> const &
+bu::quantity<rrs::meter_unit> const &
 XPointArray::getWidthwiseCellPitch() const
 {
   return this->widthwiseCellPitch;
@@ -282,7 +338,7 @@ void
 XPointArray::updateArea4F2()
 {
   if ( !areValid(nRows, nCols, heightwiseCellPitch, widthwiseCellPitch) ) {
-    area4F2 = INVALID_DOUBLE * rrs::square_nanometers;
+    area4F2 = INVALID_DOUBLE * rrs::square_meters;
 
     string exceptionMsgThrown("[ERROR] ");
     exceptionMsgThrown.append("Unexpected behaviour - ");
@@ -302,7 +358,7 @@ XPointArray::updateArea4F2()
   area4F2 = width * height;
 }
 
-bu::quantity<rrs::square_nanometer_unit> const &
+bu::quantity<rrs::square_meter_unit> const &
 XPointArray::getArea4F2() const
 {
   return this->area4F2;
@@ -311,7 +367,7 @@ XPointArray::getArea4F2() const
 
 
 void
-XPointArray::setArea(bu::quantity<rrs::square_nanometer_unit> arrayArea,
+XPointArray::setArea(bu::quantity<rrs::square_meter_unit> arrayArea,
                                settingOptions setOpt)
 {
   area = arrayArea;
@@ -333,17 +389,19 @@ XPointArray::setArea(bu::quantity<rrs::square_nanometer_unit> arrayArea,
       else {
         string exceptionMsgThrown("[ERROR] ");
         exceptionMsgThrown.append("Crosspoint array area given (");
-        exceptionMsgThrown.append(to_string(area));
+        exceptionMsgThrown.append(to_string(
+            SCALE_QUANTITY(area, rrs::square_nanometer_unit)));
         exceptionMsgThrown.append(") is too small");
         exceptionMsgThrown.append(" to fit a ");
         exceptionMsgThrown.append(to_string((int)nRows));
         exceptionMsgThrown.append(" x ");
         exceptionMsgThrown.append(to_string((int)nCols));
         exceptionMsgThrown.append(" cells array (");
-        exceptionMsgThrown.append(to_string(area4F2));
+        exceptionMsgThrown.append(to_string(
+            SCALE_QUANTITY(area4F2, rrs::square_nanometer_unit)));
         exceptionMsgThrown.append(").");
 
-        area = INVALID_DOUBLE * rrs::square_nanometers;
+        area = INVALID_DOUBLE * rrs::square_meters;
 
         throw exceptionMsgThrown;
       }
@@ -364,19 +422,19 @@ XPointArray::updateArea()
   areaEfficiency = area4F2 / area;
 }
 
-bu::quantity<rrs::square_nanometer_unit> const &
+bu::quantity<rrs::square_meter_unit> const &
 XPointArray::getArea() const
 {
   return this->area;
 }
 
-bu::quantity<rrs::nanometer_unit> const &
+bu::quantity<rrs::meter_unit> const &
 XPointArray::getHeight() const
 {
   return this->height;
 }
 
-bu::quantity<rrs::nanometer_unit> const &
+bu::quantity<rrs::meter_unit> const &
 XPointArray::getWidth() const
 {
   return this->width;
@@ -549,7 +607,7 @@ void
 XPointArray::updateWLResistancePerLength()
 {
   if ( !areValid(WLMetalWidth) ) {
-    WLResistancePerLength = INVALID_DOUBLE * rrs::ohms_per_nanometer;
+    WLResistancePerLength = INVALID_DOUBLE * rrs::ohms_per_meter;
     string exceptionMsgThrown("[ERROR] ");
     exceptionMsgThrown.append("Unexpected behaviour - ");
     exceptionMsgThrown.append("Tried to update the");
@@ -564,7 +622,7 @@ XPointArray::updateWLResistancePerLength()
   WLResistancePerLength = tech.getMetalSheetResistance() / WLMetalWidth;
 }
 
-bu::quantity<rrs::ohm_per_nanometer_unit> const &
+bu::quantity<rrs::ohm_per_meter_unit> const &
 XPointArray::getWLResistancePerLength() const
 {
   return this->WLResistancePerLength;
@@ -575,7 +633,7 @@ void
 XPointArray::updateBLResistancePerLength()
 {
   if ( !areValid(BLMetalWidth) ) {
-    BLResistancePerLength = INVALID_DOUBLE * rrs::ohms_per_nanometer;
+    BLResistancePerLength = INVALID_DOUBLE * rrs::ohms_per_meter;
     string exceptionMsgThrown("[ERROR] ");
     exceptionMsgThrown.append("Unexpected behaviour - ");
     exceptionMsgThrown.append("Tried to update the");
@@ -590,7 +648,7 @@ XPointArray::updateBLResistancePerLength()
   BLResistancePerLength = tech.getMetalSheetResistance() / BLMetalWidth;
 }
 
-bu::quantity<rrs::ohm_per_nanometer_unit> const &
+bu::quantity<rrs::ohm_per_meter_unit> const &
 XPointArray::getBLResistancePerLength() const
 {
   return this->BLResistancePerLength;
@@ -601,7 +659,7 @@ void
 XPointArray::updateWLCapacitancePerLength()
 {
   if ( !areValid(WLMetalWidth) ) {
-    WLCapacitancePerLength = INVALID_DOUBLE * rrs::nanofarads_per_meter;
+    WLCapacitancePerLength = INVALID_DOUBLE * rrs::farads_per_meter;
     string exceptionMsgThrown("[ERROR] ");
     exceptionMsgThrown.append("Unexpected behaviour - ");
     exceptionMsgThrown.append("Tried to update the");
@@ -617,7 +675,7 @@ XPointArray::updateWLCapacitancePerLength()
                              * WLMetalWidth / tech.getMetalHalfPitch();
 }
 
-bu::quantity<rrs::nanofarad_per_meter_unit> const &
+bu::quantity<rrs::farad_per_meter_unit> const &
 XPointArray::getWLCapacitancePerLength() const
 {
   return this->WLCapacitancePerLength;
@@ -628,7 +686,7 @@ void
 XPointArray::updateBLCapacitancePerLength()
 {
   if ( !areValid(BLMetalWidth) ) {
-    BLCapacitancePerLength = INVALID_DOUBLE * rrs::nanofarads_per_meter;
+    BLCapacitancePerLength = INVALID_DOUBLE * rrs::farads_per_meter;
     string exceptionMsgThrown("[ERROR] ");
     exceptionMsgThrown.append("Unexpected behaviour - ");
     exceptionMsgThrown.append("Tried to update the");
@@ -644,7 +702,7 @@ XPointArray::updateBLCapacitancePerLength()
                              * BLMetalWidth / tech.getMetalHalfPitch();
 }
 
-bu::quantity<rrs::nanofarad_per_meter_unit> const &
+bu::quantity<rrs::farad_per_meter_unit> const &
 XPointArray::getBLCapacitancePerLength() const
 {
   return this->BLCapacitancePerLength;
@@ -710,7 +768,7 @@ void
 XPointArray::updateWLCapacitancePerCell()
 {
   if ( !areValid(WLCapacitancePerLength, widthwiseCellPitch) ) {
-    WLCapacitancePerCell = INVALID_DOUBLE * rrs::attofarads;
+    WLCapacitancePerCell = INVALID_DOUBLE * rrs::farads;
     string exceptionMsgThrown("[ERROR] ");
     exceptionMsgThrown.append("Unexpected behaviour - ");
     exceptionMsgThrown.append("Tried to update the");
@@ -726,7 +784,7 @@ XPointArray::updateWLCapacitancePerCell()
   WLCapacitancePerCell = WLCapacitancePerLength * widthwiseCellPitch;
 }
 
-bu::quantity<rrs::attofarad_unit> const &
+bu::quantity<rrs::farad_unit> const &
 XPointArray::getWLCapacitancePerCell() const
 {
   return this->WLCapacitancePerCell;
@@ -737,7 +795,7 @@ void
 XPointArray::updateBLCapacitancePerCell()
 {
   if ( !areValid(BLCapacitancePerLength, heightwiseCellPitch) ) {
-    BLCapacitancePerCell = INVALID_DOUBLE * rrs::attofarads;
+    BLCapacitancePerCell = INVALID_DOUBLE * rrs::farads;
     string exceptionMsgThrown("[ERROR] ");
     exceptionMsgThrown.append("Unexpected behaviour - ");
     exceptionMsgThrown.append("Tried to update the");
@@ -753,7 +811,7 @@ XPointArray::updateBLCapacitancePerCell()
   BLCapacitancePerCell = BLCapacitancePerLength * heightwiseCellPitch;
 }
 
-bu::quantity<rrs::attofarad_unit> const &
+bu::quantity<rrs::farad_unit> const &
 XPointArray::getBLCapacitancePerCell() const
 {
   return this->BLCapacitancePerCell;
@@ -854,29 +912,29 @@ XPointArray::updateAdjLineDelays()
 
   double percentage = 95.;
   adjWLDelay = tausToPercentLumpedRC(percentage) * totalAdjWLRes
-      * SCALE_QUANTITY(totalAdjWLCap, rrs::nanofarad_unit);
+      * totalAdjWLCap;
   adjWLDelay += tausToPercentSingleRC(percentage) * LDOResistance
-      * SCALE_QUANTITY(totalAdjWLCap, rrs::nanofarad_unit);
+      * totalAdjWLCap;
   adjBLDelay = tausToPercentLumpedRC(percentage) * totalAdjBLRes
-      * SCALE_QUANTITY(totalAdjBLCap, rrs::nanofarad_unit);
+      * totalAdjBLCap;
   adjBLDelay += tausToPercentSingleRC(percentage) * LDOResistance
-      * SCALE_QUANTITY(totalAdjBLCap, rrs::nanofarad_unit);
+      * totalAdjBLCap;
   adjLineMaxDelay = max(adjWLDelay, adjBLDelay);
 }
 
-bu::quantity<rrs::nanosecond_unit> const &
+bu::quantity<rrs::second_unit> const &
 XPointArray::getAdjLineMaxDelay() const
 {
   return this->adjLineMaxDelay;
 }
 
-bu::quantity<rrs::nanosecond_unit> const &
+bu::quantity<rrs::second_unit> const &
 XPointArray::getAdjWLDelay() const
 {
   return this->adjWLDelay;
 }
 
-bu::quantity<rrs::nanosecond_unit> const &
+bu::quantity<rrs::second_unit> const &
 XPointArray::getAdjBLDelay() const
 {
   return this->adjBLDelay;
@@ -895,33 +953,33 @@ XPointArray::updateLineDelays()
 
   double percentage = 95.;
   WLDelay = tausToPercentLumpedRC(percentage) * totalWLRes
-      * SCALE_QUANTITY(totalWLCap, rrs::nanofarad_unit);
+      * totalWLCap;
   WLDelay += tausToPercentSingleRC(percentage)
-      * SCALE_QUANTITY(totalWLCap, rrs::nanofarad_unit)
+      * totalWLCap
       * ( LDOResistance + totalAdjWLRes + halfBiasDriverResistance );
 
   BLDelay = tausToPercentLumpedRC(percentage) * totalBLRes
-      * SCALE_QUANTITY(totalBLCap, rrs::nanofarad_unit);
+      * totalBLCap;
   BLDelay += tausToPercentSingleRC(percentage)
-      * SCALE_QUANTITY(totalBLCap, rrs::nanofarad_unit)
+      * totalBLCap
       * ( LDOResistance + totalAdjBLRes + halfBiasDriverResistance );
 
   lineMaxDelay = max(WLDelay, BLDelay);
 }
 
-bu::quantity<rrs::nanosecond_unit> const &
+bu::quantity<rrs::second_unit> const &
 XPointArray::getLineMaxDelay() const
 {
   return this->lineMaxDelay;
 }
 
-bu::quantity<rrs::nanosecond_unit> const &
+bu::quantity<rrs::second_unit> const &
 XPointArray::getWLDelay() const
 {
   return this->WLDelay;
 }
 
-bu::quantity<rrs::nanosecond_unit> const &
+bu::quantity<rrs::second_unit> const &
 XPointArray::getBLDelay() const
 {
   return this->BLDelay;
@@ -933,7 +991,7 @@ XPointArray::updateCalibrationDelay()
   calibrationDelay = adjLineMaxDelay + lineMaxDelay + currentSensingDelay;
 }
 
-bu::quantity<rrs::nanosecond_unit> const &
+bu::quantity<rrs::second_unit> const &
 XPointArray::getCalibrationDelay() const
 {
   return this->calibrationDelay;
@@ -950,12 +1008,11 @@ XPointArray::updatePrechargeTime()
   double percentage = 95.;
   // During precharge, the precharge LDO must provide current for all lines
   prechargeTime = tausToPercentSingleRC(percentage) * LDOResistance *
-      ( SCALE_QUANTITY(totalWLCap * nRows, rrs::nanofarad_unit)
-        + SCALE_QUANTITY(totalBLCap * nCols, rrs::nanofarad_unit) );
+      ( totalWLCap * nRows + totalBLCap * nCols );
   prechargeTime += adjLineMaxDelay + lineMaxDelay;
 }
 
-bu::quantity<rrs::nanosecond_unit> const &
+bu::quantity<rrs::second_unit> const &
 XPointArray::getPrechargeTime() const
 {
   return this->prechargeTime;
@@ -972,19 +1029,19 @@ XPointArray::updateWriteTime()
   writeTime = max(setTime, resetTime);
 }
 
-bu::quantity<rrs::nanosecond_unit> const &
+bu::quantity<rrs::second_unit> const &
 XPointArray::getWriteTime() const
 {
   return this->writeTime;
 }
 
-bu::quantity<rrs::nanosecond_unit> const &
+bu::quantity<rrs::second_unit> const &
 XPointArray::getSetTime() const
 {
   return this->setTime;
 }
 
-bu::quantity<rrs::nanosecond_unit> const &
+bu::quantity<rrs::second_unit> const &
 XPointArray::getResetTime() const
 {
   return this->resetTime;
@@ -999,7 +1056,7 @@ XPointArray::updateReadTime()
   readTime += currentSensingDelay;
 }
 
-bu::quantity<rrs::nanosecond_unit> const &
+bu::quantity<rrs::second_unit> const &
 XPointArray::getReadTime() const
 {
   return this->readTime;
@@ -1010,54 +1067,70 @@ XPointArray::getReadTime() const
 void
 XPointArray::updatePrechargeCurrent()
 {
-  auto vHalfWrite = writeVoltage/2.;
-  auto vHalfRead = readVoltage/2.;
-  auto deltaV = vHalfWrite - vHalfRead;
+  // Unselected lines bias as during a set - WLs parallel to the PL
+  double WLBias = unselectedLineBias(biasScheme, true);
+  double BLBias = unselectedLineBias(biasScheme, false);
+  auto deltaVWL = writeVoltage*WLBias - readVoltage*WLBias;
+  auto deltaVBL = writeVoltage*BLBias - readVoltage*BLBias;
   auto totalWLCap = WLCapacitancePerLength * width;
   auto totalBLCap = BLCapacitancePerLength * height;
-  auto totalCap = SCALE_QUANTITY(totalWLCap + totalBLCap, rrs::attofarad_unit);
 
-  prechargeCurrent = totalCap * deltaV / prechargeTime;
+  prechargeCurrent = ( totalWLCap*deltaVWL + totalBLCap*deltaVBL )
+                     / prechargeTime;
+  // Unselected cells leak as soon as the lines are biased
+  prechargeCurrent += max(readHRSUCCurrent, readLRSUCCurrent);
 }
 
-bu::quantity<rrs::nanoampere_unit> const &
+bu::quantity<rrs::ampere_unit> const &
 XPointArray::getPrechargeCurrent() const
 {
   return this->prechargeCurrent;
 }
 
 
-bu::quantity<rrs::nanoampere_unit> const &
+bu::quantity<rrs::ampere_unit> const &
 XPointArray::getSetSCCurrent() const
 {
   return this->setSCCurrent;
 }
 
-bu::quantity<rrs::nanoampere_unit> const &
+bu::quantity<rrs::ampere_unit> const &
 XPointArray::getSetSPCurrent() const
 {
   return this->setSPCurrent;
 }
 
-bu::quantity<rrs::nanoampere_unit> const &
+bu::quantity<rrs::ampere_unit> const &
+XPointArray::getSetUCCurrent() const
+{
+  return this->setUCCurrent;
+}
+
+bu::quantity<rrs::ampere_unit> const &
 XPointArray::getSetCurrent() const
 {
   return this->setCurrent;
 }
 
-bu::quantity<rrs::nanoampere_unit> const &
+bu::quantity<rrs::ampere_unit> const &
 XPointArray::getResetSCCurrent() const
 {
   return this->resetSCCurrent;
 }
 
-bu::quantity<rrs::nanoampere_unit> const &
+bu::quantity<rrs::ampere_unit> const &
 XPointArray::getResetSPCurrent() const
 {
   return this->resetSPCurrent;
 }
 
-bu::quantity<rrs::nanoampere_unit> const &
+bu::quantity<rrs::ampere_unit> const &
+XPointArray::getResetUCCurrent() const
+{
+  return this->resetUCCurrent;
+}
+
+bu::quantity<rrs::ampere_unit> const &
 XPointArray::getResetCurrent() const
 {
   return this->resetCurrent;
@@ -1071,53 +1144,65 @@ XPointArray::updateWriteCurrent()
   setCurrent = ( iSCBeforeSet * selectedCell.getCellSetTime()
                   + iSCAfterSet * (writeTime - selectedCell.getCellSetTime()) )
                 / writeTime;
-  setCurrent += setSPCurrent;
+  setCurrent += setSPCurrent + setUCCurrent;
 
-  resetCurrent = resetSCCurrent + resetSPCurrent;
+  resetCurrent = resetSCCurrent + resetSPCurrent + resetUCCurrent;
 
   writeCurrent = max(setCurrent, resetCurrent);
 }
 
-bu::quantity<rrs::nanoampere_unit> const &
+bu::quantity<rrs::ampere_unit> const &
 XPointArray::getWriteCurrent() const
 {
   return this->writeCurrent;
 }
 
 
-bu::quantity<rrs::nanoampere_unit> const &
+bu::quantity<rrs::ampere_unit> const &
 XPointArray::getReadHRSSCCurrent() const
 {
   return this->readHRSSCCurrent;
 }
 
-bu::quantity<rrs::nanoampere_unit> const &
+bu::quantity<rrs::ampere_unit> const &
 XPointArray::getReadHRSSPCurrent() const
 {
   return this->readHRSSPCurrent;
 }
 
-bu::quantity<rrs::nanoampere_unit> const &
+bu::quantity<rrs::ampere_unit> const &
+XPointArray::getReadHRSUCCurrent() const
+{
+  return this->readHRSUCCurrent;
+}
+
+bu::quantity<rrs::ampere_unit> const &
 XPointArray::getReadLRSSCCurrent() const
 {
   return this->readLRSSCCurrent;
 }
 
-bu::quantity<rrs::nanoampere_unit> const &
+bu::quantity<rrs::ampere_unit> const &
 XPointArray::getReadLRSSPCurrent() const
 {
   return this->readLRSSPCurrent;
 }
 
+bu::quantity<rrs::ampere_unit> const &
+XPointArray::getReadLRSUCCurrent() const
+{
+  return this->readLRSUCCurrent;
+}
+
 void
 XPointArray::updateReadCurrent()
 {
-  auto readHRSCurrent = readHRSSCCurrent + readHRSSPCurrent;
-  auto readLRSCurrent = readLRSSCCurrent + readLRSSPCurrent;
+  auto readHRSCurrent = readHRSSCCurrent + readHRSSPCurrent + readHRSUCCurrent;
+  auto readLRSCurrent = readLRSSCCurrent + readLRSSPCurrent + readLRSUCCurrent;
   readCurrent = max(readHRSCurrent, readLRSCurrent);
 }
 
-bu::quantity<rrs::nanoampere_unit> const &
+bu::quantity<rrs::ampere_unit> const &
 XPointArray::getReadCurrent() const
 {
   return this->readCurrent;
@@ -1128,17 +1213,25 @@ XPointArray::getReadCurrent() const
 void
 XPointArray::updatePrechargeEnergy()
 {
-  auto vHalfWriteSquared = writeVoltage/2. * writeVoltage/2.;
-  auto vHalfReadSquared = readVoltage/2. * readVoltage/2.;
-  auto deltaSquaredV = vHalfWriteSquared - vHalfReadSquared;
+  double WLBias = unselectedLineBias(biasScheme, true);
+  double BLBias = unselectedLineBias(biasScheme, false);
+  auto deltaSquaredVWL = writeVoltage*WLBias * writeVoltage*WLBias
+                         - readVoltage*WLBias * readVoltage*WLBias;
+  auto deltaSquaredVBL = writeVoltage*BLBias * writeVoltage*BLBias
+                         - readVoltage*BLBias * readVoltage*BLBias;
   auto totalWLsCap = WLCapacitancePerLength * width * nRows;
   auto totalBLsCap = BLCapacitancePerLength * height * nCols;
-  auto totalCap = SCALE_QUANTITY(totalWLsCap+totalBLsCap, rrs::picofarad_unit);
 
-  prechargeEnergy = totalCap * deltaSquaredV / 2.;
+  prechargeEnergy =
+      ( totalWLsCap * deltaSquaredVWL
+      + totalBLsCap * deltaSquaredVBL )
+      / 2.;
+  auto leakagePower = max(readHRSUCCurrent, readLRSUCCurrent)
+                      * tech.getBreakdownVoltage();
+  prechargeEnergy += leakagePower * prechargeTime;
 }
 
-bu::quantity<rrs::picojoule_unit> const &
+bu::quantity<rrs::joule_unit> const &
 XPointArray::getPrechargeEnergy() const
 {
   return this->prechargeEnergy;
@@ -1153,15 +1246,19 @@ XPointArray::updateWriteEnergy()
   auto totalBLCap = BLCapacitancePerLength * height;
   auto totalLineCap = totalAdjWLCap + totalAdjBLCap + totalWLCap + totalBLCap;
 
-  auto dynamicEnergy = SCALE_QUANTITY(totalLineCap, rrs::picofarad_unit) *
-      (writeVoltage * writeVoltage - writeVoltage * writeVoltage/2.);
+  // Selected PL swings from its unselected bias
+  double PLBias = unselectedLineBias(biasScheme, true);
+  auto dynamicEnergy = totalLineCap *
+      (writeVoltage * writeVoltage - writeVoltage * writeVoltage*PLBias);
+  dynamicEnergy += max(calcUnselectedNLsEnergy(writeVoltage, set_op),
+                       calcUnselectedNLsEnergy(writeVoltage, reset_op));
   auto writePower = writeCurrent * tech.getBreakdownVoltage();
 
   writeEnergy = dynamicEnergy;
-  writeEnergy += SCALE_QUANTITY(writePower * writeTime, rrs::picojoule_unit);
+  writeEnergy += writePower * writeTime;
 }
 
-bu::quantity<rrs::picojoule_unit> const &
+bu::quantity<rrs::joule_unit> const &
 XPointArray::getWriteEnergy() const
 {
   return this->writeEnergy;
@@ -1176,44 +1273,152 @@ XPointArray::updateReadEnergy()
   auto totalBLCap = BLCapacitancePerLength * height;
   auto totalLineCap = totalAdjWLCap + totalAdjBLCap + totalWLCap + totalBLCap;
 
-  auto dynamicEnergy = SCALE_QUANTITY(totalLineCap, rrs::picofarad_unit) *
-      (readVoltage * readVoltage - readVoltage * writeVoltage/2.);
+  double PLBias = unselectedLineBias(biasScheme, true);
+  auto dynamicEnergy = totalLineCap *
+      (readVoltage * readVoltage - readVoltage * writeVoltage*PLBias);
+  // Unselected lines are kept at their write bias while reading
+  dynamicEnergy += calcUnselectedNLsEnergy(writeVoltage, read_lrs_op);
   auto readPower = readCurrent * tech.getBreakdownVoltage();
 
   readEnergy = dynamicEnergy;
-  readEnergy += SCALE_QUANTITY(readPower * readTime, rrs::picojoule_unit);
+  readEnergy += readPower * readTime;
 }
 
-bu::quantity<rrs::picojoule_unit> const &
+bu::quantity<rrs::joule_unit> const &
 XPointArray::getReadEnergy() const
 {
   return this->readEnergy;
 }
 
+bu::quantity<rrs::joule_unit>
+XPointArray::calcUnselectedNLsEnergy(bu::quantity<rrs::volt_unit> vBias,
+                                     rramOperations op) const
+{
+  // NL is BL but on reset
+  auto totalUnselNLsCap = BLCapacitancePerLength * height
+                          * (nCols.value() - 1.);
+  if ( op == reset_op ) {
+    totalUnselNLsCap = WLCapacitancePerLength * width
+                       * (nRows.value() - 1.);
+  }
+
+  double PLBias = unselectedLineBias(biasScheme, true);
+  double NLBias = unselectedLineBias(biasScheme, false);
+  return totalUnselNLsCap *
+      (vBias*NLBias * vBias*NLBias - vBias*NLBias * vBias*PLBias);
+}
+
 void
-XPointArray::buildFromConfigFiles()
+XPointArray::buildFromConfigFiles(const Config& config)
 {
   try {
     // Build "pure" cells
-    selectedCell = Cell(cellFileName);
-    HSCellPL = Cell(cellFileName);
-    HSCellNL = Cell(cellFileName);
+    selectedCell = Cell::fromCellFile(cellFileName, config.cellJSON);
+    HSCellPL = selectedCell;
+    HSCellNL = selectedCell;
+    unselectedCell = selectedCell;
 
     // Get technology values
-    tech = Technology(techFileName);
+    tech = Technology::fromTechFile(techFileName, config.techJSON);
 
     // Get general values for the array
-    JsonAssist jsonArch(archFileName);
+    JsonAssist jsonArch(archFileName, config.archJSON);
 
     double magnitude = INVALID_DOUBLE;
 
     magnitude = jsonArch.getJSONNumber(
           "Wordline metal width [nm]", optional);
-    setWLMetalWidth( magnitude * rrs::nanometers );
+    setWLMetalWidth(SCALE_QUANTITY(magnitude * rrs::nanometers,
+                                   rrs::meter_unit));
 
     magnitude = jsonArch.getJSONNumber(
           "Bitline metal width [nm]", optional);
-    setBLMetalWidth( magnitude * rrs::nanometers );
+    setBLMetalWidth(SCALE_QUANTITY(magnitude * rrs::nanometers,
+                                   rrs::meter_unit));
+
+    string auxStr = jsonArch.getJSONString(
+          "Line solver method []", optional);
+    if ( isValid(auxStr) ) {
+      setLineSolverMethod( auxStr );
+    }
+
+    auxStr = jsonArch.getJSONString(
+          "Line solver acceleration []", optional);
+    if ( isValid(auxStr) ) {
+      setLineSolverAcceleration( auxStr );
+    }
+
+    magnitude = jsonArch.getJSONNumber(
+          "SOR factor []", optional);
+    if ( isValid(magnitude) ) {
+      setSORFactor( magnitude );
+    }
+
+    magnitude = jsonArch.getJSONNumber(
+          "Anderson depth []", optional);
+    if ( isValid(magnitude) ) {
+      setAndersonDepth( magnitude );
+    }
+
+    auxStr = jsonArch.getJSONString(
+          "Array model []", optional);
+    if ( isValid(auxStr) ) {
+      setArrayModel( auxStr );
+    }
+
+    magnitude = jsonArch.getJSONNumber(
+          "Array solver threads []", optional);
+    if ( isValid(magnitude) ) {
+      setArraySolverThreads( magnitude );
+    }
+
+    auxStr = jsonArch.getJSONString(
+          "Bias scheme []", optional);
+    if ( isValid(auxStr) ) {
+      setBiasScheme( auxStr );
+    }
+
+    // Limits only decide whether a solve fails, never what it converges to
+    SolverLimits limits = getSolverLimits();
+    magnitude = jsonArch.getJSONNumber(
+          "Solver iteration limit []", optional);
+    if ( isValid(magnitude) ) {
+      if ( !isInteger(magnitude) || magnitude < 1. ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Solver iteration limit must be a");
+        exceptionMsgThrown.append(" positive integer, got ");
+        exceptionMsgThrown.append(to_string(magnitude));
+        exceptionMsgThrown.append(".\n");
+        throw exceptionMsgThrown;
+      }
+      limits.maxIterations = size_t(magnitude);
+    }
+    magnitude = jsonArch.getJSONNumber(
+          "Solver time limit [s]", optional);
+    if ( isValid(magnitude) ) {
+      limits.maxSeconds = magnitude;
+    }
+    setSolverLimits(limits);
+
+    auxStr = jsonArch.getJSONString(
+          "Result cache file []", optional);
+    if ( isValid(auxStr) ) {
+      resultCache = make_shared<ResultCache>(auxStr);
+
+      // Cell and technology files as a whole and the array members read
+      //  above - other architecture members never change a solve
+      solverInputs = JsonAssist(cellFileName, config.cellJSON)
+                       .getCanonicalJSON();
+      solverInputs.append("\n");
+      solverInputs.append(JsonAssist(techFileName, config.techJSON)
+                            .getCanonicalJSON());
+      solverInputs.append("\n");
+      solverInputs.append(jsonArch.getCanonicalJSON({
+          "Wordline metal width [nm]", "Bitline metal width [nm]",
+          "Line solver method []", "Line solver acceleration []",
+          "SOR factor []", "Anderson depth []", "Array model []",
+          "Bias scheme []" }));
+    }
 
   } catch(string exceptionMsgThrown) {
     throw exceptionMsgThrown;
@@ -1253,38 +1458,38 @@ XPointArray::calcDriverResistance( rramOperations op )
 
 
     // TODO: ADD AS CLASS ATTRIBUTE WITH PROPER INTERFACE
-    bu::quantity<rrs::square_nanometer_unit> arrayControlArea;
-    arrayControlArea = 250e6 * rrs::square_nanometers;
+    bu::quantity<rrs::square_meter_unit> arrayControlArea;
+    arrayControlArea = 250e-12 * rrs::square_meters;
 
     // Minimum sizings
-    bu::quantity<rrs::nanometer_unit> lengthwisePMOSPitch;
+    bu::quantity<rrs::meter_unit> lengthwisePMOSPitch;
     lengthwisePMOSPitch = tech.getMinPMOSChannelLength();
     lengthwisePMOSPitch += tech.getActiveExtensionOfPoly();
     lengthwisePMOSPitch += tech.getActiveToActiveSpacing();
 
-    bu::quantity<rrs::nanometer_unit> lengthwiseNMOSPitch;
+    bu::quantity<rrs::meter_unit> lengthwiseNMOSPitch;
     lengthwiseNMOSPitch = tech.getMinPMOSChannelLength();
     lengthwiseNMOSPitch += tech.getActiveExtensionOfPoly();
     lengthwiseNMOSPitch += tech.getActiveToActiveSpacing();
 
-    bu::quantity<rrs::nanometer_unit> widthwisePMOSOverhead;
+    bu::quantity<rrs::meter_unit> widthwisePMOSOverhead;
     widthwisePMOSOverhead = tech.getGateExtensionOfActive();
     widthwisePMOSOverhead = tech.getPolyToPolySpacing();
 
-    bu::quantity<rrs::nanometer_unit> widthwiseNMOSOverhead;
+    bu::quantity<rrs::meter_unit> widthwiseNMOSOverhead;
     widthwiseNMOSOverhead = tech.getGateExtensionOfActive();
     widthwiseNMOSOverhead = tech.getPolyToPolySpacing();
 
 
-    bu::quantity<rrs::square_nanometer_unit> minPMOSArea;
+    bu::quantity<rrs::square_meter_unit> minPMOSArea;
     minPMOSArea = lengthwisePMOSPitch
         * (widthwisePMOSOverhead + tech.getMinPMOSChannelWidth());
 
-    bu::quantity<rrs::square_nanometer_unit> minNMOSArea;
+    bu::quantity<rrs::square_meter_unit> minNMOSArea;
     minNMOSArea = lengthwiseNMOSPitch
         * (widthwiseNMOSOverhead + tech.getMinNMOSChannelWidth());
 
-    bu::quantity<rrs::square_nanometer_unit> minInverterArea;
+    bu::quantity<rrs::square_meter_unit> minInverterArea;
     minInverterArea = minPMOSArea + minNMOSArea;
 
     // Calculate Wp/Wn ratio to ensure same on-resistance
@@ -1294,16 +1499,20 @@ XPointArray::calcDriverResistance( rramOperations op )
     if ( PNWidthRatio < 1.0 ) {
       string exceptionMsgThrown("[ERROR] ");
       exceptionMsgThrown.append("NMOS Resistance-width product (");
-      exceptionMsgThrown.append(to_string(tech.getNMOSResWidthProduct()));
+      exceptionMsgThrown.append(to_string(
+          SCALE_QUANTITY(tech.getNMOSResWidthProduct(),
+                         rrs::nanoohm_meter_unit)));
       exceptionMsgThrown.append(") is greater than that of PMOS (");
-      exceptionMsgThrown.append(to_string(tech.getPMOSResWidthProduct()));
+      exceptionMsgThrown.append(to_string(
+          SCALE_QUANTITY(tech.getPMOSResWidthProduct(),
+                         rrs::nanoohm_meter_unit)));
       exceptionMsgThrown.append(")! This should never be the case.");
       exceptionMsgThrown.append("\n");
       throw exceptionMsgThrown;
     }
 
-    bu::quantity<rrs::nanometer_unit> minActPMOSWidth;
-    bu::quantity<rrs::nanometer_unit> minActNMOSWidth;
+    bu::quantity<rrs::meter_unit> minActPMOSWidth;
+    bu::quantity<rrs::meter_unit> minActNMOSWidth;
     minActPMOSWidth = tech.getMinNMOSChannelWidth()*PNWidthRatio;
     minActNMOSWidth = tech.getMinNMOSChannelWidth();
     if ( minActPMOSWidth < tech.getMinPMOSChannelWidth() ) {
@@ -1317,12 +1526,12 @@ XPointArray::calcDriverResistance( rramOperations op )
     minNMOSArea = lengthwiseNMOSPitch
       * (widthwiseNMOSOverhead + minActNMOSWidth);
 
-    bu::quantity<rrs::square_nanometer_unit> minSwitchArea;
+    bu::quantity<rrs::square_meter_unit> minSwitchArea;
     minSwitchArea += 1.0 * minPMOSArea;
     minSwitchArea += 2.0 * minNMOSArea;
     minSwitchArea += minInverterArea;
 
-    bu::quantity<rrs::square_nanometer_unit> minPeripheryArea;
+    bu::quantity<rrs::square_meter_unit> minPeripheryArea;
     minPeripheryArea = arrayControlArea + ( nCols + nRows ) * minSwitchArea;
 
     if ( area < minPeripheryArea ) {
@@ -1342,24 +1551,24 @@ XPointArray::calcDriverResistance( rramOperations op )
     }
 
     // Area underneath the array available for switches
-    bu::quantity<rrs::square_nanometer_unit> availableArea;
+    bu::quantity<rrs::square_meter_unit> availableArea;
     availableArea = area - arrayControlArea;
 
     // Maximum area per AMUX
-    bu::quantity<rrs::square_nanometer_unit> areaPerAMUX;
+    bu::quantity<rrs::square_meter_unit> areaPerAMUX;
     areaPerAMUX = availableArea / ( nRows + nCols ) - minInverterArea;
 
-    bu::quantity<rrs::square_nanometer_unit> actAreaPerAMUX;
+    bu::quantity<rrs::square_meter_unit> actAreaPerAMUX;
     actAreaPerAMUX = availableArea / ( nRows + nCols );
     actAreaPerAMUX -= minInverterArea;
     actAreaPerAMUX -= widthwisePMOSOverhead * lengthwisePMOSPitch;
     actAreaPerAMUX -= 2.0 * widthwiseNMOSOverhead * lengthwiseNMOSPitch;
 
-    bu::quantity<rrs::nanometer_unit> accMOSLengthPitch;
+    bu::quantity<rrs::meter_unit> accMOSLengthPitch;
     accMOSLengthPitch = 2.0 * lengthwiseNMOSPitch;
     accMOSLengthPitch += PNWidthRatio * lengthwisePMOSPitch;
 
-    bu::quantity<rrs::nanometer_unit> actNMOSWidth;
+    bu::quantity<rrs::meter_unit> actNMOSWidth;
     actNMOSWidth = actAreaPerAMUX / accMOSLengthPitch;
 
 
@@ -1417,15 +1626,33 @@ XPointArray::calcDriverResistance( rramOperations op )
 bu::quantity<rrs::volt_unit>
 XPointArray::findBestVRead()
 {
+  TRACE_SCOPE_DETAIL("XPointArray::findBestVRead",
+                     nRows.value() << " x " << nCols.value());
+
   auto designCurrentRatio = selectedCell.getCellReadCurrentRatio();
 
   auto bestVRead = INVALID_DOUBLE * rrs::volts;
   auto vRead = writeVoltage;
   auto vReadResolution = writeVoltage / 2.;
   bool foundGoodEnough = false;
+  COUNT_PERF(readVoltageSearches, 1);
   while ( !foundGoodEnough ) {
-    calcVSelectedCell(vRead, writeVoltage/2., read_hrs_op);
-    calcVSelectedCell(vRead, writeVoltage/2., read_lrs_op);
+    // Steps too small to move the read voltage would never end the search
+    //  The best read voltage so far, if any, is kept
+    if ( (vRead + vReadResolution).value() == vRead.value() ) {
+      PRINT_INFO("Read voltage search on a " << to_string(nRows)
+                 << " x " << to_string(nCols)
+                 << " crosspoint array stopped at the voltage resolution"
+                 << " without matching the LRS/HRS read current ratio of "
+                 << to_string((double)designCurrentRatio)
+                 << (isValid(bestVRead) ? " - keeping the best read voltage."
+                                        : "."));
+      break;
+    }
+    COUNT_PERF(readVoltageIterations, 1);
+    // Unselected lines are kept at their write bias while reading
+    calcVSelectedCell(vRead, writeVoltage, read_hrs_op);
+    calcVSelectedCell(vRead, writeVoltage, read_lrs_op);
 
     // Iteration truth table:
     // isDisruptiveRead  ratio > desginRatio | outcome
@@ -1454,19 +1681,15 @@ XPointArray::findBestVRead()
       vReadResolution /= 2.;
     } else if ( isDisruptiveRead && !(currentRatio > designCurrentRatio) ) {
       bestVRead = INVALID_DOUBLE * rrs::volts; // Unnecessary. Code clarity.
-      string infoString("Could not find apropriate read voltage");
-      infoString.append(" for a LRS/HRS read current ratio of ");
-      infoString.append(to_string((double)designCurrentRatio));
-      infoString.append(" on a ");
-      infoString.append(to_string(nRows));
-      infoString.append(" x ");
-      infoString.append(to_string(nCols));
-      infoString.append(" crosspoint array. The last ratio was ");
-      infoString.append(to_string(currentRatio));
-      infoString.append(" at a read voltage of ");
-      infoString.append(to_string(vRead));
-      infoString.append(" which already causes disruptive reading.");
-      PRINT_INFO(infoString);
+      PRINT_INFO("Could not find apropriate read voltage"
+                 << " for a LRS/HRS read current ratio of "
+                 << to_string((double)designCurrentRatio)
+                 << " on a " << to_string(nRows)
+                 << " x " << to_string(nCols)
+                 << " crosspoint array. The last ratio was "
+                 << to_string(currentRatio)
+                 << " at a read voltage of " << to_string(vRead)
+                 << " which already causes disruptive reading.");
       break;
     } else {
       vRead -= vReadResolution;
@@ -1481,129 +1704,25 @@ bu::quantity<rrs::volt_unit>
 XPointArray::calcVEdge( bu::quantity<rrs::volt_unit> vSC,
                         rramOperations op )
 {
+  COUNT_PERF_SOLVE(edgeSolves, edgeIterations);
+  TRACE_SCOPE_DETAIL("XPointArray::calcVEdge",
+                     operationName(op) << ", " << nRows.value() << " x "
+                     << nCols.value());
+
   try {
 
     initializeIterativeVariables(op);
 
-    // Current and voltage necessary on selected cell
-    bu::quantity<rrs::ampere_unit> iSC;
-    iSC = SCALE_QUANTITY( selectedCell.getCellCurrent(vSC), rrs::ampere_unit);
-    iNLCells.at(0) = SCALE_QUANTITY(iSC, rrs::nanoampere_unit);
-    iPLCells.at(nPLSegs-1) = SCALE_QUANTITY(iSC, rrs::nanoampere_unit);
-
-    // PL AMUX 'input' voltage - yet to be found
-    // NL AMUX 'input' voltage is considered to be grounded
-    bu::quantity<rrs::volt_unit> vP(0 * rrs::volts);
-    // 'Input' AMUX voltage for unselected lines, V/2 scheme
-    bu::quantity<rrs::volt_unit> vHalf(0 * rrs::volts);
-
-    /*** Voltage drop across lines due to selected cell current () ***/
-    vNLSegs.at(nNLSegs-1) = iSC * accRNL.at(nNLSegs - 1);
-    for (size_t NLSeg = nNLSegs-1; NLSeg-- > 0;) {
-      vNLSegs.at(NLSeg) = vNLSegs.at(NLSeg+1) + NLResistancePerCell * iSC;
+    // 'Input' AMUX voltage for unselected lines follows the bias scheme
+    auto vP = INVALID_DOUBLE * rrs::volts;
+    if ( arrayModel == full ) {
+      vP = arraySolver.calcVEdge(vSC.value(), 0., true) * rrs::volts;
     }
-
-    vPLSegs.at(nPLSegs-1) = vNLSegs.at(0) + vSC;
-    for (size_t PLSeg = nPLSegs-1; PLSeg-- > 0;) {
-      vPLSegs.at(PLSeg) = vPLSegs.at(PLSeg+1) + PLResistancePerCell * iSC;
-    }
-
-    vP = vPLSegs.at(0) + accRPL.at(0) * iSC;
-    vHalf = vP / 2.;
-
-    // PL AMUX voltage relative error between iterations
-    bu::quantity<rrs::dimensionless> relError(1./0.);
-
-    /*** ************************ Main algorithm ************************ ***/
-    /* Updates sneak current while updating AMUX voltage */
-
-    while ( abs(relError) >  1e-6 ) {
-      auto lastVP = vP;
-      bu::quantity<rrs::volt_unit> accDeltaV = 0 * rrs::volts;
-
-      bu::quantity<rrs::nanoampere_unit> lastI;
-      bu::quantity<rrs::nanoampere_unit> deltaI;
-      bu::quantity<rrs::volt_unit> deltaV;
-      // Update NL cell currents and next cell (and AMUX) voltage
-      for (size_t NLSeg = nNLSegs-1; NLSeg >= 1; --NLSeg) {
-        lastI = iNLCells.at(NLSeg);
-        iNLCells.at(NLSeg) = HSCellNL.getCellCurrent(vHalf - vNLSegs.at(NLSeg));
-        deltaI = iNLCells.at(NLSeg) - lastI;
-
-        deltaV = accRNL.at(NLSeg) * SCALE_QUANTITY(deltaI, rrs::ampere_unit);
-        accDeltaV += deltaV;
-
-        vNLSegs.at(NLSeg - 1) += accDeltaV;
-        vP += deltaV;
-        vHalf = vP/2.;
-      }
-
-      deltaI = 0 * rrs::nanoamperes;
-      bu::quantity<rrs::nanoampere_unit> accDeltaI = 0 * rrs::nanoamperes;
-      // Update PL cell currents and "previous" cell (and AMUX) voltage
-      vPLSegs.at(nPLSegs - 1) += accDeltaV;
-      for (size_t PLSeg = nPLSegs-1; PLSeg-- > 0;) {
-        deltaV = PLResistancePerCell
-                  * SCALE_QUANTITY(accDeltaI, rrs::ampere_unit);
-        accDeltaV += deltaV;
-
-        vP += accRPL.at(PLSeg+1)*SCALE_QUANTITY(deltaI, rrs::ampere_unit);
-        vHalf = vP/2.;
-
-        vPLSegs.at(PLSeg) += accDeltaV;
-
-        lastI = iPLCells.at(PLSeg);
-        iPLCells.at(PLSeg) = HSCellPL.getCellCurrent(vPLSegs.at(PLSeg) - vHalf);
-
-        deltaI = iPLCells.at(PLSeg) - lastI;
-        accDeltaI += deltaI;
-
-      }
-      vP += accRPL.at(0) * SCALE_QUANTITY(deltaI, rrs::ampere_unit);
-      vHalf = vP/2.;
-
-      // Update NL segments voltages
-      bu::quantity<rrs::ampere_unit> accINL = 0 * rrs::amperes;
-      for(auto& INLCell : iNLCells) {
-        accINL += SCALE_QUANTITY(INLCell, rrs::ampere_unit);
-      }
-      vNLSegs.at(nNLSegs-1) = accINL * (NAMUXResistance + NLResistancePerCell);
-      for (size_t NLSeg = nNLSegs-1; NLSeg-- > 0; ) {
-        accINL -= SCALE_QUANTITY(iNLCells.at(NLSeg+1), rrs::ampere_unit);
-        vNLSegs.at(NLSeg) = vNLSegs.at(NLSeg+1) + accINL * NLResistancePerCell;
-      }
-
-      relError = (lastVP - vP) / vP;
-
+    else {
+      vP = lineSolver.calcVEdge(vSC.value(), 0., true) * rrs::volts;
     }
 
-    if ( iNLCells.at(0) != iPLCells.back() ) {
-      string exceptionMsgThrown("[ERROR] ");
-      exceptionMsgThrown.append("Unexpected behaviour - ");
-      exceptionMsgThrown.append("somthing worng with selected cell current.");
-      throw exceptionMsgThrown;
-    }
-    auto zeroAmp = 0. * rrs::nanoamperes;
-    auto SCCurrent = iNLCells.at(0);
-    auto SPCurrent = accumulate(iPLCells.begin(), iPLCells.end()-1, zeroAmp);
-    SPCurrent += accumulate(iNLCells.begin()+1, iNLCells.end(), zeroAmp);
-
-    if ( op == set_op ) {
-      setSCCurrent = SCCurrent;
-      setSPCurrent = SPCurrent;
-    }
-    else if ( op == reset_op ) {
-      resetSCCurrent = SCCurrent;
-      resetSPCurrent = SPCurrent;
-    }
-    else if ( op == read_hrs_op ) {
-      readHRSSCCurrent = SCCurrent;
-      readHRSSPCurrent = SPCurrent;
-    }
-    else if ( op == read_lrs_op ) {
-      readLRSSCCurrent = SCCurrent;
-      readLRSSPCurrent = SPCurrent;
-    }
+    storeSolverCurrents(op);
 
     return vP;
 
@@ -1615,126 +1734,29 @@ XPointArray::calcVEdge( bu::quantity<rrs::volt_unit> vSC,
 
 bu::quantity<rrs::volt_unit>
 XPointArray::calcVEdge( bu::quantity<rrs::volt_unit> vSC,
-                        bu::quantity<rrs::volt_unit> vHalf,
+                        bu::quantity<rrs::volt_unit> vBias,
                         rramOperations op )
 {
+  COUNT_PERF_SOLVE(edgeSolves, edgeIterations);
+  TRACE_SCOPE_DETAIL("XPointArray::calcVEdge",
+                     operationName(op) << ", " << nRows.value() << " x "
+                     << nCols.value());
+
   try {
 
     initializeIterativeVariables(op);
 
-    // Current and voltage necessary on selected cell
-    bu::quantity<rrs::ampere_unit> iSC;
-    iSC = SCALE_QUANTITY( selectedCell.getCellCurrent(vSC), rrs::ampere_unit);
-    iNLCells.at(0) = SCALE_QUANTITY(iSC, rrs::nanoampere_unit);
-    iPLCells.at(nPLSegs-1) = SCALE_QUANTITY(iSC, rrs::nanoampere_unit);
-
-    // PL AMUX 'input' voltage - yet to be found
-    // NL AMUX 'input' voltage is considered to be grounded
-    bu::quantity<rrs::volt_unit> vP(0 * rrs::volts);
-
-    /*** Voltage drop across lines due to writing current () ***/
-    vNLSegs.at(nNLSegs-1) = iSC * accRNL.at(nNLSegs - 1);
-    for (size_t NLSeg = nNLSegs-1; NLSeg-- > 0;) {
-      vNLSegs.at(NLSeg) = vNLSegs.at(NLSeg+1) + NLResistancePerCell * iSC;
-    }
-
-    vPLSegs.at(nPLSegs-1) = vNLSegs.at(0) + vSC;
-    for (size_t PLSeg = nPLSegs-1; PLSeg-- > 0;) {
-      vPLSegs.at(PLSeg) = vPLSegs.at(PLSeg+1) + PLResistancePerCell * iSC;
+    auto vP = INVALID_DOUBLE * rrs::volts;
+    if ( arrayModel == full ) {
+      vP = arraySolver.calcVEdge(vSC.value(), vBias.value(), false)
+           * rrs::volts;
     }
-
-    vP = vPLSegs.at(0) + accRPL.at(0) * iSC;
-
-    // PL AMUX voltage relative error between iterations
-    bu::quantity<rrs::dimensionless> relError(1./0.);
-
-    /*** ************************ Main algorithm ************************ ***/
-    /* Updates sneak current while updating AMUX voltage */
-
-    while ( abs(relError) >  1e-6 ) {
-      auto lastVP = vP;
-      bu::quantity<rrs::volt_unit> accDeltaV = 0 * rrs::volts;
-
-      bu::quantity<rrs::nanoampere_unit> lastI;
-      bu::quantity<rrs::nanoampere_unit> deltaI;
-      bu::quantity<rrs::volt_unit> deltaV;
-      // Update NL cell currents and next cell (and AMUX) voltage
-      for (size_t NLSeg = nNLSegs-1; NLSeg >= 1; --NLSeg) {
-        lastI = iNLCells.at(NLSeg);
-        iNLCells.at(NLSeg) = HSCellNL.getCellCurrent(vHalf - vNLSegs.at(NLSeg));
-        deltaI = iNLCells.at(NLSeg) - lastI;
-
-        deltaV = accRNL.at(NLSeg) * SCALE_QUANTITY(deltaI, rrs::ampere_unit);
-        accDeltaV += deltaV;
-
-        vNLSegs.at(NLSeg - 1) += accDeltaV;
-        vP += deltaV;
-      }
-
-      deltaI = 0 * rrs::nanoamperes;
-      bu::quantity<rrs::nanoampere_unit> accDeltaI = 0 * rrs::nanoamperes;
-      // Update PL cell currents and "previous" cell (and AMUX) voltage
-      vPLSegs.at(nPLSegs - 1) += accDeltaV;
-      for (size_t PLSeg = nPLSegs-1; PLSeg-- > 0;) {
-        deltaV = PLResistancePerCell
-                  * SCALE_QUANTITY(accDeltaI, rrs::ampere_unit);
-        accDeltaV += deltaV;
-
-        vP += accRPL.at(PLSeg+1)*SCALE_QUANTITY(deltaI, rrs::ampere_unit);
-
-        vPLSegs.at(PLSeg) += accDeltaV;
-
-        lastI = iPLCells.at(PLSeg);
-        iPLCells.at(PLSeg) = HSCellPL.getCellCurrent(vPLSegs.at(PLSeg) - vHalf);
-
-        deltaI = iPLCells.at(PLSeg) - lastI;
-        accDeltaI += deltaI;
-
-      }
-      vP += accRPL.at(0) * SCALE_QUANTITY(deltaI, rrs::ampere_unit);
-
-      // Update NL segments voltages
-      bu::quantity<rrs::ampere_unit> accINL = 0 * rrs::amperes;
-      for(auto& INLCell : iNLCells) {
-        accINL += SCALE_QUANTITY(INLCell, rrs::ampere_unit);
-      }
-      vNLSegs.at(nNLSegs-1) = accINL * (NAMUXResistance + NLResistancePerCell);
-      for (size_t NLSeg = nNLSegs-1; NLSeg-- > 0; ) {
-        accINL -= SCALE_QUANTITY(iNLCells.at(NLSeg+1), rrs::ampere_unit);
-        vNLSegs.at(NLSeg) = vNLSegs.at(NLSeg+1) + accINL * NLResistancePerCell;
-      }
-
-      relError = (lastVP - vP) / vP;
-
+    else {
+      vP = lineSolver.calcVEdge(vSC.value(), vBias.value(), false)
+           * rrs::volts;
     }
 
-    if ( iNLCells.at(0) != iPLCells.back() ) {
-      string exceptionMsgThrown("[ERROR] ");
-      exceptionMsgThrown.append("Unexpected behaviour - ");
-      exceptionMsgThrown.append("somthing worng with selected cell current.");
-      throw exceptionMsgThrown;
-    }
-    auto zeroAmp = 0. * rrs::nanoamperes;
-    auto SCCurrent = iNLCells.at(0);
-    auto SPCurrent = accumulate(iPLCells.begin(), iPLCells.end()-1, zeroAmp);
-    SPCurrent += accumulate(iNLCells.begin()+1, iNLCells.end(), zeroAmp);
-
-    if ( op == set_op ) {
-      setSCCurrent = SCCurrent;
-      setSPCurrent = SPCurrent;
-    }
-    else if ( op == reset_op ) {
-      resetSCCurrent = SCCurrent;
-      resetSPCurrent = SPCurrent;
-    }
-    else if ( op == read_hrs_op ) {
-      readHRSSCCurrent = SCCurrent;
-      readHRSSPCurrent = SPCurrent;
-    }
-    else if ( op == read_lrs_op ) {
-      readLRSSCCurrent = SCCurrent;
-      readLRSSPCurrent = SPCurrent;
-    }
+    storeSolverCurrents(op);
 
     return vP;
 
@@ -1749,155 +1771,55 @@ bu::quantity<rrs::volt_unit>
 XPointArray::calcVSelectedCell( bu::quantity<rrs::volt_unit> vP,
                                rramOperations op)
 {
-  return calcVSelectedCell(vP, vP / 2., op);
+  return calcVSelectedCell(vP, vP, op);
 }
 
 
 bu::quantity<rrs::volt_unit>
 XPointArray::calcVSelectedCell( bu::quantity<rrs::volt_unit> vP,
-                                bu::quantity<rrs::volt_unit> vHalf,
+                                bu::quantity<rrs::volt_unit> vBias,
                                 rramOperations op)
 {
+  COUNT_PERF_SOLVE(selectedCellSolves, selectedCellIterations);
+  TRACE_SCOPE_DETAIL("XPointArray::calcVSelectedCell",
+                     operationName(op) << ", " << nRows.value() << " x "
+                     << nCols.value());
+
   try {
 
     initializeIterativeVariables(op);
 
     // PL AMUX 'input' voltage - Given
-    // HSC AMUX 'input' voltage - Given
+    // HSC AMUX 'input' voltage - Given through vBias
     // NL AMUX 'input' voltage is either
     //  grounded during normal operations
-    //  or at vHalf during calibration
+    //  or at the unselected NL-parallel lines bias during calibration
     auto vN = 0. * rrs::volts;
     if ( op == set_op || op == reset_op ||
          op == read_hrs_op || op == read_lrs_op ) {
       vN = 0. * rrs::volts;
-      for (auto& vPLSeg : vPLSegs ) { vPLSeg = vP; }
-      for (auto& vNLSeg : vNLSegs ) { vNLSeg = vN; }
     }
     else if ( op == calib_wr_all_hrs_op || op == calib_wr_all_lrs_op ||
               op == calib_rd_all_hrs_op || op == calib_rd_all_lrs_op) {
-      vN = vHalf;
-      for (auto& vPLSeg : vPLSegs ) { vPLSeg = vP; }
-      for (auto& vNLSeg : vNLSegs ) { vNLSeg = vN; }
+      vN = vBias * unselectedLineBias(biasScheme, false);
     }
     else {
       throw op;
     }
 
-    // Voltage across the selected cell
-    // Index is the iteration - 0 for this, 1 for last, 2 for second last
-    vector<bu::quantity<rrs::volt_unit>> vSC(3, 0. * rrs::volts);
-
-    // Selected cell voltage relative error between iterations
-    bu::quantity<rrs::dimensionless> relError(1./0.);
-
-    // Factor to slow down vSC variation to improve convergence
-    double slowDownFactor = 1.;
-
-
-    /*** ************************ Main algorithm ************************ ***/
-    /* Updates sneak current while updating driver voltage */
-    while ( abs(relError) >  1e-6 ) {
-
-      bu::quantity<rrs::nanoampere_unit> lastI;
-      bu::quantity<rrs::nanoampere_unit> deltaI;
-      bu::quantity<rrs::volt_unit> deltaV;
-      bu::quantity<rrs::volt_unit> accDeltaV;
-
-      // Update NL cell currents and next cell voltage
-      accDeltaV = 0 * rrs::volts;
-      for (size_t NLSeg = nNLSegs-1; NLSeg >= 1; --NLSeg) {
-        lastI = iNLCells.at(NLSeg);
-        iNLCells.at(NLSeg) = HSCellNL.getCellCurrent(vHalf - vNLSegs.at(NLSeg));
-        deltaI = iNLCells.at(NLSeg) - lastI;
-
-        deltaV = accRNL.at(NLSeg) * SCALE_QUANTITY(deltaI, rrs::ampere_unit);
-        accDeltaV += deltaV;
-
-        vNLSegs.at(NLSeg - 1) += accDeltaV;
-      }
-
-      // Update PL cell currents and next cell voltage
-      accDeltaV = 0 * rrs::volts;
-      for (size_t PLSeg = 0; PLSeg < nPLSegs-1; ++PLSeg) {
-        lastI = iPLCells.at(PLSeg);
-        iPLCells.at(PLSeg) = HSCellNL.getCellCurrent(vPLSegs.at(PLSeg) - vHalf);
-        deltaI = iPLCells.at(PLSeg) - lastI;
-
-        deltaV = accRPL.at(PLSeg) * SCALE_QUANTITY(deltaI, rrs::ampere_unit);
-        accDeltaV += deltaV;
-
-        vPLSegs.at(PLSeg + 1) -= accDeltaV;
-      }
-
-      vSC.at(2) = vSC.at(1);
-      vSC.at(1) = vSC.at(0);
-      vSC.at(0) = vPLSegs.at(nPLSegs-1) - vNLSegs.at(0);
-      if ( areEqual(vSC.at(0), vSC.at(2), 1e-3) ) {
-        if ( !areEqual(vSC.at(0), vSC.at(1), 1e-3) ) {
-          slowDownFactor *= 2.;
-        }
-      }
-      auto deltaVSelectedCell = vSC.at(0) - vSC.at(1);
-      // Slow down voltage variation to improve convergence
-      vSC.at(0) = vSC.at(1) + deltaVSelectedCell / slowDownFactor;
-      iNLCells.at(0) = selectedCell.getCellCurrent(vSC.at(0));
-      iPLCells.at(nPLSegs-1) = iNLCells.at(0);
-      relError = (vSC.at(1) - vSC.at(0)) / vSC.at(0);
-
-      // Update NL segments voltages
-      bu::quantity<rrs::ampere_unit> accINL = 0 * rrs::amperes;
-      for(auto& INLCell : iNLCells) {
-        accINL += SCALE_QUANTITY(INLCell, rrs::ampere_unit);
-      }
-      vNLSegs.at(nNLSegs-1) = vN + accINL * (NAMUXResistance + NLResistancePerCell);
-      for (size_t NLSeg = nNLSegs-1; NLSeg-- > 0; ) {
-        accINL -= SCALE_QUANTITY(iNLCells.at(NLSeg+1), rrs::ampere_unit);
-        vNLSegs.at(NLSeg) = vNLSegs.at(NLSeg+1) + accINL * NLResistancePerCell;
-      }
-
-      // Update PL segments voltages
-      bu::quantity<rrs::ampere_unit> accIPL = 0 * rrs::amperes;
-      for(auto& IPLCell : iPLCells) {
-        accIPL += SCALE_QUANTITY(IPLCell, rrs::ampere_unit);
-      }
-      vPLSegs.at(0) = vP - accIPL * (PAMUXResistance + PLResistancePerCell);
-      for (size_t PLSeg = 1; PLSeg < nPLSegs; ++PLSeg ) {
-        accIPL -= SCALE_QUANTITY(iPLCells.at(PLSeg-1), rrs::ampere_unit);
-        vPLSegs.at(PLSeg) = vPLSegs.at(PLSeg-1) - accIPL * WLResistancePerCell;
-      }
-
+    auto vSC = INVALID_DOUBLE * rrs::volts;
+    if ( arrayModel == full ) {
+      vSC = arraySolver.calcVSelectedCell(vP.value(), vBias.value(),
+                                          vN.value()) * rrs::volts;
     }
-
-    if ( iNLCells.at(0) != iPLCells.back() ) {
-      string exceptionMsgThrown("[ERROR] ");
-      exceptionMsgThrown.append("Unexpected behaviour - ");
-      exceptionMsgThrown.append("somthing worng with selected cell current.");
-      throw exceptionMsgThrown;
-    }
-    auto zeroAmp = 0. * rrs::nanoamperes;
-    auto SCCurrent = iNLCells.at(0);
-    auto SPCurrent = accumulate(iPLCells.begin(), iPLCells.end()-1, zeroAmp);
-    SPCurrent += accumulate(iNLCells.begin()+1, iNLCells.end(), zeroAmp);
-
-    if ( op == set_op ) {
-      setSCCurrent = SCCurrent;
-      setSPCurrent = SPCurrent;
-    }
-    else if ( op == reset_op ) {
-      resetSCCurrent = SCCurrent;
-      resetSPCurrent = SPCurrent;
-    }
-    else if ( op == read_hrs_op ) {
-      readHRSSCCurrent = SCCurrent;
-      readHRSSPCurrent = SPCurrent;
-    }
-    else if ( op == read_lrs_op ) {
-      readLRSSCCurrent = SCCurrent;
-      readLRSSPCurrent = SPCurrent;
+    else {
+      vSC = lineSolver.calcVSelectedCell(vP.value(), vBias.value(),
+                                         vN.value()) * rrs::volts;
     }
 
-    return vSC.at(0);
+    storeSolverCurrents(op);
+
+    return vSC;
 
   } catch(rramOperations op) {
     string exceptionMsgThrown("[ERROR] ");
@@ -1933,6 +1855,9 @@ XPointArray::calcVSelectedCell( bu::quantity<rrs::volt_unit> vP,
 void
 XPointArray::initializeIterativeVariables(rramOperations op)
 {
+  TRACE_SCOPE_DETAIL("XPointArray::initializeIterativeVariables",
+                     operationName(op));
+
   try {
     if ( !areValid(
            nRows, nCols,
@@ -1971,22 +1896,8 @@ XPointArray::initializeIterativeVariables(rramOperations op)
     PAMUXResistance = INVALID_DOUBLE * rrs::ohms;
     NAMUXResistance = INVALID_DOUBLE * rrs::ohms;
 
-    vPLSegs.clear();
-    vPLSegs.push_back( INVALID_DOUBLE * rrs::volts );
-    iPLCells.clear();
-    iPLCells.push_back( INVALID_DOUBLE * rrs::nanoamperes );
-    vNLSegs.clear();
-    vNLSegs.push_back( INVALID_DOUBLE * rrs::volts );
-    iNLCells.clear();
-    iNLCells.push_back( INVALID_DOUBLE * rrs::nanoamperes );
-
     auto totalSeriesResistance = INVALID_DOUBLE * rrs::ohms;
 
-    accRPL.clear();
-    accRPL.push_back( INVALID_DOUBLE * rrs::ohms );
-    accRNL.clear();
-    accRNL.push_back( INVALID_DOUBLE * rrs::ohms );
-
     if ( op == set_op || op == read_hrs_op || op == read_lrs_op ||
          op == calib_wr_all_hrs_op || op == calib_wr_all_lrs_op ||
          op == calib_rd_all_hrs_op || op == calib_rd_all_lrs_op ) {
@@ -2022,34 +1933,30 @@ XPointArray::initializeIterativeVariables(rramOperations op)
       throw op;
     }
 
-    vPLSegs.clear();
-    vPLSegs.resize(nPLSegs, 0. * rrs::volts);
-    iPLCells.clear();
-    iPLCells.resize(nPLSegs, 0. * rrs::nanoamperes);
-    vNLSegs.clear();
-    vNLSegs.resize(nNLSegs, 0. * rrs::volts);
-    iNLCells.clear();
-    iNLCells.resize(nNLSegs, 0. * rrs::nanoamperes);
-
     // Total resistance in series with selector of the half selected cells
     // Memory device res. + line driver res. + complete line res.
+    // Floating lines are not driven, so there is no driver resistance
+    auto unselDriverResistance = halfBiasDriverResistance;
+    if ( biasScheme == floating_bias ) {
+      unselDriverResistance = 0. * rrs::ohms;
+    }
     totalSeriesResistance = selectedCell.getMemDevLRSResistance();
-    totalSeriesResistance += halfBiasDriverResistance;
+    totalSeriesResistance += unselDriverResistance;
     totalSeriesResistance += nNLSegs * NLResistancePerCell;
     HSCellPL.setMemDevLRSResistance(totalSeriesResistance);
 
     totalSeriesResistance = selectedCell.getMemDevHRSResistance();
-    totalSeriesResistance += halfBiasDriverResistance;
+    totalSeriesResistance += unselDriverResistance;
     totalSeriesResistance += nNLSegs * NLResistancePerCell;
     HSCellPL.setMemDevHRSResistance(totalSeriesResistance);
 
     totalSeriesResistance = selectedCell.getMemDevLRSResistance();
-    totalSeriesResistance += halfBiasDriverResistance;
+    totalSeriesResistance += unselDriverResistance;
     totalSeriesResistance += nPLSegs * PLResistancePerCell;
     HSCellNL.setMemDevLRSResistance(totalSeriesResistance);
 
     totalSeriesResistance = selectedCell.getMemDevHRSResistance();
-    totalSeriesResistance += halfBiasDriverResistance;
+    totalSeriesResistance += unselDriverResistance;
     totalSeriesResistance += nPLSegs * PLResistancePerCell;
     HSCellNL.setMemDevHRSResistance(totalSeriesResistance);
 
@@ -2060,6 +1967,7 @@ XPointArray::initializeIterativeVariables(rramOperations op)
          op == calib_wr_all_lrs_op || op == calib_rd_all_lrs_op ) {
       HSCellPL.setMemDevResistanceState(true);
       HSCellNL.setMemDevResistanceState(true);
+      unselectedCell.setMemDevResistanceState(true);
       if ( op == set_op || op == read_hrs_op ) {
         // Selected cell will be set, so it's in HRS (0)
         selectedCell.setMemDevResistanceState(false);
@@ -2077,43 +1985,18 @@ XPointArray::initializeIterativeVariables(rramOperations op)
               op == calib_wr_all_hrs_op  || op == calib_rd_all_hrs_op ) {
       HSCellPL.setMemDevResistanceState(false);
       HSCellNL.setMemDevResistanceState(false);
+      unselectedCell.setMemDevResistanceState(false);
       selectedCell.setMemDevResistanceState(false);
     }
     else {
       throw op;
     }
 
-    // Create vector containing total resistance seen
-    //  from PL segment to PL AMUX
-    // It is the accumulated resistance from the begining
-    //  of the line (AMUX) until the PL segment
-    // nPLSegs+1 to avoid seg. fault during VSC calculation
-    accRPL.clear();
-    accRPL.resize(nPLSegs+1, 0. * rrs::ohms);
-    accRPL.at(0) = PAMUXResistance + PLResistancePerCell;
-    for (size_t PLSeg = 1; PLSeg < nPLSegs+1; PLSeg++) {
-      accRPL.at(PLSeg) = accRPL.at(PLSeg - 1) + PLResistancePerCell;
-    }
-
-    // Create vector containing total resistance seen
-    //  from NL segment to NL AMUX
-    // It is the accumulated resistance from the begining
-    //  of the line (AMUX) until the NL segment
-    accRNL.clear();
-    accRNL.resize(nNLSegs, 0. * rrs::ohms);
-    accRNL.at(0) = NAMUXResistance + nNLSegs * NLResistancePerCell;
-    for (size_t NLSeg = 1; NLSeg < nNLSegs; NLSeg++) {
-      accRNL.at(NLSeg) = accRNL.at(NLSeg - 1) - NLResistancePerCell;
-    }
-
     if ( !areValid(
            nPLSegs, nNLSegs,
            PLResistancePerCell, NLResistancePerCell,
            PAMUXResistance, NAMUXResistance,
-           vPLSegs.back(), iPLCells.back(),
-           vNLSegs.back(), iNLCells.back(),
-           totalSeriesResistance,
-           accRPL.back(), accRNL.back()
+           totalSeriesResistance
           )
       )
     {
@@ -2124,6 +2007,43 @@ XPointArray::initializeIterativeVariables(rramOperations op)
       throw exceptionMsgThrown;
     }
 
+    if ( arrayModel == full ) {
+      arraySolver.setArray(nPLSegs, nNLSegs,
+                           PLResistancePerCell.value(),
+                           NLResistancePerCell.value(),
+                           PAMUXResistance.value(),
+                           NAMUXResistance.value(),
+                           halfBiasDriverResistance.value());
+      arraySolver.setCells(&selectedCell, &unselectedCell);
+      arraySolver.setBiasScheme(biasScheme);
+    }
+    else {
+      // Solver state is zeroed and the accumulated resistances
+      //  from each segment to its AMUX are rebuilt
+      lineSolver.setLines(nPLSegs, nNLSegs,
+                          PLResistancePerCell.value(),
+                          NLResistancePerCell.value(),
+                          PAMUXResistance.value(),
+                          NAMUXResistance.value());
+      lineSolver.setCells(&selectedCell, &HSCellPL, &HSCellNL,
+                          &unselectedCell);
+      lineSolver.setBiasScheme(biasScheme);
+
+      // Start from the last solution of this operation or, failing that,
+      //  of the one sharing its biasing - set and read LRS both have the
+      //  PL on the WL and the half selected cells in LRS
+      auto state = lineSolverStates.find(op);
+      if ( state == lineSolverStates.end() && op == set_op ) {
+        state = lineSolverStates.find(read_lrs_op);
+      }
+      else if ( state == lineSolverStates.end() && op == read_lrs_op ) {
+        state = lineSolverStates.find(set_op);
+      }
+      if ( state != lineSolverStates.end() ) {
+        lineSolver.setInitialState(state->second);
+      }
+    }
+
   } catch(rramOperations op) {
     string exceptionMsgThrown("[ERROR] ");
     exceptionMsgThrown.append("Unexpected behaviour - ");
@@ -2160,7 +2080,222 @@ XPointArray::initializeIterativeVariables(rramOperations op)
 
 
 void
-XPointArray::updateXPointArray()
+XPointArray::storeSolverCurrents(rramOperations op)
+{
+  double rawSCCurrent, rawSPCurrent, rawUCCurrent;
+  if ( arrayModel == full ) {
+    rawSCCurrent = arraySolver.getSCCurrent();
+    rawSPCurrent = arraySolver.getSPCurrent();
+    rawUCCurrent = arraySolver.getUCCurrent();
+  }
+  else {
+    rawSCCurrent = lineSolver.getSCCurrent();
+    rawSPCurrent = lineSolver.getSPCurrent();
+    rawUCCurrent = lineSolver.getUCCurrent();
+    lineSolverStates[op] = lineSolver.getState();
+  }
+  auto SCCurrent = rawSCCurrent * rrs::amperes;
+  auto SPCurrent = rawSPCurrent * rrs::amperes;
+  auto UCCurrent = rawUCCurrent * rrs::amperes;
+
+  if ( op == set_op ) {
+    setSCCurrent = SCCurrent;
+    setSPCurrent = SPCurrent;
+    setUCCurrent = UCCurrent;
+  }
+  else if ( op == reset_op ) {
+    resetSCCurrent = SCCurrent;
+    resetSPCurrent = SPCurrent;
+    resetUCCurrent = UCCurrent;
+  }
+  else if ( op == read_hrs_op ) {
+    readHRSSCCurrent = SCCurrent;
+    readHRSSPCurrent = SPCurrent;
+    readHRSUCCurrent = UCCurrent;
+  }
+  else if ( op == read_lrs_op ) {
+    readLRSSCCurrent = SCCurrent;
+    readLRSSPCurrent = SPCurrent;
+    readLRSUCCurrent = UCCurrent;
+  }
+}
+
+void
+XPointArray::setLineSolverMethod(string methodStr)
+{
+  lineSolver.setMethod(methodStr);
+}
+
+string
+XPointArray::getLineSolverMethod() const
+{
+  return lineSolver.getMethod();
+}
+
+void
+XPointArray::setLineSolverAcceleration(string accelerationStr)
+{
+  lineSolver.setAcceleration(accelerationStr);
+}
+
+string
+XPointArray::getLineSolverAcceleration() const
+{
+  return lineSolver.getAcceleration();
+}
+
+void
+XPointArray::setSORFactor(double factor)
+{
+  lineSolver.setSORFactor(factor);
+}
+
+double
+XPointArray::getSORFactor() const
+{
+  return lineSolver.getSORFactor();
+}
+
+void
+XPointArray::setAndersonDepth(double depth)
+{
+  if ( !isInteger(depth) || depth < 1. ) {
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("Anderson depth must be a positive integer,");
+    exceptionMsgThrown.append(" got ");
+    exceptionMsgThrown.append(to_string(depth));
+    exceptionMsgThrown.append(".\n");
+    throw exceptionMsgThrown;
+  }
+  lineSolver.setAndersonDepth(size_t(depth));
+}
+
+size_t
+XPointArray::getAndersonDepth() const
+{
+  return lineSolver.getAndersonDepth();
+}
+
+void
+XPointArray::setSolverLimits(const SolverLimits& limits)
+{
+  if ( limits.maxIterations == 0 ) {
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("Solver iteration limit must be a");
+    exceptionMsgThrown.append(" positive integer, got 0.\n");
+    throw exceptionMsgThrown;
+  }
+  if ( !(limits.maxSeconds >= 0.) ) {
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("Solver time limit must not be negative,");
+    exceptionMsgThrown.append(" got ");
+    exceptionMsgThrown.append(to_string(limits.maxSeconds));
+    exceptionMsgThrown.append(" s - 0 leaves the solves unbounded.\n");
+    throw exceptionMsgThrown;
+  }
+  lineSolver.setLimits(limits);
+  arraySolver.setLimits(limits);
+}
+
+const SolverLimits&
+XPointArray::getSolverLimits() const
+{
+  return lineSolver.getLimits();
+}
+
+void
+XPointArray::setArrayModel(string model)
+{
+  if ( model == "lumped" ) {
+    arrayModel = lumped;
+  }
+  else if ( model == "full" ) {
+    arrayModel = full;
+  }
+  else {
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("Tried to set an array model for");
+    exceptionMsgThrown.append(" crosspoint array, \"");
+    exceptionMsgThrown.append(model);
+    exceptionMsgThrown.append("\", different from the ones supported:\n");
+    exceptionMsgThrown.append("  \"lumped\"\n");
+    exceptionMsgThrown.append("  \"full\"\n");
+    throw exceptionMsgThrown;
+  }
+}
+
+string
+XPointArray::getArrayModel() const
+{
+  string modelStr;
+  switch (arrayModel) {
+    case lumped:              modelStr = "lumped";        break;
+    case full:                modelStr = "full";          break;
+    case INVALID_ARRAY_MODEL: modelStr = INVALID_STRING;  break;
+  }
+  return modelStr;
+}
+
+void
+XPointArray::setArraySolverThreads(double nThreads)
+{
+  if ( !isInteger(nThreads) || nThreads < 0. ) {
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("Array solver threads must be a");
+    exceptionMsgThrown.append(" non-negative integer, got ");
+    exceptionMsgThrown.append(to_string(nThreads));
+    exceptionMsgThrown.append(".\n");
+    throw exceptionMsgThrown;
+  }
+  arraySolver.setNThreads(size_t(nThreads));
+}
+
+size_t
+XPointArray::getArraySolverThreads() const
+{
+  return arraySolver.getNThreads();
+}
+
+void
+XPointArray::setBiasScheme(string scheme)
+{
+  if ( scheme == "V/2" ) {
+    biasScheme = half_bias;
+  }
+  else if ( scheme == "V/3" ) {
+    biasScheme = third_bias;
+  }
+  else if ( scheme == "floating" ) {
+    biasScheme = floating_bias;
+  }
+  else {
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("Tried to set a bias scheme for");
+    exceptionMsgThrown.append(" crosspoint array, \"");
+    exceptionMsgThrown.append(scheme);
+    exceptionMsgThrown.append("\", different from the ones supported:\n");
+    exceptionMsgThrown.append("  \"V/2\"\n");
+    exceptionMsgThrown.append("  \"V/3\"\n");
+    exceptionMsgThrown.append("  \"floating\"\n");
+    throw exceptionMsgThrown;
+  }
+}
+
+string
+XPointArray::getBiasScheme() const
+{
+  string schemeStr;
+  switch (biasScheme) {
+    case half_bias:     schemeStr = "V/2";          break;
+    case third_bias:    schemeStr = "V/3";          break;
+    case floating_bias: schemeStr = "floating";     break;
+    case invalid_bias:  schemeStr = INVALID_STRING; break;
+  }
+  return schemeStr;
+}
+
+void
+XPointArray::updateGeometry()
 {
   try {
     if ( isInvalid(nRows) || isInvalid(nCols) ) {
@@ -2209,36 +2344,258 @@ XPointArray::updateXPointArray()
     updateBLReadDriverResistance();
     updateHalfBiasDriverResistance();
 
+  } catch(string exceptionMsgThrown) {
+    throw exceptionMsgThrown;
+  }
 
+}
+
+void
+XPointArray::updateDelays()
+{
+  try {
     // Use the maximum voltage "supported" by the thicker oxide transistors
     writeVoltage = 0.9*tech.getBreakdownVoltage();
 
-    auto vReset = calcVSelectedCell(writeVoltage, reset_op);
-    selectedCell.setCellResetVoltage(vReset);
-
-    auto vSet = calcVSelectedCell(writeVoltage, set_op);
-    selectedCell.setCellSetVoltage(vSet);
-
-    readVoltage = findBestVRead();
-
     updateAdjLineDelays();
     updateLineDelays();
     updateCalibrationDelay();
 
     updatePrechargeTime();
+
+  } catch(string exceptionMsgThrown) {
+    throw exceptionMsgThrown;
+  }
+
+}
+
+uint64_t
+XPointArray::resultCacheKey() const
+{
+  string keyText(solverInputs);
+  keyText.append("\nVersion ");
+  keyText.append(to_string(RESULT_CACHE_VERSION));
+  keyText.append("\nSize ");
+  keyText.append(to_string(nRows.value()));
+  keyText.append(" x ");
+  keyText.append(to_string(nCols.value()));
+  return hashString(keyText);
+}
+
+void
+XPointArray::solveWriteOperation()
+{
+  auto vReset = calcVSelectedCell(writeVoltage, reset_op);
+  selectedCell.setCellResetVoltage(vReset);
+
+  auto vSet = calcVSelectedCell(writeVoltage, set_op);
+  selectedCell.setCellSetVoltage(vSet);
+}
+
+void
+XPointArray::updateWriteOperation()
+{
+  try {
+    writeOperationRestored = false;
+    if ( resultCache ) {
+      uint64_t key = resultCacheKey();
+      if ( resultCache->find(key, cachedResults)
+           && (cachedResults.stages & cachedWriteStage) ) {
+        double* values = cachedResults.values;
+        selectedCell.setCellResetVoltage(
+            values[cachedResetVoltage] * rrs::volts);
+        selectedCell.setCellSetVoltage(
+            values[cachedSetVoltage] * rrs::volts);
+        resetSCCurrent = values[cachedResetSCCurrent] * rrs::amperes;
+        resetSPCurrent = values[cachedResetSPCurrent] * rrs::amperes;
+        setSCCurrent = values[cachedSetSCCurrent] * rrs::amperes;
+        setSPCurrent = values[cachedSetSPCurrent] * rrs::amperes;
+        resetUCCurrent = values[cachedResetUCCurrent] * rrs::amperes;
+        setUCCurrent = values[cachedSetUCCurrent] * rrs::amperes;
+        writeOperationRestored = true;
+      }
+      else {
+        cachedResults.key = key;
+        cachedResults.stages = 0;
+      }
+    }
+
+    if ( !writeOperationRestored ) {
+      solveWriteOperation();
+
+      if ( resultCache ) {
+        double* values = cachedResults.values;
+        values[cachedResetVoltage] =
+            selectedCell.getCellResetVoltage().value();
+        values[cachedSetVoltage] = selectedCell.getCellSetVoltage().value();
+        values[cachedResetSCCurrent] = resetSCCurrent.value();
+        values[cachedResetSPCurrent] = resetSPCurrent.value();
+        values[cachedSetSCCurrent] = setSCCurrent.value();
+        values[cachedSetSPCurrent] = setSPCurrent.value();
+        values[cachedResetUCCurrent] = resetUCCurrent.value();
+        values[cachedSetUCCurrent] = setUCCurrent.value();
+        cachedResults.stages = cachedWriteStage;
+        resultCache->store(cachedResults);
+      }
+    }
+
     updateWriteTime();
-    updateReadTime();
+    updateWriteCurrent();
+    updateWriteEnergy();
+
+  } catch(string exceptionMsgThrown) {
+    throw exceptionMsgThrown;
+  }
+
+}
+
+void
+XPointArray::updateReadOperation()
+{
+  try {
+    bool readOperationRestored = writeOperationRestored
+        && (cachedResults.stages & cachedReadStage)
+        && cachedResults.key == resultCacheKey();
+
+    if ( readOperationRestored ) {
+      double* values = cachedResults.values;
+      readVoltage = values[cachedReadVoltage] * rrs::volts;
+      readHRSSCCurrent = values[cachedReadHRSSCCurrent] * rrs::amperes;
+      readHRSSPCurrent = values[cachedReadHRSSPCurrent] * rrs::amperes;
+      readLRSSCCurrent = values[cachedReadLRSSCCurrent] * rrs::amperes;
+      readLRSSPCurrent = values[cachedReadLRSSPCurrent] * rrs::amperes;
+      readHRSUCCurrent = values[cachedReadHRSUCCurrent] * rrs::amperes;
+      readLRSUCCurrent = values[cachedReadLRSUCCurrent] * rrs::amperes;
+    }
+    else {
+      if ( writeOperationRestored ) {
+        // Read solves warm start from the write ones, so run them again to
+        //  get the very same results as without the cache
+        solveWriteOperation();
+      }
+      readVoltage = findBestVRead();
+
+      // A failed search is solved again on every run, so it reports why
+      if ( resultCache && isValid(readVoltage) ) {
+        double* values = cachedResults.values;
+        values[cachedReadVoltage] = readVoltage.value();
+        values[cachedReadHRSSCCurrent] = readHRSSCCurrent.value();
+        values[cachedReadHRSSPCurrent] = readHRSSPCurrent.value();
+        values[cachedReadLRSSCCurrent] = readLRSSCCurrent.value();
+        values[cachedReadLRSSPCurrent] = readLRSSPCurrent.value();
+        values[cachedReadHRSUCCurrent] = readHRSUCCurrent.value();
+        values[cachedReadLRSUCCurrent] = readLRSUCCurrent.value();
+        cachedResults.stages |= cachedReadStage;
+        resultCache->store(cachedResults);
+      }
+    }
 
-    cout << endl;
+    updateReadTime();
 
     updatePrechargeCurrent();
-    updateWriteCurrent();
     updateReadCurrent();
 
     updatePrechargeEnergy();
-    updateWriteEnergy();
     updateReadEnergy();
 
+  } catch(string exceptionMsgThrown) {
+    throw exceptionMsgThrown;
+  }
+
+}
+
+bu::quantity<rrs::second_unit>
+XPointArray::getMinWriteTime() const
+{
+  // Switching time of a cell with the whole write voltage across it
+  //  The selected cell never gets more than that, so it never switches faster
+  auto minSwitchingTime = [this](
+      bu::quantity<rrs::second_unit> timeC,
+      bu::quantity<rrs::per_volt_unit> timeK,
+      bu::quantity<rrs::second_unit> fixedTime)
+      -> bu::quantity<rrs::second_unit> {
+    if ( areValid(timeC, timeK) ) {
+      bu::quantity<rrs::second_unit> fullVoltageTime;
+      fullVoltageTime = timeC * exp(-timeK * writeVoltage);
+      return min(timeC, fullVoltageTime);
+    }
+    if ( isValid(fixedTime) ) {
+      return fixedTime;
+    }
+    return 0. * rrs::seconds;
+  };
+  auto minSetTime = minSwitchingTime(selectedCell.getCellSetTimeC(),
+                                     selectedCell.getCellSetTimeK(),
+                                     selectedCell.getCellSetTime());
+  auto minResetTime = minSwitchingTime(selectedCell.getCellResetTimeC(),
+                                       selectedCell.getCellResetTimeK(),
+                                       selectedCell.getCellResetTime());
+
+  return calibrationDelay + adjLineMaxDelay + lineMaxDelay
+         + max(minSetTime, minResetTime);
+}
+
+bu::quantity<rrs::joule_unit>
+XPointArray::getMinWriteEnergy() const
+{
+  // Dynamic part of the write energy - the static part needs the solved
+  //  write currents, which are never negative
+  auto totalAdjWLCap = BLCapacitancePerLength * height;
+  auto totalAdjBLCap = WLCapacitancePerLength * width;
+  auto totalWLCap = WLCapacitancePerLength * width;
+  auto totalBLCap = BLCapacitancePerLength * height;
+  auto totalLineCap = totalAdjWLCap + totalAdjBLCap + totalWLCap + totalBLCap;
+
+  double PLBias = unselectedLineBias(biasScheme, true);
+  double NLBias = unselectedLineBias(biasScheme, false);
+  bu::quantity<rrs::joule_unit> minWriteEnergy = totalLineCap *
+      (writeVoltage * writeVoltage - writeVoltage * writeVoltage*PLBias);
+  minWriteEnergy += max(calcUnselectedNLsEnergy(writeVoltage, set_op),
+                        calcUnselectedNLsEnergy(writeVoltage, reset_op));
+
+  // Except for the static part of the unselected cells leakage in the
+  //  lumped model, where they all get the ideal unselected lines bias
+  //  (in LRS while writing) for at least the minimum write time
+  //  The full model lines lose some of that bias to their IR drops, so
+  //  there the ideal leakage is no lower bound
+  if ( arrayModel == lumped ) {
+    auto nUnselectedCells = (nRows.value() - 1.) * (nCols.value() - 1.);
+    auto unselectedCellCurrent = abs(unselectedCell.getCellCurrent(
+        writeVoltage * (PLBias - NLBias), true));
+    minWriteEnergy += nUnselectedCells * unselectedCellCurrent
+                      * tech.getBreakdownVoltage() * getMinWriteTime();
+  }
+  return minWriteEnergy;
+}
+
+void
+XPointArray::updateXPointArray()
+{
+  COUNT_PERF(arrayUpdates, 1);
+  TRACE_SCOPE_DETAIL("XPointArray::updateXPointArray",
+                     nRows.value() << " x " << nCols.value());
+  try {
+    {
+      TIME_PERF(geometrySeconds);
+      TRACE_SCOPE("XPointArray::updateGeometry");
+      updateGeometry();
+    }
+    {
+      TIME_PERF(delaysSeconds);
+      TRACE_SCOPE("XPointArray::updateDelays");
+      updateDelays();
+    }
+    {
+      TIME_PERF(writeOperationSeconds);
+      TRACE_SCOPE("XPointArray::updateWriteOperation");
+      updateWriteOperation();
+    }
+    {
+      TIME_PERF(readOperationSeconds);
+      TRACE_SCOPE("XPointArray::updateReadOperation");
+      updateReadOperation();
+    }
+
 //    PRINT_VAR(getNRows());
 //    PRINT_VAR(getNCols());
 //    PRINT_VAR(getAreaEfficiency());
@@ -2275,7 +2632,7 @@ XPointArray::XPointArray(const Config& config)
     techFileName = config.techFileName.c_str();
     archFileName = config.archFileName.c_str();
 
-    buildFromConfigFiles();
+    buildFromConfigFiles(config);
 
   } catch(string exceptionMsgThrown) {
     throw exceptionMsgThrown;
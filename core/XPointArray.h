@@ -36,13 +36,19 @@
 #ifndef XPOINTARRAY_H
 #define XPOINTARRAY_H
 
+#include <map>
+#include <memory>
+
 #include "../utils/constants.h"
 #include "../utils/functions.h"
+#include "../utils/ResultCache.h"
 
 #include "../parser/ArgumentsParser.h"
 #include "../parser/JsonAssist.h"
 
+#include "../core/ArraySolver.h"
 #include "../core/Cell.h"
+#include "../core/LineSolver.h"
 #include "../core/Technology.h"
 
 #include "../expandedBoostUnits/Units/rramSpec_units.h"
@@ -63,16 +69,16 @@ private:
 
   // Mechanical parameters
   // This is one expection where width is in the direction of the bitline
-  bu::quantity<rrs::nanometer_unit> WLMetalWidth;
-  bu::quantity<rrs::nanometer_unit> BLMetalWidth;
+  bu::quantity<rrs::meter_unit> WLMetalWidth;
+  bu::quantity<rrs::meter_unit> BLMetalWidth;
 
-  bu::quantity<rrs::nanometer_unit> heightwiseCellPitch;
-  bu::quantity<rrs::nanometer_unit> widthwiseCellPitch;
-  bu::quantity<rrs::square_nanometer_unit> area4F2;
+  bu::quantity<rrs::meter_unit> heightwiseCellPitch;
+  bu::quantity<rrs::meter_unit> widthwiseCellPitch;
+  bu::quantity<rrs::square_meter_unit> area4F2;
 
-  bu::quantity<rrs::square_nanometer_unit> area;
-  bu::quantity<rrs::nanometer_unit> height;
-  bu::quantity<rrs::nanometer_unit> width;
+  bu::quantity<rrs::square_meter_unit> area;
+  bu::quantity<rrs::meter_unit> height;
+  bu::quantity<rrs::meter_unit> width;
   bu::quantity<rrs::dimensionless> areaEfficiency;
 
   // Numerical parameters
@@ -84,13 +90,13 @@ private:
   // Electrical parameters
   bu::quantity<rrs::ohm_unit> WLResistancePerCell;
   bu::quantity<rrs::ohm_unit> BLResistancePerCell;
-  bu::quantity<rrs::attofarad_unit> WLCapacitancePerCell;
-  bu::quantity<rrs::attofarad_unit> BLCapacitancePerCell;
+  bu::quantity<rrs::farad_unit> WLCapacitancePerCell;
+  bu::quantity<rrs::farad_unit> BLCapacitancePerCell;
 
-  bu::quantity<rrs::ohm_per_nanometer_unit> WLResistancePerLength;
-  bu::quantity<rrs::ohm_per_nanometer_unit> BLResistancePerLength;
-  bu::quantity<rrs::nanofarad_per_meter_unit> WLCapacitancePerLength;
-  bu::quantity<rrs::nanofarad_per_meter_unit> BLCapacitancePerLength;
+  bu::quantity<rrs::ohm_per_meter_unit> WLResistancePerLength;
+  bu::quantity<rrs::ohm_per_meter_unit> BLResistancePerLength;
+  bu::quantity<rrs::farad_per_meter_unit> WLCapacitancePerLength;
+  bu::quantity<rrs::farad_per_meter_unit> BLCapacitancePerLength;
 
   bu::quantity<rrs::ohm_unit> WLWriteDriverResistance;
   bu::quantity<rrs::ohm_unit> BLWriteDriverResistance;
@@ -113,11 +119,6 @@ private:
   bu::quantity<rrs::dimensionless> nPLSegs;
   bu::quantity<rrs::dimensionless> nNLSegs;
 
-  vector<bu::quantity<rrs::volt_unit>> vPLSegs;
-  vector<bu::quantity<rrs::nanoampere_unit>> iPLCells;
-  vector<bu::quantity<rrs::volt_unit>> vNLSegs;
-  vector<bu::quantity<rrs::nanoampere_unit>> iNLCells;
-
   ebool selectedCellState;
   ebool PHSCState; // Half Selected Cell in PL state
   ebool NHSCState; // Half Selected Cell in NL state
@@ -126,55 +127,88 @@ private:
   bu::quantity<rrs::ohm_unit> NAMUXResistance;
   bu::quantity<rrs::ohm_unit> PLResistancePerCell;
   bu::quantity<rrs::ohm_unit> NLResistancePerCell;
-  vector<bu::quantity<rrs::ohm_unit>> accRPL;
-  vector<bu::quantity<rrs::ohm_unit>> accRNL;
+
+  // Raw-double engine holding the lines state (voltages and currents)
+  LineSolver lineSolver;
+  // Last converged lines state of each operation, warm starting the next
+  //  solves - on this or other array sizes
+  map<rramOperations, LineSolver::State> lineSolverStates;
+
+  // Lumped solves only the selected lines, with half selected cells
+  //  absorbing the other lines resistance. Full solves every array node.
+  enum arrayModels { lumped, full, INVALID_ARRAY_MODEL };
+  arrayModels arrayModel;
+  ArraySolver arraySolver;
+
+  // Voltage of the unselected lines - V/2, V/3 or floating
+  biasSchemes biasScheme;
 
   // Timing results
-  bu::quantity<rrs::nanosecond_unit> adjWLDelay;
-  bu::quantity<rrs::nanosecond_unit> adjBLDelay;
-  bu::quantity<rrs::nanosecond_unit> adjLineMaxDelay;
+  bu::quantity<rrs::second_unit> adjWLDelay;
+  bu::quantity<rrs::second_unit> adjBLDelay;
+  bu::quantity<rrs::second_unit> adjLineMaxDelay;
 
-  bu::quantity<rrs::nanosecond_unit> WLDelay;
-  bu::quantity<rrs::nanosecond_unit> BLDelay;
-  bu::quantity<rrs::nanosecond_unit> lineMaxDelay;
+  bu::quantity<rrs::second_unit> WLDelay;
+  bu::quantity<rrs::second_unit> BLDelay;
+  bu::quantity<rrs::second_unit> lineMaxDelay;
 
-  bu::quantity<rrs::nanosecond_unit> prechargeTime;
-  bu::quantity<rrs::nanosecond_unit> calibrationDelay;
-  bu::quantity<rrs::nanosecond_unit> setTime;
-  bu::quantity<rrs::nanosecond_unit> resetTime;
-  bu::quantity<rrs::nanosecond_unit> writeTime;
-  bu::quantity<rrs::nanosecond_unit> readTime;
+  bu::quantity<rrs::second_unit> prechargeTime;
+  bu::quantity<rrs::second_unit> calibrationDelay;
+  bu::quantity<rrs::second_unit> setTime;
+  bu::quantity<rrs::second_unit> resetTime;
+  bu::quantity<rrs::second_unit> writeTime;
+  bu::quantity<rrs::second_unit> readTime;
 
 
   // Current results
-  bu::quantity<rrs::nanoampere_unit> prechargeCurrent;
-
-  bu::quantity<rrs::nanoampere_unit> setSCCurrent;
-  bu::quantity<rrs::nanoampere_unit> setSPCurrent;
-  bu::quantity<rrs::nanoampere_unit> setCurrent;
-  bu::quantity<rrs::nanoampere_unit> resetSCCurrent;
-  bu::quantity<rrs::nanoampere_unit> resetSPCurrent;
-  bu::quantity<rrs::nanoampere_unit> resetCurrent;
-  bu::quantity<rrs::nanoampere_unit> writeCurrent;
-
-  bu::quantity<rrs::nanoampere_unit> readHRSSPCurrent;
-  bu::quantity<rrs::nanoampere_unit> readHRSSCCurrent;
-  bu::quantity<rrs::nanoampere_unit> readLRSSPCurrent;
-  bu::quantity<rrs::nanoampere_unit> readLRSSCCurrent;
-  bu::quantity<rrs::nanoampere_unit> readCurrent;
+  bu::quantity<rrs::ampere_unit> prechargeCurrent;
+
+  // UC - leakage of the unselected cells, between the unselected lines
+  bu::quantity<rrs::ampere_unit> setSCCurrent;
+  bu::quantity<rrs::ampere_unit> setSPCurrent;
+  bu::quantity<rrs::ampere_unit> setUCCurrent;
+  bu::quantity<rrs::ampere_unit> setCurrent;
+  bu::quantity<rrs::ampere_unit> resetSCCurrent;
+  bu::quantity<rrs::ampere_unit> resetSPCurrent;
+  bu::quantity<rrs::ampere_unit> resetUCCurrent;
+  bu::quantity<rrs::ampere_unit> resetCurrent;
+  bu::quantity<rrs::ampere_unit> writeCurrent;
+
+  bu::quantity<rrs::ampere_unit> readHRSSPCurrent;
+  bu::quantity<rrs::ampere_unit> readHRSSCCurrent;
+  bu::quantity<rrs::ampere_unit> readHRSUCCurrent;
+  bu::quantity<rrs::ampere_unit> readLRSSPCurrent;
+  bu::quantity<rrs::ampere_unit> readLRSSCCurrent;
+  bu::quantity<rrs::ampere_unit> readLRSUCCurrent;
+  bu::quantity<rrs::ampere_unit> readCurrent;
 
   // Energy results
-  bu::quantity<rrs::picojoule_unit> prechargeEnergy;
-  bu::quantity<rrs::picojoule_unit> writeEnergy;
-  bu::quantity<rrs::picojoule_unit> readEnergy;
+  bu::quantity<rrs::joule_unit> prechargeEnergy;
+  bu::quantity<rrs::joule_unit> writeEnergy;
+  bu::quantity<rrs::joule_unit> readEnergy;
 
   // Best values for different opt modes
-  bu::quantity<rrs::picojoule_unit> bestWriteEnergy;
-  bu::quantity<rrs::nanosecond_unit> bestWriteTime;
+  bu::quantity<rrs::joule_unit> bestWriteEnergy;
+  bu::quantity<rrs::second_unit> bestWriteTime;
+
+  // Solver results kept across runs, shared by the copies of this array
+  //  Null unless the architecture file names a result cache file
+  shared_ptr<ResultCache> resultCache;
+  // Canonical contents of every solver input but the array size
+  string solverInputs;
+  // Cached results of the current array size, completed stage by stage
+  ResultCache::Record cachedResults;
+  // Whether the write stage was taken from the cache instead of solved
+  bool writeOperationRestored;
 
   // Private methods
   void initialize();
-  void buildFromConfigFiles();
+  void buildFromConfigFiles(const Config&);
+
+  // Key of the current array size results in the cache
+  uint64_t resultCacheKey() const;
+  // Set and reset solves, storing the resulting selected cell voltages
+  void solveWriteOperation();
 
   void updateWLResistancePerLength();
   void updateBLResistancePerLength();
@@ -188,20 +222,21 @@ private:
 
   // Calcutate the needed driver supply voltage
   //  given the write voltage at the selected cell
-  // vHalf is half of vP
+  // Unselected lines are biased from vBias, following the bias scheme
+  // vBias is vP
   bu::quantity<rrs::volt_unit> calcVEdge(bu::quantity<rrs::volt_unit>,
                                          rramOperations);
-  // vHalf is fixed
+  // vBias is fixed
   bu::quantity<rrs::volt_unit> calcVEdge(bu::quantity<rrs::volt_unit>,
                                          bu::quantity<rrs::volt_unit>,
                                          rramOperations);
 
   // Calculate the resulting voltage at selected cell
   //  given the driver supply voltage
-  // vHalf is half of vP
+  // vBias is vP
   bu::quantity<rrs::volt_unit> calcVSelectedCell(bu::quantity<rrs::volt_unit>,
                                          rramOperations);
-  // vHalf is fixed
+  // vBias is fixed
   bu::quantity<rrs::volt_unit> calcVSelectedCell(bu::quantity<rrs::volt_unit>,
                                                  bu::quantity<rrs::volt_unit>,
                                                  rramOperations);
@@ -209,12 +244,20 @@ private:
   bu::quantity<rrs::ohm_unit> calcDriverResistance(rramOperations op = any_op);
 
   void initializeIterativeVariables(rramOperations op);
+  // Stores selected, sneak path and unselected cell currents of the last
+  //  solve
+  void storeSolverCurrents(rramOperations op);
+  // Energy drawn to bring the unselected lines parallel to the NL of op
+  //  from the PL-parallel bias, at which all lines idle, to their own
+  //  - none but for V/3
+  bu::quantity<rrs::joule_unit> calcUnselectedNLsEnergy(
+      bu::quantity<rrs::volt_unit> vBias, rramOperations op) const;
 
   bu::quantity<rrs::volt_unit> findBestVRead();
 
   // TODO: Temporary variables that could be estimated
   bu::quantity<rrs::ohm_unit> LDOResistance = 100 * rrs::ohms;
-  bu::quantity<rrs::nanosecond_unit> currentSensingDelay = 4 * rrs::nanoseconds;
+  bu::quantity<rrs::second_unit> currentSensingDelay = 4e-9 * rrs::seconds;
 
 public:
   XPointArray();
@@ -233,6 +276,8 @@ public:
   Cell selectedCell;
   Cell HSCellPL;
   Cell HSCellNL;
+  // Pure cell used for every unselected cell by the full array model
+  Cell unselectedCell;
 
   // Technology object
   //  Used to derive higher level parameters, such as drivers resistances
@@ -241,6 +286,49 @@ public:
 
   // Update XPointArray values
   void updateXPointArray();
+  // Stages of updateXPointArray, in order
+  // Geometry, capacity and driver resistances
+  //  Cheap, no cell voltage is solved - enough to tell the area efficiency
+  void updateGeometry();
+  // Write voltage, RC delays of the lines and precharge time
+  void updateDelays();
+  // Set and reset solves, write time, current and energy
+  void updateWriteOperation();
+  // Read voltage search, read time, currents and energies
+  void updateReadOperation();
+
+  // Lower bounds of the write time and energy, known after updateDelays
+  bu::quantity<rrs::second_unit> getMinWriteTime() const;
+  bu::quantity<rrs::joule_unit> getMinWriteEnergy() const;
+
+  // Set/Get the method solving the selected lines ("fixed-point", "jacobi"
+  //  or "newton")
+  void setLineSolverMethod(string);
+  string getLineSolverMethod() const;
+
+  // Set/Get the acceleration of the fixed-point line solver ("none", "sor"
+  //  or "anderson"), the SOR factor and the sweeps mixed by Anderson
+  void setLineSolverAcceleration(string);
+  string getLineSolverAcceleration() const;
+  void setSORFactor(double);
+  double getSORFactor() const;
+  void setAndersonDepth(double);
+  size_t getAndersonDepth() const;
+
+  // Set/Get the array model ("lumped" or "full")
+  void setArrayModel(string);
+  string getArrayModel() const;
+  // Set/Get the threads splitting each full array model solve (0 for the
+  //  thread budget of the calling thread)
+  void setArraySolverThreads(double);
+  size_t getArraySolverThreads() const;
+
+  void setBiasScheme(string);
+  string getBiasScheme() const;
+
+  // Set/Get the iteration and time limits of each lines or array solve
+  void setSolverLimits(const SolverLimits&);
+  const SolverLimits& getSolverLimits() const;
 
   // Set/Get number of word- and bitlines (array size)
   // Number of columns translates to the number of cells per wordline
@@ -259,47 +347,47 @@ public:
   bu::quantity<rrs::bit_unit> const &getCapacity() const;
 
   // Widths of the lines
-  void setWLMetalWidth(bu::quantity<rrs::nanometer_unit>,
+  void setWLMetalWidth(bu::quantity<rrs::meter_unit>,
                        settingOptions setOpt = normal_opt);
   void updateWLMetalWidth();
-  bu::quantity<rrs::nanometer_unit> const &getWLMetalWidth() const;
-  void setBLMetalWidth(bu::quantity<rrs::nanometer_unit>,
+  bu::quantity<rrs::meter_unit> const &getWLMetalWidth() const;
+  void setBLMetalWidth(bu::quantity<rrs::meter_unit>,
                        settingOptions setOpt = normal_opt);
   void updateBLMetalWidth();
-  bu::quantity<rrs::nanometer_unit> const &getBLMetalWidth() const;
+  bu::quantity<rrs::meter_unit> const &getBLMetalWidth() const;
 
   // Mechanical parameters
   void updateHeightwiseCellPitch();
-  bu::quantity<rrs::nanometer_unit> const &getHeightwiseCellPitch() const;
+  bu::quantity<rrs::meter_unit> const &getHeightwiseCellPitch() const;
   void updateWidthwiseCellPitch();
-  bu::quantity<rrs::nanometer_unit> const &getWidthwiseCellPitch() const;
+  bu::quantity<rrs::meter_unit> const &getWidthwiseCellPitch() const;
   void updateArea4F2();
-  bu::quantity<rrs::square_nanometer_unit> const &getArea4F2() const;
+  bu::quantity<rrs::square_meter_unit> const &getArea4F2() const;
 
-  void setArea(bu::quantity<rrs::square_nanometer_unit>,
+  void setArea(bu::quantity<rrs::square_meter_unit>,
                          settingOptions setOpt = normal_opt);
   void updateArea();
-  bu::quantity<rrs::square_nanometer_unit> const &getArea() const;
-  bu::quantity<rrs::nanometer_unit> const &getHeight() const;
-  bu::quantity<rrs::nanometer_unit> const &getWidth() const;
+  bu::quantity<rrs::square_meter_unit> const &getArea() const;
+  bu::quantity<rrs::meter_unit> const &getHeight() const;
+  bu::quantity<rrs::meter_unit> const &getWidth() const;
   bu::quantity<rrs::dimensionless> const &getAreaEfficiency() const;
 
   void updateLinesElectricalParameters();
   // Line resistance and capacitance per segment, i.e., per length
-  bu::quantity<rrs::ohm_per_nanometer_unit>
+  bu::quantity<rrs::ohm_per_meter_unit>
     const &getWLResistancePerLength() const;
-  bu::quantity<rrs::ohm_per_nanometer_unit>
+  bu::quantity<rrs::ohm_per_meter_unit>
     const &getBLResistancePerLength() const;
-  bu::quantity<rrs::nanofarad_per_meter_unit>
+  bu::quantity<rrs::farad_per_meter_unit>
     const &getWLCapacitancePerLength() const;
-  bu::quantity<rrs::nanofarad_per_meter_unit>
+  bu::quantity<rrs::farad_per_meter_unit>
     const &getBLCapacitancePerLength() const;
 
   // Line resistance and capacitance per segment, i.e., per cell
   bu::quantity<rrs::ohm_unit> const &getWLResistancePerCell() const;
   bu::quantity<rrs::ohm_unit> const &getBLResistancePerCell() const;
-  bu::quantity<rrs::attofarad_unit> const &getWLCapacitancePerCell() const;
-  bu::quantity<rrs::attofarad_unit> const &getBLCapacitancePerCell() const;
+  bu::quantity<rrs::farad_unit> const &getWLCapacitancePerCell() const;
+  bu::quantity<rrs::farad_unit> const &getBLCapacitancePerCell() const;
 
   // Driver resistances
   void updateWLWriteDriverResistance();
@@ -321,54 +409,58 @@ public:
 
   // Intermidiate steps timing results
   void updateAdjLineDelays();
-  bu::quantity<rrs::nanosecond_unit> const &getAdjLineMaxDelay() const;
-  bu::quantity<rrs::nanosecond_unit> const &getAdjWLDelay() const;
-  bu::quantity<rrs::nanosecond_unit> const &getAdjBLDelay() const;
+  bu::quantity<rrs::second_unit> const &getAdjLineMaxDelay() const;
+  bu::quantity<rrs::second_unit> const &getAdjWLDelay() const;
+  bu::quantity<rrs::second_unit> const &getAdjBLDelay() const;
   void updateLineDelays();
-  bu::quantity<rrs::nanosecond_unit> const &getLineMaxDelay() const;
-  bu::quantity<rrs::nanosecond_unit> const &getWLDelay() const;
-  bu::quantity<rrs::nanosecond_unit> const &getBLDelay() const;
+  bu::quantity<rrs::second_unit> const &getLineMaxDelay() const;
+  bu::quantity<rrs::second_unit> const &getWLDelay() const;
+  bu::quantity<rrs::second_unit> const &getBLDelay() const;
   void updateCalibrationDelay();
-  bu::quantity<rrs::nanosecond_unit> const &getCalibrationDelay() const;
+  bu::quantity<rrs::second_unit> const &getCalibrationDelay() const;
 
   // Complete internal timing results
   void updatePrechargeTime();
-  bu::quantity<rrs::nanosecond_unit> const &getPrechargeTime() const;
+  bu::quantity<rrs::second_unit> const &getPrechargeTime() const;
   void updateWriteTime();
-  bu::quantity<rrs::nanosecond_unit> const &getWriteTime() const;
-  bu::quantity<rrs::nanosecond_unit> const &getSetTime() const;
-  bu::quantity<rrs::nanosecond_unit> const &getResetTime() const;
+  bu::quantity<rrs::second_unit> const &getWriteTime() const;
+  bu::quantity<rrs::second_unit> const &getSetTime() const;
+  bu::quantity<rrs::second_unit> const &getResetTime() const;
   void updateReadTime();
-  bu::quantity<rrs::nanosecond_unit> const &getReadTime() const;
+  bu::quantity<rrs::second_unit> const &getReadTime() const;
 
   // Intermediate power results
-  bu::quantity<rrs::nanoampere_unit> const &getSetSCCurrent() const;
-  bu::quantity<rrs::nanoampere_unit> const &getSetSPCurrent() const;
-  bu::quantity<rrs::nanoampere_unit> const &getSetCurrent() const;
-  bu::quantity<rrs::nanoampere_unit> const &getResetSCCurrent() const;
-  bu::quantity<rrs::nanoampere_unit> const &getResetSPCurrent() const;
-  bu::quantity<rrs::nanoampere_unit> const &getResetCurrent() const;
-
-  bu::quantity<rrs::nanoampere_unit> const &getReadHRSSCCurrent() const;
-  bu::quantity<rrs::nanoampere_unit> const &getReadHRSSPCurrent() const;
-  bu::quantity<rrs::nanoampere_unit> const &getReadLRSSCCurrent() const;
-  bu::quantity<rrs::nanoampere_unit> const &getReadLRSSPCurrent() const;
+  bu::quantity<rrs::ampere_unit> const &getSetSCCurrent() const;
+  bu::quantity<rrs::ampere_unit> const &getSetSPCurrent() const;
+  bu::quantity<rrs::ampere_unit> const &getSetUCCurrent() const;
+  bu::quantity<rrs::ampere_unit> const &getSetCurrent() const;
+  bu::quantity<rrs::ampere_unit> const &getResetSCCurrent() const;
+  bu::quantity<rrs::ampere_unit> const &getResetSPCurrent() const;
+  bu::quantity<rrs::ampere_unit> const &getResetUCCurrent() const;
+  bu::quantity<rrs::ampere_unit> const &getResetCurrent() const;
+
+  bu::quantity<rrs::ampere_unit> const &getReadHRSSCCurrent() const;
+  bu::quantity<rrs::ampere_unit> const &getReadHRSSPCurrent() const;
+  bu::quantity<rrs::ampere_unit> const &getReadHRSUCCurrent() const;
+  bu::quantity<rrs::ampere_unit> const &getReadLRSSCCurrent() const;
+  bu::quantity<rrs::ampere_unit> const &getReadLRSSPCurrent() const;
+  bu::quantity<rrs::ampere_unit> const &getReadLRSUCCurrent() const;
 
   // Complete internal current results
   void updatePrechargeCurrent();
-  bu::quantity<rrs::nanoampere_unit> const &getPrechargeCurrent() const;
+  bu::quantity<rrs::ampere_unit> const &getPrechargeCurrent() const;
   void updateWriteCurrent();
-  bu::quantity<rrs::nanoampere_unit> const &getWriteCurrent() const;
+  bu::quantity<rrs::ampere_unit> const &getWriteCurrent() const;
   void updateReadCurrent();
-  bu::quantity<rrs::nanoampere_unit> const &getReadCurrent() const;
+  bu::quantity<rrs::ampere_unit> const &getReadCurrent() const;
 
   // Complete internal energy results
   void updatePrechargeEnergy();
-  bu::quantity<rrs::picojoule_unit> const &getPrechargeEnergy() const;
+  bu::quantity<rrs::joule_unit> const &getPrechargeEnergy() const;
   void updateWriteEnergy();
-  bu::quantity<rrs::picojoule_unit> const &getWriteEnergy() const;
+  bu::quantity<rrs::joule_unit> const &getWriteEnergy() const;
   void updateReadEnergy();
-  bu::quantity<rrs::picojoule_unit> const &getReadEnergy() const;
+  bu::quantity<rrs::joule_unit> const &getReadEnergy() const;
 
 };
 #endif //XPOINTARRAY_H
@@ -47,6 +47,7 @@ namespace units {
 namespace rramspec {
 
 typedef unit<resistance_per_length_dimension,rramspec::system_bit>    resistance_per_length;
+typedef resistance_per_length    ohm_per_meter_unit;
 
 BOOST_UNITS_STATIC_CONSTANT(ohm_per_meter,resistance_per_length);
 BOOST_UNITS_STATIC_CONSTANT(ohms_per_meter,resistance_per_length);
@@ -68,6 +69,9 @@ BOOST_UNITS_STATIC_CONSTANT(ohms_per_nanometer,ohm_per_nanometer_unit);
 
 } // namespace rramspec
 
+inline std::string name_string(const reduce_unit<rramspec::ohm_per_meter_unit>::type&)   { return "Ohm/m"; }
+inline std::string symbol_string(const reduce_unit<rramspec::ohm_per_meter_unit>::type&) { return "Ohm/m"; }
+
 } // namespace units
 
 } // namespace boost
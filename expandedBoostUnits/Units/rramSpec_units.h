@@ -46,11 +46,47 @@
 #include "per_electric_potential.h"
 #include "resistance_per_length.h"
 
+#include <limits>
+
+// Every quantity kept or computed by the models is in the unprefixed SI
+//  units (meter, second, ampere, volt, ohm, farad, joule, watt...) and bits.
+//  They are coherent: products and quotients of them are in these units
+//  again, with no scale factor. Prefixed units (nanometer, nanoampere...)
+//  are only used to read the description files and to report results.
+
+namespace boost {
+
+namespace units {
+
+namespace rramspec {
+
+// Quantity 'from' in the unit 'To' - invalid quantities (holding the
+//  largest double, see INVALID_DOUBLE) stay invalid
+template<class To, class From> inline quantity<To>
+scaleQuantity(const quantity<From>& from)
+{
+  if ( from.value() == std::numeric_limits<double>::max() ) {
+    return quantity<To>::from_value(std::numeric_limits<double>::max());
+  }
+  return static_cast<quantity<To>>(from);
+}
+template<class To> inline quantity<To>
+scaleQuantity(double from)
+{
+  return quantity<To>(from);
+}
+
+} // namespace rramspec
+
+} // namespace units
+
+} // namespace boost
+
 // Conversion between SCALED UNITS
 // 'from' is a quantity,
 // while 'to' is a unit dimension
 #define SCALE_QUANTITY(from, to) \
-    (static_cast<bu::quantity< to >> (from))
+    (boost::units::rramspec::scaleQuantity< to >(from))
 
 
 #endif // RERAMSPEC_UNITS_H
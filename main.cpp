@@ -46,6 +46,9 @@ int main(int argc, char** argv)
   try {
     RRAMSpec rramSpec(argc, argv);
     std::cout << rramSpec.output.str();
+    if ( rramSpec.nFailedConfigs > 0 ) {
+      return -1;
+    }
   } catch(string exceptionMsgThrown) {
     std::cerr << exceptionMsgThrown;
     return -1;
@@ -48,6 +48,11 @@ ArgumentsParser::ArgumentsParser(int argc, char** argv)
   nConfigurations = 0;
   IOTerminationCurrentFlag = false;
   printAllVariables = false;
+  nJobs = 1;
+  serverMode = false;
+  outputFormat = "table";
+  logLevelName = "info";
+  printStats = false;
 }
 
 void ArgumentsParser::runArgParser()
@@ -103,6 +108,15 @@ void ArgumentsParser::runArgParser()
     argvID++;
     runArgParser();
   }
+  else if( isOptionalFlag(cpargv[argvID]) ) {
+    if( readOptionalFlag() == false ) {
+      badArgumentFlag = true;
+    }
+    else {
+      runArgParser();
+      return;
+    }
+  }
   else {
     badArgumentFlag = true;
   }
@@ -134,6 +148,19 @@ void ArgumentsParser::runArgParser()
     throw exceptionMsgThrown;
   }
 
+  // Servers take their configurations from the requests
+  if ( serverMode ) {
+    if ( nConfigurations > 0 ) {
+      string exceptionMsgThrown("[ERROR] ");
+      exceptionMsgThrown.append("Configuration files are given by the");
+      exceptionMsgThrown.append(" requests in server mode, not as");
+      exceptionMsgThrown.append(" arguments.\n");
+      exceptionMsgThrown.append(helpMessage);
+      throw exceptionMsgThrown;
+    }
+    return;
+  }
+
   if ( nConfigurations == 0 ) {
     string exceptionMsgThrown("[ERROR] ");
     exceptionMsgThrown.append("No input file provided!\n");
@@ -178,6 +205,12 @@ bool ArgumentsParser::readConfFileName()
       argvID++;
       return readConfFileName();
     }
+    else if( isOptionalFlag(cpargv[argvID]) ) {
+      if( readOptionalFlag() == false ) {
+        return false;
+      }
+      return readConfFileName();
+    }
     else if (cpargv[argvID][0] == '-') {
       return false;
     }
@@ -235,6 +268,12 @@ bool ArgumentsParser::storeCellFileName()
       argvID++;
       return storeCellFileName();
     }
+    else if( isOptionalFlag(cpargv[argvID]) ) {
+      if( readOptionalFlag() == false ) {
+        return false;
+      }
+      return storeCellFileName();
+    }
     else if (cpargv[argvID][0] == '-') {
       return false;
     }
@@ -276,6 +315,12 @@ bool ArgumentsParser::storeTechFileName()
       argvID++;
       return storeTechFileName();
     }
+    else if( isOptionalFlag(cpargv[argvID]) ) {
+      if( readOptionalFlag() == false ) {
+        return false;
+      }
+      return storeTechFileName();
+    }
     else if (cpargv[argvID][0] == '-') {
       return false;
     }
@@ -317,6 +362,12 @@ bool ArgumentsParser::storeArchFileName()
       argvID++;
       return storeArchFileName();
     }
+    else if( isOptionalFlag(cpargv[argvID]) ) {
+      if( readOptionalFlag() == false ) {
+        return false;
+      }
+      return storeArchFileName();
+    }
     else if (cpargv[argvID][0] == '-') {
       return false;
     }
@@ -331,3 +382,124 @@ bool ArgumentsParser::storeArchFileName()
 
   return true;
 }
+
+bool ArgumentsParser::isOptionalFlag(const string& arg) const
+{
+  return arg == "-j" || arg == "-server" || arg == "-socket"
+         || arg == "-output" || arg == "-log" || arg == "-stats"
+         || arg == "-trace";
+}
+
+bool ArgumentsParser::readOptionalFlag()
+{
+  string flag = cpargv[argvID];
+  argvID++;
+
+  if( flag == "-j" ) {
+    return readNJobs();
+  }
+  else if( flag == "-server" ) {
+    serverMode = true;
+  }
+  else if( flag == "-socket" ) {
+    return readSocketPath();
+  }
+  else if( flag == "-output" ) {
+    return readOutputFormat();
+  }
+  else if( flag == "-log" ) {
+    return readLogLevel();
+  }
+  else if( flag == "-stats" ) {
+    printStats = true;
+  }
+  else if( flag == "-trace" ) {
+    return readTraceFileName();
+  }
+  return true;
+}
+
+bool ArgumentsParser::readNJobs()
+{
+  // Number of jobs must be a non-negative integer
+  //  If not, point back at the flag for the error message
+  if ( argvID >= cpargc
+       || cpargv[argvID].empty()
+       || cpargv[argvID].size() > 9
+       || cpargv[argvID].find_first_not_of("0123456789") != string::npos ) {
+    argvID--;
+    return false;
+  }
+  nJobs = stoul(cpargv[argvID]);
+
+  argvID++;
+  return true;
+}
+
+bool ArgumentsParser::readSocketPath()
+{
+  // Socket path must not be another flag
+  //  If not, point back at the flag for the error message
+  if ( argvID >= cpargc
+       || cpargv[argvID].empty()
+       || cpargv[argvID][0] == '-' ) {
+    argvID--;
+    return false;
+  }
+  serverMode = true;
+  serverSocketPath = cpargv[argvID];
+
+  argvID++;
+  return true;
+}
+
+bool ArgumentsParser::readTraceFileName()
+{
+  // Trace file name must not be another flag
+  //  If not, point back at the flag for the error message
+  if ( argvID >= cpargc
+       || cpargv[argvID].empty()
+       || cpargv[argvID][0] == '-' ) {
+    argvID--;
+    return false;
+  }
+  traceFileName = cpargv[argvID];
+
+  argvID++;
+  return true;
+}
+
+bool ArgumentsParser::readOutputFormat()
+{
+  // Output format must be one of the known ones
+  //  If not, point back at the flag for the error message
+  if ( argvID >= cpargc
+       || ( cpargv[argvID] != "table"
+            && cpargv[argvID] != "jsonl"
+            && cpargv[argvID] != "csv" ) ) {
+    argvID--;
+    return false;
+  }
+  outputFormat = cpargv[argvID];
+
+  argvID++;
+  return true;
+}
+
+bool ArgumentsParser::readLogLevel()
+{
+  // Log level must be one of the known ones
+  //  If not, point back at the flag for the error message
+  if ( argvID >= cpargc
+       || ( cpargv[argvID] != "error"
+            && cpargv[argvID] != "warning"
+            && cpargv[argvID] != "info"
+            && cpargv[argvID] != "debug" ) ) {
+    argvID--;
+    return false;
+  }
+  logLevelName = cpargv[argvID];
+
+  argvID++;
+  return true;
+}
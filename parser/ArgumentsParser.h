@@ -49,6 +49,11 @@ struct Config {
   string cellFileName;
   string techFileName;
   string archFileName;
+  // Descriptions given in memory as JSON texts - used instead of the files
+  //  above when not empty
+  string cellJSON;
+  string techJSON;
+  string archJSON;
 };
 
 class ArgumentsParser {
@@ -58,6 +63,20 @@ public:
   vector<Config> configs;
   bool IOTerminationCurrentFlag;
   bool printAllVariables;
+  // Configurations run at once - 0 for all hardware threads
+  size_t nJobs;
+  // Answer requests instead of running configurations - on stdin and
+  //  stdout, or on a Unix socket if its path is not empty
+  bool serverMode;
+  string serverSocketPath;
+  // Layout of the results - "table", or records as "jsonl" or "csv"
+  string outputFormat;
+  // Least important messages printed - "error", "warning", "info" or "debug"
+  string logLevelName;
+  // Report the performance counters of the run
+  bool printStats;
+  // Chrome trace of the run written to this file - none if empty
+  string traceFileName;
 
   ostringstream helpStrStream;
   const char* helpMessage =
@@ -79,6 +98,27 @@ public:
             "\n"
           "    -printAll                                 "
             "(Enable print out of all internal variables.)\n"
+          "    -j       <N>                              "
+            "(Run up to N configurations at once, 0 for all hardware "
+              "threads. Default is 1.)\n"
+          "    -server                                   "
+            "(Answer newline-delimited JSON requests on stdin instead of "
+              "running configurations.)\n"
+          "    -socket  <path/to/socket>                 "
+            "(Answer newline-delimited JSON requests on a Unix socket "
+              "instead of running configurations.)\n"
+          "    -output  <table|jsonl|csv>                "
+            "(Print the results as a table, as JSON lines or as CSV. "
+              "Default is table.)\n"
+          "    -log     <error|warning|info|debug>       "
+            "(Print the messages of this level and the more important "
+              "ones. Default is info.)\n"
+          "    -stats                                    "
+            "(Report the performance counters of the solvers and the "
+              "model, per configuration in JSON lines and CSV.)\n"
+          "    -trace   <path/to/trace.json>             "
+            "(Write a timeline of the model evaluation as a Chrome "
+              "trace.)\n"
           "For more information, see README.md.\n";
 
   void runArgParser();
@@ -97,6 +137,15 @@ private:
   bool storeCellFileName();
   bool storeTechFileName();
   bool storeArchFileName();
+  // Flags taking no file names, read the same way wherever they are given
+  //  Reading one moves past it and its value - false if the value is wrong
+  bool isOptionalFlag(const string& arg) const;
+  bool readOptionalFlag();
+  bool readNJobs();
+  bool readSocketPath();
+  bool readOutputFormat();
+  bool readLogLevel();
+  bool readTraceFileName();
 
 };
 
@@ -34,6 +34,9 @@
 
 #include "JsonAssist.h"
 
+#include <cmath>
+#include <limits>
+
 double
 JsonAssist::getJSONNumber(const char* memberName,
                           jsonMemberTypes memberType,
@@ -126,6 +129,67 @@ JsonAssist::getJSONString(const char* memberName,
   return jsonDoc[ memberName ].GetString();
 }
 
+string
+JsonAssist::getJSONText(const char* memberName,
+                        jsonMemberTypes memberType,
+                        string errorComplement)
+{
+  if ( jsonDoc.HasMember( memberName ) == false )
+  {
+    if ( memberType == mandatory ) {
+      string exceptionMsgThrown;
+      exceptionMsgThrown.append("[ERROR] ");
+      exceptionMsgThrown.append("Could not find member \"");
+      exceptionMsgThrown.append(memberName);
+      exceptionMsgThrown.append("\" in JSON document ");
+      exceptionMsgThrown.append(fileName);
+      exceptionMsgThrown.append("!\n");
+      exceptionMsgThrown.append("Member ");
+      exceptionMsgThrown.append(memberName);
+      if (errorComplement.empty()) {
+        exceptionMsgThrown.append(" is always mandatory.");
+      }
+      else {
+        exceptionMsgThrown.append(" is mandatory in this case because ");
+        exceptionMsgThrown.append(errorComplement);
+        exceptionMsgThrown.append(".");
+      }
+      throw exceptionMsgThrown;
+    }
+    else if ( memberType == optional ) {
+      return INVALID_STRING;
+    }
+  }
+
+  rapidjson::StringBuffer buffer;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+  jsonDoc[ memberName ].Accept(writer);
+  return buffer.GetString();
+}
+
+string
+JsonAssist::getCanonicalJSON(const vector<string>& memberNames) const
+{
+  rapidjson::StringBuffer buffer;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+
+  if ( memberNames.empty() ) {
+    jsonDoc.Accept(writer);
+  }
+  else {
+    writer.StartObject();
+    for (const auto& memberName : memberNames) {
+      if ( jsonDoc.HasMember( memberName.c_str() ) ) {
+        writer.Key(memberName.c_str());
+        jsonDoc[ memberName.c_str() ].Accept(writer);
+      }
+    }
+    writer.EndObject();
+  }
+
+  return buffer.GetString();
+}
+
 void 
 JsonAssist::buildJsonDoc(const char* fileName_)
 {
@@ -156,19 +220,29 @@ JsonAssist::buildJsonDoc(const char* fileName_)
   file.close();
 
   // Parse the file as a JSON Document
-  jsonDoc.Parse(fileText);
+  try {
+    parseJsonDoc(fileText);
+  } catch(string exceptionMsgThrown) {
+    delete[] fileText;
+    throw exceptionMsgThrown;
+  }
+
+  delete[] fileText;
+
+}
+
+void
+JsonAssist::parseJsonDoc(const char* jsonText)
+{
+  jsonDoc.Parse(jsonText);
   if ( jsonDoc.HasParseError() ) {
     string exceptionMsgThrown;
     exceptionMsgThrown.append("[ERROR] ");
     exceptionMsgThrown.append("Could not parse ");
     exceptionMsgThrown.append(fileName);
     exceptionMsgThrown.append(" as a JSON document.\n");
-    delete[] fileText;
     throw exceptionMsgThrown;
   }
-
-  delete[] fileText;
-
 }
 
 JsonAssist::JsonAssist(const char* fileName)
@@ -180,5 +254,66 @@ JsonAssist::JsonAssist(const char* fileName)
   }
 }
 
+JsonAssist::JsonAssist(const string& jsonText, const string& sourceName)
+{
+  fileName = sourceName;
+  try {
+    parseJsonDoc(jsonText.c_str());
+  } catch(string exceptionMsgThrown) {
+    throw exceptionMsgThrown;
+  }
+}
+
+JsonAssist::JsonAssist(const char* fileName, const string& jsonText)
+{
+  try {
+    if ( jsonText.empty() ) {
+      buildJsonDoc(fileName);
+    }
+    else {
+      this->fileName = "given in memory";
+      parseJsonDoc(jsonText.c_str());
+    }
+  } catch(string exceptionMsgThrown) {
+    throw exceptionMsgThrown;
+  }
+}
+
 JsonAssist::JsonAssist()
 {}
+
+string jsonString(const string& text)
+{
+  string literal("\"");
+  for (unsigned char character : text) {
+    switch (character) {
+      case '"':  literal.append("\\\""); break;
+      case '\\': literal.append("\\\\"); break;
+      case '\n': literal.append("\\n");  break;
+      case '\r': literal.append("\\r");  break;
+      case '\t': literal.append("\\t");  break;
+      default:
+        if ( character < 0x20 ) {
+          ostringstream escaped;
+          escaped << "\\u" << hex << setw(4) << setfill('0')
+                  << int(character);
+          literal.append(escaped.str());
+        }
+        else {
+          literal.push_back(character);
+        }
+    }
+  }
+  literal.push_back('"');
+  return literal;
+}
+
+string jsonNumber(double value)
+{
+  if ( !isfinite(value) || !isValid(value) ) {
+    return "null";
+  }
+  ostringstream number;
+  number << setprecision(numeric_limits<double>::max_digits10) << value;
+  return number.str();
+}
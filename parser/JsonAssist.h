@@ -44,6 +44,8 @@
 #include <string>
 
 #include "rapidjson/include/rapidjson/document.h"
+#include "rapidjson/include/rapidjson/stringbuffer.h"
+#include "rapidjson/include/rapidjson/writer.h"
 
 #include "../utils/functions.h"
 
@@ -54,6 +56,11 @@ class JsonAssist
   public:
     JsonAssist();
     JsonAssist(const char* fileName);
+    // Document parsed from the text, named sourceName in error messages
+    JsonAssist(const string& jsonText, const string& sourceName);
+    // Document given in memory as jsonText, read from the file when the
+    //  text is empty
+    JsonAssist(const char* fileName, const string& jsonText);
 
     double getJSONNumber(const char *memberName,
                          jsonMemberTypes memberType,
@@ -63,11 +70,28 @@ class JsonAssist
                          jsonMemberTypes memberType,
                          string errorComplement = "");
 
+    // Compact JSON text of the member value, whatever its type
+    string getJSONText(const char* memberName,
+                       jsonMemberTypes memberType,
+                       string errorComplement = "");
+
+    // Compact JSON text of the document - or of the given members only,
+    //  skipping the absent ones - independent of the file formatting
+    string getCanonicalJSON(const vector<string>& memberNames = {}) const;
+
   private:
     string fileName;
     rapidjson::Document jsonDoc;
 
     void buildJsonDoc(const char* fileName_);
+    void parseJsonDoc(const char* jsonText);
 
 };
+
+// JSON string literal of the text
+string jsonString(const string& text);
+// JSON number of the value, exact when read back - null if not finite or
+//  invalid, as JSON has no NaN nor infinity
+string jsonNumber(double value);
+
 #endif //JSONASSIST_H
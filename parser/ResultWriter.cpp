@@ -0,0 +1,391 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+#include "ResultWriter.h"
+
+#include <sstream>
+#include <vector>
+
+namespace {
+
+// Figure of the results, written under its name
+struct ResultField {
+  const char* name;
+  double (*value)(const RRAMSpecResults&);
+};
+
+// Figure of a pareto front solution, written under the name of the same
+//  figure of the results
+struct SolutionField {
+  const char* name;
+  double (*value)(const Bank::SolutionCandidate&);
+};
+
+// Very specific macros to be used in the field lists below
+#define RESULT_FIELD(name, quantity) \
+  { name, [](const RRAMSpecResults& results) \
+          { return double((quantity).value()); } }
+
+#define SOLUTION_FIELD(name, quantity) \
+  { name, [](const Bank::SolutionCandidate& solution) \
+          { return double((quantity).value()); } }
+
+const vector<ResultField>& resultFields()
+{
+  static const vector<ResultField> fields = {
+    RESULT_FIELD("tCCDR [ns]", results.tccdr),
+    RESULT_FIELD("tCCDW [ns]", results.tccdw),
+    RESULT_FIELD("tRL [ns]", results.trl),
+    RESULT_FIELD("tWL [ns]", results.twl),
+    RESULT_FIELD("Row decoder delay [ns]", results.rowDecoderDelay),
+    RESULT_FIELD("Column decoder delay [ns]", results.colDecoderDelay),
+    RESULT_FIELD("Global bus delay [ns]", results.globalBusDelay),
+    RESULT_FIELD("Bank precharge time [ns]", results.prechargeTime),
+    RESULT_FIELD("Bank write time [ns]", results.writeTime),
+    RESULT_FIELD("Bank read time [ns]", results.readTime),
+
+    RESULT_FIELD("eRD [pJ]", results.readEnergy),
+    RESULT_FIELD("eWR [pJ]", results.writeEnergy),
+    RESULT_FIELD("ePRE [pJ]", results.prechargeEnergy),
+    RESULT_FIELD("Interface bus energy [pJ]", results.interfaceBusEnergy),
+    RESULT_FIELD("Leakage power [nW]", results.leakagePower),
+
+    RESULT_FIELD("Subarrays []", results.nSubarrays),
+    RESULT_FIELD("Active subarrays per access []",
+                 results.nActiveSubarraysPerAccess),
+    RESULT_FIELD("Subarrays per row []", results.nSubarraysPerRow),
+    RESULT_FIELD("Subarrays per col []", results.nSubarraysPerCol),
+    RESULT_FIELD("Page size [bits]", results.pageSize),
+    RESULT_FIELD("Row address lines []", results.nRowAddressLines),
+    RESULT_FIELD("Column address lines []", results.nColAddressLines),
+    RESULT_FIELD("Bank height [mm]",
+                 SCALE_QUANTITY(results.bankHeight, rrs::millimeter_unit)),
+    RESULT_FIELD("Bank width [mm]",
+                 SCALE_QUANTITY(results.bankWidth, rrs::millimeter_unit)),
+    RESULT_FIELD("Bank area [mm^2]",
+                 SCALE_QUANTITY(results.bankArea,
+                                rrs::square_millimeter_unit)),
+    RESULT_FIELD("Bank area efficiency []", results.bankAreaEfficiency),
+
+    RESULT_FIELD("Wordlines per subarray []", results.nRows),
+    RESULT_FIELD("Bitlines per subarray []", results.nCols),
+    RESULT_FIELD("Subarray height [um]",
+                 SCALE_QUANTITY(results.subarrayHeight,
+                                rrs::micrometer_unit)),
+    RESULT_FIELD("Subarray width [um]",
+                 SCALE_QUANTITY(results.subarrayWidth,
+                                rrs::micrometer_unit)),
+    RESULT_FIELD("Subarray area [um^2]",
+                 SCALE_QUANTITY(results.subarrayArea,
+                                rrs::square_micrometer_unit)),
+    RESULT_FIELD("Subarray area efficiency []",
+                 results.subarrayAreaEfficiency),
+
+    RESULT_FIELD("Read voltage [V]", results.readVoltage),
+    RESULT_FIELD("Write voltage [V]", results.writeVoltage),
+    RESULT_FIELD("Wordline delay [ns]", results.wlDelay),
+    RESULT_FIELD("Bitline delay [ns]", results.blDelay),
+    RESULT_FIELD("Subarray precharge time [ns]",
+                 results.subarrayPrechargeTime),
+    RESULT_FIELD("Set time [ns]", results.setTime),
+    RESULT_FIELD("Reset time [ns]", results.resetTime),
+    RESULT_FIELD("Subarray write time [ns]", results.subarrayWriteTime),
+    RESULT_FIELD("Subarray read time [ns]", results.subarrayReadTime),
+    RESULT_FIELD("Set current [nA]", results.setCurrent),
+    RESULT_FIELD("Reset current [nA]", results.resetCurrent),
+    RESULT_FIELD("Read HRS selected cell current [nA]",
+                 results.readHRSSCCurrent),
+    RESULT_FIELD("Read HRS selected path current [nA]",
+                 results.readHRSSPCurrent),
+    RESULT_FIELD("Read LRS selected cell current [nA]",
+                 results.readLRSSCCurrent),
+    RESULT_FIELD("Read LRS selected path current [nA]",
+                 results.readLRSSPCurrent),
+    RESULT_FIELD("Subarray precharge current [nA]", results.prechargeCurrent),
+    RESULT_FIELD("Subarray write current [nA]", results.writeCurrent),
+    RESULT_FIELD("Subarray read current [nA]", results.readCurrent),
+    RESULT_FIELD("Subarray precharge energy [pJ]",
+                 results.subarrayPrechargeEnergy),
+    RESULT_FIELD("Subarray write energy [pJ]", results.subarrayWriteEnergy),
+    RESULT_FIELD("Subarray read energy [pJ]", results.subarrayReadEnergy)
+  };
+  return fields;
+}
+
+const vector<SolutionField>& solutionFields()
+{
+  static const vector<SolutionField> fields = {
+    SOLUTION_FIELD("Wordlines per subarray []", solution.nRows),
+    SOLUTION_FIELD("Bitlines per subarray []", solution.nCols),
+    SOLUTION_FIELD("tCCDR [ns]",
+                   SCALE_QUANTITY(solution.tccdr, rrs::nanosecond_unit)),
+    SOLUTION_FIELD("tCCDW [ns]",
+                   SCALE_QUANTITY(solution.tccdw, rrs::nanosecond_unit)),
+    SOLUTION_FIELD("eRD [pJ]",
+                   SCALE_QUANTITY(solution.readEnergy, rrs::picojoule_unit)),
+    SOLUTION_FIELD("eWR [pJ]",
+                   SCALE_QUANTITY(solution.writeEnergy, rrs::picojoule_unit)),
+    SOLUTION_FIELD("Leakage power [nW]",
+                   SCALE_QUANTITY(solution.leakagePower, rrs::nanowatt_unit)),
+    SOLUTION_FIELD("Bank area [mm^2]",
+                   SCALE_QUANTITY(solution.area,
+                                  rrs::square_millimeter_unit))
+  };
+  return fields;
+}
+
+// Columns describing the configuration, before the result fields
+const vector<string> configColumns = {
+  "Configuration []", "Cell file", "Technology file", "Architecture file",
+  "Optimization mode []", "Pareto solution []" };
+
+// CSV field of the text - quoted only when needed
+string csvField(const string& text)
+{
+  if ( text.find_first_of(",\"\r\n") == string::npos ) {
+    return text;
+  }
+  string quoted("\"");
+  for (char character : text) {
+    if ( character == '"' ) {
+      quoted.push_back('"');
+    }
+    quoted.push_back(character);
+  }
+  quoted.push_back('"');
+  return quoted;
+}
+
+// CSV field of the value - empty if not finite or invalid
+string csvNumber(double value)
+{
+  string number = jsonNumber(value);
+  return number == "null" ? "" : number;
+}
+
+// JSON members of the results, without the enclosing braces
+string jsonResultMembers(const RRAMSpecResults& results)
+{
+  ostringstream members;
+  members << jsonString("Optimization mode []") << ":"
+          << jsonString(results.optMode);
+  for (const auto& field : resultFields()) {
+    members << "," << jsonString(field.name) << ":"
+            << jsonNumber(field.value(results));
+  }
+  return members.str();
+}
+
+}
+
+ResultWriter::ResultWriter(ostream& output_, const string& formatName,
+                           bool writeStats_)
+  : output(output_)
+{
+  writeStats = writeStats_;
+  headerWritten = false;
+  if ( formatName == "jsonl" ) {
+    format = jsonLines;
+  }
+  else if ( formatName == "csv" ) {
+    format = csv;
+  }
+  else {
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("Output format \"");
+    exceptionMsgThrown.append(formatName);
+    exceptionMsgThrown.append("\" is unknown. ");
+    exceptionMsgThrown.append("Use \"table\", \"jsonl\" or \"csv\".\n");
+    throw exceptionMsgThrown;
+  }
+}
+
+string
+ResultWriter::jsonResults(const RRAMSpecResults& results)
+{
+  return "{" + jsonResultMembers(results) + "}";
+}
+
+string
+ResultWriter::jsonParetoFront(const RRAMSpecResults& results)
+{
+  ostringstream front;
+  front << "[";
+  for (size_t solutionID = 0; solutionID < results.paretoFront.size();
+       ++solutionID) {
+    front << (solutionID == 0 ? "{" : ",{");
+    bool first = true;
+    for (const auto& field : solutionFields()) {
+      front << (first ? "" : ",") << jsonString(field.name) << ":"
+            << jsonNumber(field.value(results.paretoFront[solutionID]));
+      first = false;
+    }
+    front << "}";
+  }
+  front << "]";
+  return front.str();
+}
+
+string
+ResultWriter::jsonPerfStats(const PerfStats& stats)
+{
+  ostringstream members;
+  members << "{";
+  bool first = true;
+  for (const auto& field : perfStatsFields()) {
+    members << (first ? "" : ",") << jsonString(field.name) << ":"
+            << jsonNumber(field.value(stats));
+    first = false;
+  }
+  members << "}";
+  return members.str();
+}
+
+string
+ResultWriter::jsonConfig(size_t configID, const Config& config) const
+{
+  ostringstream members;
+  members << jsonString(configColumns[0]) << ":" << configID+1
+          << "," << jsonString(configColumns[1]) << ":"
+          << jsonString(config.cellFileName)
+          << "," << jsonString(configColumns[2]) << ":"
+          << jsonString(config.techFileName)
+          << "," << jsonString(configColumns[3]) << ":"
+          << jsonString(config.archFileName);
+  return members.str();
+}
+
+void
+ResultWriter::writeResults(size_t configID, const Config& config,
+                           const RRAMSpecResults& results)
+{
+  if ( format == jsonLines ) {
+    output << "{" << jsonConfig(configID, config) << ","
+           << jsonResultMembers(results);
+    if ( results.optMode == "pareto" ) {
+      output << "," << jsonString("Pareto front") << ":"
+             << jsonParetoFront(results);
+    }
+    if ( writeStats ) {
+      output << "," << jsonString("Performance counters") << ":"
+             << jsonPerfStats(results.stats);
+    }
+    output << "}" << endl;
+    return;
+  }
+
+  writeCsvRow(configID, config, &results, 0, "");
+  for (size_t solutionID = 0; solutionID < results.paretoFront.size();
+       ++solutionID) {
+    writeCsvRow(configID, config, &results, solutionID+1, "");
+  }
+  output.flush();
+}
+
+void
+ResultWriter::writeError(size_t configID, const Config& config,
+                         const string& errorMsg)
+{
+  if ( format == jsonLines ) {
+    output << "{" << jsonConfig(configID, config) << ","
+           << jsonString("Error") << ":" << jsonString(errorMsg) << "}"
+           << endl;
+    return;
+  }
+
+  writeCsvRow(configID, config, nullptr, 0, errorMsg);
+  output.flush();
+}
+
+void
+ResultWriter::writeCsvRow(size_t configID, const Config& config,
+                          const RRAMSpecResults* results,
+                          size_t paretoSolution, const string& errorMsg)
+{
+  if ( !headerWritten ) {
+    for (const auto& column : configColumns) {
+      output << csvField(column) << ",";
+    }
+    for (const auto& field : resultFields()) {
+      output << csvField(field.name) << ",";
+    }
+    if ( writeStats ) {
+      for (const auto& field : perfStatsFields()) {
+        output << csvField(field.name) << ",";
+      }
+    }
+    output << "Error\n";
+    headerWritten = true;
+  }
+
+  output << configID+1 << ","
+         << csvField(config.cellFileName) << ","
+         << csvField(config.techFileName) << ","
+         << csvField(config.archFileName) << ","
+         << csvField(results ? results->optMode : "") << ",";
+  if ( paretoSolution > 0 ) {
+    output << paretoSolution;
+  }
+  output << ",";
+
+  for (const auto& field : resultFields()) {
+    if ( results != nullptr ) {
+      // Solutions of the pareto front only have some of the figures
+      if ( paretoSolution > 0 ) {
+        const auto& solution = results->paretoFront[paretoSolution-1];
+        for (const auto& solutionField : solutionFields()) {
+          if ( string(solutionField.name) == field.name ) {
+            output << csvNumber(solutionField.value(solution));
+            break;
+          }
+        }
+      }
+      else {
+        output << csvNumber(field.value(*results));
+      }
+    }
+    output << ",";
+  }
+  // Counters are of the whole configuration, on its first row only
+  if ( writeStats ) {
+    for (const auto& field : perfStatsFields()) {
+      if ( results != nullptr && paretoSolution == 0 ) {
+        output << csvNumber(field.value(results->stats));
+      }
+      output << ",";
+    }
+  }
+  output << csvField(errorMsg) << "\n";
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+#ifndef RESULTWRITER_H
+#define RESULTWRITER_H
+
+#include "ArgumentsParser.h"
+#include "JsonAssist.h"
+#include "RramSpecLib.h"
+
+#include <iostream>
+#include <string>
+
+using namespace std;
+
+/* Streaming writer of the results of each configuration as records, for
+ * programs reading the results of large runs:
+ *  - jsonl: one JSON object per line, the pareto front nested in it
+ *  - csv:   one row per configuration after a header row, and one more per
+ *           solution of the pareto front, numbered in "Pareto solution []"
+ * Every bank and subarray figure is written, named with its unit, and the
+ * performance counters of the run when asked for - nested under
+ * "Performance counters" in jsonl, as more columns in csv.
+ * Records are written as they are given, each one at once.
+*/
+class ResultWriter
+{
+public:
+  // Format named as in the -output flag, "jsonl" or "csv"
+  ResultWriter(ostream& output, const string& formatName,
+               bool writeStats = false);
+
+  void writeResults(size_t configID, const Config& config,
+                    const RRAMSpecResults& results);
+  // Record of a configuration whose run failed
+  void writeError(size_t configID, const Config& config,
+                  const string& errorMsg);
+
+  // JSON objects of the results and of the pareto front solutions
+  static string jsonResults(const RRAMSpecResults& results);
+  static string jsonParetoFront(const RRAMSpecResults& results);
+  static string jsonPerfStats(const PerfStats& stats);
+
+private:
+  enum outputFormats { jsonLines, csv };
+  ostream& output;
+  outputFormats format;
+  bool writeStats;
+  bool headerWritten;
+
+  string jsonConfig(size_t configID, const Config& config) const;
+  void writeCsvRow(size_t configID, const Config& config,
+                   const RRAMSpecResults* results, size_t paretoSolution,
+                   const string& errorMsg);
+};
+
+#endif // RESULTWRITER_H
@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+#include "RramServer.h"
+
+#include <cerrno>
+#include <cstring>
+#include <thread>
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+namespace {
+
+void throwSocketError(const string& action, const string& socketPath)
+{
+  string exceptionMsgThrown("[ERROR] ");
+  exceptionMsgThrown.append("Could not ");
+  exceptionMsgThrown.append(action);
+  exceptionMsgThrown.append(" the server socket ");
+  exceptionMsgThrown.append(socketPath);
+  exceptionMsgThrown.append(": ");
+  exceptionMsgThrown.append(strerror(errno));
+  exceptionMsgThrown.append("\n");
+  throw exceptionMsgThrown;
+}
+
+}
+
+RRAMSpecServer::RRAMSpecServer()
+{
+  shutdownRequested = false;
+  listenDescriptor = -1;
+}
+
+string
+RRAMSpecServer::answerRequest(const string& requestLine)
+{
+  string idText("null");
+  ostringstream answer;
+  try {
+    JsonAssist request(requestLine, "request");
+
+    string auxStr = request.getJSONText("id", optional);
+    if ( isValid(auxStr) ) {
+      idText = auxStr;
+    }
+
+    auxStr = request.getJSONString("command", optional);
+    if ( isValid(auxStr) ) {
+      if ( auxStr != "shutdown" ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Unknown request command \"");
+        exceptionMsgThrown.append(auxStr);
+        exceptionMsgThrown.append("\". The only command is \"shutdown\".");
+        throw exceptionMsgThrown;
+      }
+      shutdownRequested = true;
+      answer << "{\"id\":" << idText << ",\"status\":\"ok\"}";
+      return answer.str();
+    }
+
+    string errorComplement("the request is not a command");
+    Config config;
+    config.cellFileName = request.getJSONString("cell", mandatory,
+                                                errorComplement);
+    config.techFileName = request.getJSONString("tech", mandatory,
+                                                errorComplement);
+    config.archFileName = request.getJSONString("arch", mandatory,
+                                                errorComplement);
+
+    RRAMSpecResults results = runRRAMSpecConfig(config);
+    printMessages(results.messages);
+
+    answer << "{\"id\":" << idText << ",\"status\":\"ok\""
+           << ",\"results\":" << ResultWriter::jsonResults(results);
+    if ( results.optMode == "pareto" ) {
+      answer << ",\"Pareto front\":"
+             << ResultWriter::jsonParetoFront(results);
+    }
+    answer << "}";
+  } catch(string exceptionMsgThrown) {
+    answer.str("");
+    answer << "{\"id\":" << idText << ",\"status\":\"error\""
+           << ",\"message\":" << jsonString(exceptionMsgThrown) << "}";
+  } catch(...) {
+    answer.str("");
+    answer << "{\"id\":" << idText << ",\"status\":\"error\""
+           << ",\"message\":"
+           << jsonString("[ERROR] Unexpected behaviour - request failed.")
+           << "}";
+  }
+  return answer.str();
+}
+
+void
+RRAMSpecServer::serveStream(istream& input, ostream& output)
+{
+  auto previousStream = redirectMessages(&cerr);
+
+  string requestLine;
+  while ( !shutdownRequested && getline(input, requestLine) ) {
+    if ( requestLine.find_first_not_of(" \t\r") == string::npos ) {
+      continue;
+    }
+    // Flushed, as the client waits for each answer
+    output << answerRequest(requestLine) << endl;
+  }
+
+  redirectMessages(previousStream);
+}
+
+void
+RRAMSpecServer::serveSocket(const string& socketPath)
+{
+  sockaddr_un address;
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  if ( socketPath.size() >= sizeof(address.sun_path) ) {
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("Server socket path ");
+    exceptionMsgThrown.append(socketPath);
+    exceptionMsgThrown.append(" is longer than ");
+    exceptionMsgThrown.append(to_string(sizeof(address.sun_path) - 1));
+    exceptionMsgThrown.append(" characters.\n");
+    throw exceptionMsgThrown;
+  }
+  strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path)-1);
+
+  // Only a socket left by an earlier server is replaced
+  struct stat fileStatus;
+  if ( lstat(socketPath.c_str(), &fileStatus) == 0 ) {
+    if ( !S_ISSOCK(fileStatus.st_mode) ) {
+      errno = EEXIST;
+      throwSocketError("create", socketPath);
+    }
+    unlink(socketPath.c_str());
+  }
+
+  listenDescriptor = socket(AF_UNIX, SOCK_STREAM, 0);
+  if ( listenDescriptor < 0 ) {
+    throwSocketError("create", socketPath);
+  }
+  if ( bind(listenDescriptor, (sockaddr*)&address, sizeof(address)) != 0
+       || listen(listenDescriptor, 16) != 0 ) {
+    int socketErrno = errno;
+    close(listenDescriptor);
+    listenDescriptor = -1;
+    errno = socketErrno;
+    throwSocketError("listen on", socketPath);
+  }
+
+  int acceptErrno = 0;
+  while ( !shutdownRequested ) {
+    int connectionDescriptor = accept(listenDescriptor, nullptr, nullptr);
+    if ( connectionDescriptor < 0 ) {
+      if ( errno == EINTR ) { continue; }
+      // Stopped by a shutdown request otherwise
+      if ( !shutdownRequested ) { acceptErrno = errno; }
+      break;
+    }
+
+    lock_guard<mutex> lock(connectionsMutex);
+    openConnections.insert(connectionDescriptor);
+    thread([this, connectionDescriptor]() {
+      redirectMessages(&cerr);
+      serveConnection(connectionDescriptor);
+
+      lock_guard<mutex> lock(connectionsMutex);
+      openConnections.erase(connectionDescriptor);
+      close(connectionDescriptor);
+      connectionClosed.notify_all();
+    }).detach();
+  }
+
+  stopServing();
+  {
+    unique_lock<mutex> lock(connectionsMutex);
+    connectionClosed.wait(lock, [this]() { return openConnections.empty(); });
+    close(listenDescriptor);
+    listenDescriptor = -1;
+  }
+  unlink(socketPath.c_str());
+
+  if ( acceptErrno != 0 ) {
+    errno = acceptErrno;
+    throwSocketError("accept connections on", socketPath);
+  }
+}
+
+void
+RRAMSpecServer::stopServing()
+{
+  lock_guard<mutex> lock(connectionsMutex);
+  shutdown(listenDescriptor, SHUT_RDWR);
+  for (int connectionDescriptor : openConnections) {
+    shutdown(connectionDescriptor, SHUT_RD);
+  }
+}
+
+void
+RRAMSpecServer::serveConnection(int connectionDescriptor)
+{
+  string pending;
+  char buffer[4096];
+  while ( !shutdownRequested ) {
+    ssize_t nRead = read(connectionDescriptor, buffer, sizeof(buffer));
+    if ( nRead < 0 && errno == EINTR ) { continue; }
+    if ( nRead <= 0 ) { return; }
+    pending.append(buffer, size_t(nRead));
+
+    size_t lineEnd;
+    while ( !shutdownRequested
+            && (lineEnd = pending.find('\n')) != string::npos ) {
+      string requestLine = pending.substr(0, lineEnd);
+      pending.erase(0, lineEnd + 1);
+      if ( requestLine.find_first_not_of(" \t\r") == string::npos ) {
+        continue;
+      }
+
+      string answer = answerRequest(requestLine);
+      answer.push_back('\n');
+      size_t nSent = 0;
+      while ( nSent < answer.size() ) {
+        ssize_t nWritten = send(connectionDescriptor, answer.data() + nSent,
+                                answer.size() - nSent, MSG_NOSIGNAL);
+        if ( nWritten < 0 && errno == EINTR ) { continue; }
+        // Client gone - drop the connection, not the server
+        if ( nWritten <= 0 ) { return; }
+        nSent += size_t(nWritten);
+      }
+    }
+  }
+
+  if ( shutdownRequested ) {
+    stopServing();
+  }
+}
+
+bool
+RRAMSpecServer::isShutdownRequested() const
+{
+  return shutdownRequested;
+}
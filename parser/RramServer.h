@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+#ifndef RRAMSPECSERVER_H
+#define RRAMSPECSERVER_H
+
+#include "ArgumentsParser.h"
+#include "JsonAssist.h"
+#include "ResultWriter.h"
+#include "RramSpecLib.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+/* Long-lived RRAMSpec process answering newline-delimited JSON requests.
+ * Each request line is a JSON object naming the description files of one
+ * configuration:
+ *   {"id": 1, "cell": "cells/a.json", "tech": "techs/b.json",
+ *    "arch": "archs/c.json"}
+ * and is answered by one JSON line, echoing the id:
+ *   {"id": 1, "status": "ok", "results": {"tCCDR [ns]": 8.38, ...}}
+ *   {"id": 1, "status": "error", "message": "[ERROR] ..."}
+ * The request {"command": "shutdown"} stops the server.
+ * Description files are parsed once and kept while they are unchanged, as
+ * are the cell I-V tables, so repeated queries only pay for the solves.
+ * Messages of the model go to stderr, leaving stdout to the answers.
+*/
+class RRAMSpecServer
+{
+public:
+  RRAMSpecServer();
+
+  // Answer of one request line, without the line break
+  string answerRequest(const string& requestLine);
+
+  // Answers the requests of each input line until the input ends or a
+  //  shutdown is requested
+  void serveStream(istream& input, ostream& output);
+  // Same on each connection to a Unix socket created at socketPath, each
+  //  on its own thread, until a shutdown is requested
+  void serveSocket(const string& socketPath);
+
+  bool isShutdownRequested() const;
+
+private:
+  atomic<bool> shutdownRequested;
+
+  // Socket accepting connections and the connections being served
+  int listenDescriptor;
+  set<int> openConnections;
+  mutex connectionsMutex;
+  condition_variable connectionClosed;
+
+  // Answers the requests of one socket connection until it is closed
+  void serveConnection(int connectionDescriptor);
+  // Stops accepting connections and reading requests - answers being
+  //  computed are still sent
+  void stopServing();
+};
+
+#endif // RRAMSPECSERVER_H
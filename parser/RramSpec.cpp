@@ -39,13 +39,20 @@ using namespace std;
 
 RRAMSpec::RRAMSpec(int argc, char** argv)
 {
+    nFailedConfigs = 0;
     runRramSpec(argc, argv);
+
+    // The timeline covers the whole run, server mode included
+    if ( !arg->traceFileName.empty() ) {
+        writeTrace(arg->traceFileName);
+    }
 }
 
 
 //function for writing results in csv file or cout
 string
-RRAMSpec::arrangeOutput(const string outputType)
+RRAMSpec::arrangeOutput(const string outputType,
+                        const RRAMSpecResults& results)
 {
     int lineWidth;
     string separator;
@@ -70,38 +77,95 @@ RRAMSpec::arrangeOutput(const string outputType)
 
     resultTable
       //<< BUILD_LINE("tPD              ", bank->getTpd())
-      << BUILD_LINE("tCCDR            ", bank->getTccdr())
-      << BUILD_LINE("tCCDW            ", bank->getTccdw())
-      << BUILD_LINE("tRL              ", bank->getTrl())
-      << BUILD_LINE("tWL              ", bank->getTwl())
+      << BUILD_LINE("tCCDR            ", results.tccdr)
+      << BUILD_LINE("tCCDW            ", results.tccdw)
+      << BUILD_LINE("tRL              ", results.trl)
+      << BUILD_LINE("tWL              ", results.twl)
 
-      //<< BUILD_LINE("ePRE             ", bank->getPrechargeEnergy())
-      << BUILD_LINE("eRD              ", bank->getReadEnergy())
-      << BUILD_LINE("eWR              ", bank->getWriteEnergy())
+      //<< BUILD_LINE("ePRE             ", results.prechargeEnergy)
+      << BUILD_LINE("eRD              ", results.readEnergy)
+      << BUILD_LINE("eWR              ", results.writeEnergy)
 
-      << BUILD_LINE("Leakage Power    ", bank->getLeakagePower())
+      << BUILD_LINE("Leakage Power    ", results.leakagePower)
       
-      << BUILD_LINE("Wordlines per Subarray  ", bank->subarray.getNRows())
-      << BUILD_LINE("Bitlines per Subarray  ", bank->subarray.getNCols())
+      << BUILD_LINE("Wordlines per Subarray  ", results.nRows)
+      << BUILD_LINE("Bitlines per Subarray  ", results.nCols)
       
-      << BUILD_LINE("Subarrays per Row  ", bank->getNSubarraysPerRow())
-      << BUILD_LINE("Subarrays per Col ", bank->getNSubarraysPerCol())     
+      << BUILD_LINE("Subarrays per Row  ", results.nSubarraysPerRow)
+      << BUILD_LINE("Subarrays per Col ", results.nSubarraysPerCol)     
 
       << BUILD_LINE("Subarray height  ",
-          SCALE_QUANTITY(bank->subarray.getHeight(), rrs::micrometer_unit))
+          SCALE_QUANTITY(results.subarrayHeight, rrs::micrometer_unit))
       << BUILD_LINE("Subarray width   ",
-          SCALE_QUANTITY(bank->subarray.getWidth(), rrs::micrometer_unit))
+          SCALE_QUANTITY(results.subarrayWidth, rrs::micrometer_unit))
       << BUILD_LINE("Bank height      ",
-          SCALE_QUANTITY(bank->getHeight(), rrs::millimeter_unit))
+          SCALE_QUANTITY(results.bankHeight, rrs::millimeter_unit))
       << BUILD_LINE("Bank width       ",
-          SCALE_QUANTITY(bank->getWidth(), rrs::millimeter_unit))
+          SCALE_QUANTITY(results.bankWidth, rrs::millimeter_unit))
       << BUILD_LINE("Bank area        ",
-          SCALE_QUANTITY(bank->getArea(), rrs::square_millimeter_unit))
+          SCALE_QUANTITY(results.bankArea, rrs::square_millimeter_unit))
       ;
 
     return resultTable.str();
 }
 
+//function for writing the solutions of the pareto optimization mode
+string
+RRAMSpec::arrangeParetoFront(const RRAMSpecResults& results)
+{
+    const int columnWidth = 14;
+    ostringstream frontTable;
+
+    frontTable << "Pareto front: " << results.paretoFront.size()
+               << " solutions" << endl
+               << setw(columnWidth) << right << "Wordlines"
+               << setw(columnWidth) << right << "Bitlines"
+               << setw(columnWidth) << right << "tCCDR [ns]"
+               << setw(columnWidth) << right << "tCCDW [ns]"
+               << setw(columnWidth) << right << "eRD [pJ]"
+               << setw(columnWidth) << right << "eWR [pJ]"
+               << setw(columnWidth) << right << "Leakage [nW]"
+               << setw(columnWidth) << right << "Area [mm^2]"
+               << endl;
+
+    for (const auto& solution : results.paretoFront) {
+        frontTable
+          << setw(columnWidth) << right << solution.nRows.value()
+          << setw(columnWidth) << right << solution.nCols.value()
+          << setw(columnWidth) << right
+          << SCALE_QUANTITY(solution.tccdr, rrs::nanosecond_unit).value()
+          << setw(columnWidth) << right
+          << SCALE_QUANTITY(solution.tccdw, rrs::nanosecond_unit).value()
+          << setw(columnWidth) << right
+          << SCALE_QUANTITY(solution.readEnergy, rrs::picojoule_unit).value()
+          << setw(columnWidth) << right
+          << SCALE_QUANTITY(solution.writeEnergy, rrs::picojoule_unit).value()
+          << setw(columnWidth) << right
+          << SCALE_QUANTITY(solution.leakagePower, rrs::nanowatt_unit).value()
+          << setw(columnWidth) << right
+          << SCALE_QUANTITY(solution.area, rrs::square_millimeter_unit).value()
+          << endl;
+    }
+
+    return frontTable.str();
+}
+
+//function for writing the performance counters at the end of the run
+string
+RRAMSpec::arrangePerfStats(const PerfStats& stats)
+{
+    const int lineWidth = 45;
+    const string separator = "";
+    ostringstream statsTable;
+
+    statsTable << "Performance counters of all configurations:" << endl;
+    for (const auto& field : perfStatsFields()) {
+        statsTable << BUILD_LINE(field.name, field.value(stats));
+    }
+
+    return statsTable.str();
+}
+
 void RRAMSpec::runRramSpec(int argc, char** argv)
 {
     arg = new ArgumentsParser(argc, argv);
@@ -113,66 +177,176 @@ void RRAMSpec::runRramSpec(int argc, char** argv)
         return;
     }
 
-    output << "_______________________________________________________"
-           << "_______________________________________________________"
-           << "_______________________________________________________"
-           << endl;
-
-    //Loop through all the corresponding inputs (cell, tech and arch files)
-    // and fill the array to print in a clean layout
-    for(size_t configID = 0; configID < arg->configs.size(); ++configID)
-    {
-//        ofstream csvResultFile;
-//        string csvResultFileName("results_for_config_");
-//        csvResultFileName.append(to_string(configID));
-//        csvResultFileName.append(".csv");
-//        csvResultFile.open(csvResultFileName, ofstream::trunc);
-
-        output << "RRAM Configuration: "
-               << configID+1
-               << endl;
-        output << "\tCell filename: "
-               << arg->configs.at(configID).cellFileName
-               << endl;
-        output << "\tTechnology filename: "
-               << arg->configs.at(configID).techFileName
-               << endl;
-        output << "\tArchitecture filename:  "
-               << arg->configs.at(configID).archFileName
-               << endl;
+    setLogLevel(logLevelFromName(arg->logLevelName));
+
+    if ( !arg->traceFileName.empty() ) {
+#if !RRAMSPEC_TRACE
+        PRINT_WARNING("Trace events are compiled out (RRAMSPEC_TRACE=0)"
+                      << " - the trace is empty.");
+#endif
+        setTraceEnabled(true);
+    }
+
+    // Answers go straight to the client, not to the output
+    if ( arg->serverMode ) {
+        RRAMSpecServer server;
+        if ( arg->serverSocketPath.empty() ) {
+            server.serveStream(cin, cout);
+        }
+        else {
+            server.serveSocket(arg->serverSocketPath);
+        }
+        return;
+    }
+
+    if ( arg->printStats ) {
+#if !RRAMSPEC_STATS
+        PRINT_WARNING("Performance counters are compiled out"
+                      << " (RRAMSPEC_STATS=0) - all of them are zero.");
+#endif
+        setPerfStatsEnabled(true);
+    }
+
+    // Records are streamed to stdout, so the messages go to stderr
+    if ( arg->outputFormat != "table" ) {
+        writeRecords();
+        return;
+    }
+
+    cout << "_______________________________________________________"
+         << "_______________________________________________________"
+         << "_______________________________________________________"
+         << endl;
+
+    //Run all the corresponding inputs (cell, tech and arch files), up to
+    // nJobs at once, and print them in a clean layout
+    // Each configuration keeps its results and messages apart, and is
+    // printed once it and all the ones before it are done, so the output
+    // streams in the input order. A failing configuration only replaces
+    // its own results by its error, printed to stderr
+    size_t nConfigs = arg->configs.size();
+    vector<string> configOutputs(nConfigs);
+    vector<ostringstream> configMessages(nConfigs);
+    vector<string> configErrors(nConfigs);
+    vector<bool> configDone(nConfigs, false);
+    size_t nextConfigID = 0;
+    mutex outputMutex;
+
+    auto runConfig = [&](size_t configID) {
+        ostringstream configOutput;
+
+        configOutput << "RRAM Configuration: "
+                     << configID+1
+                     << endl;
+        configOutput << "\tCell filename: "
+                     << arg->configs.at(configID).cellFileName
+                     << endl;
+        configOutput << "\tTechnology filename: "
+                     << arg->configs.at(configID).techFileName
+                     << endl;
+        configOutput << "\tArchitecture filename:  "
+                     << arg->configs.at(configID).archFileName
+                     << endl;
 
         try{
-            bank = new Bank(arg->configs.at(configID));
+            Bank bank(arg->configs.at(configID));
+            RRAMSpecResults results = collectRRAMSpecResults(bank);
+
+            if ( results.optMode == "pareto" ) {
+                configOutput << arrangeParetoFront(results) << endl;
+            }
+            configOutput << arrangeOutput("stdout", results) << endl;
         } catch(string exceptionMsgThrown) {
-            throw exceptionMsgThrown;
+            configErrors[configID] = exceptionMsgThrown;
+        } catch(...) {
+            configErrors[configID] = "[ERROR] Unexpected behaviour - ";
+            configErrors[configID].append("configuration run failed.");
         }
-//        jsonOutputWrite(configID+1);
-
-//        csvResultFile << "Label,"
-//                      << "Technology filename: " << arg->technologyFileName[configID]
-//                      << "  Parameter filename: " << arg->architectureFileName[configID]
-//                      << endl;
-
-//        try {
-//            csvResultFile << arrangeOutput("csv");
-//        } catch(string exceptionMsgThrown) {
-//            throw exceptionMsgThrown;
-//        }
-//        csvResultFile.close();
-
-        try {
-            output << arrangeOutput("stdout") << endl;
-        } catch(string exceptionMsgThrown) {
-            throw exceptionMsgThrown;
+        if (arg->printAllVariables) {
         }
 
-        if (arg->printAllVariables) {
+        configOutputs[configID] = configOutput.str();
+    };
+
+    // Messages of a configuration are printed right before its results,
+    //  warnings and errors to stderr
+    //  Counters of the worker threads add up in this thread
+    PerfStatsCollection statsCollection;
+    runParallelTasks(nConfigs, arg->nJobs, [&](size_t configID) {
+        {
+            MessageRedirection redirection(&configMessages[configID]);
+            runConfig(configID);
         }
 
-        output  << "_______________________________________________________"
-                << "_______________________________________________________"
-                << "_______________________________________________________"
-                << endl;
+        lock_guard<mutex> lock(outputMutex);
+        configDone[configID] = true;
+        for ( ; nextConfigID < nConfigs && configDone[nextConfigID];
+              ++nextConfigID) {
+            printMessages(configMessages[nextConfigID].str());
+            cout << configOutputs[nextConfigID];
+            if ( !configErrors[nextConfigID].empty() ) {
+                printMessages(configErrors[nextConfigID] + "\n\n");
+                ++nFailedConfigs;
+            }
+            cout << "_______________________________________________________"
+                 << "_______________________________________________________"
+                 << "_______________________________________________________"
+                 << endl;
+            configMessages[nextConfigID] = ostringstream();
+            configOutputs[nextConfigID] = string();
+        }
+    });
 
+    if ( arg->printStats ) {
+        cout << arrangePerfStats(statsCollection.collected())
+             << "_______________________________________________________"
+             << "_______________________________________________________"
+             << "_______________________________________________________"
+             << endl;
     }
 }
+
+void RRAMSpec::writeRecords()
+{
+    ResultWriter writer(cout, arg->outputFormat, arg->printStats);
+
+    // Each record is written once its configuration and all the ones
+    // before it are done, so records stream in the input order
+    size_t nConfigs = arg->configs.size();
+    vector<RRAMSpecResults> configResults(nConfigs);
+    vector<string> configErrors(nConfigs);
+    vector<bool> configDone(nConfigs, false);
+    size_t nextConfigID = 0;
+    mutex writerMutex;
+
+    runParallelTasks(nConfigs, arg->nJobs, [&](size_t configID) {
+        const Config& config = arg->configs.at(configID);
+        try{
+            configResults[configID] = runRRAMSpecConfig(config);
+        } catch(string exceptionMsgThrown) {
+            configErrors[configID] = exceptionMsgThrown;
+        } catch(...) {
+            configErrors[configID] = "[ERROR] Unexpected behaviour - ";
+            configErrors[configID].append("configuration run failed.");
+        }
+
+        lock_guard<mutex> lock(writerMutex);
+        configDone[configID] = true;
+        for ( ; nextConfigID < nConfigs && configDone[nextConfigID];
+              ++nextConfigID) {
+            RRAMSpecResults& results = configResults[nextConfigID];
+            cerr << results.messages;
+            if ( configErrors[nextConfigID].empty() ) {
+                writer.writeResults(nextConfigID,
+                                    arg->configs.at(nextConfigID), results);
+            }
+            else {
+                writer.writeError(nextConfigID,
+                                  arg->configs.at(nextConfigID),
+                                  configErrors[nextConfigID]);
+                ++nFailedConfigs;
+            }
+            results = RRAMSpecResults();
+        }
+    });
+}
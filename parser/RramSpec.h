@@ -38,10 +38,14 @@
 #define RERAMSPEC_H
 
 #include "ArgumentsParser.h"
+#include "ResultWriter.h"
+#include "RramServer.h"
+#include "RramSpecLib.h"
 
 #include "../core/Bank.h"
 
 #include <ctime>
+#include <mutex>
 #include <cmath>
 #include <iostream>
 #include <fstream>
@@ -57,7 +61,7 @@
 
 using namespace std;
 
-// Very specific macro to be used inside arrangeOutput() function
+// Very specific macro to be used inside the arrange*() functions
 #define BUILD_LINE(label, value) \
     setw(lineWidth) \
     << left << label \
@@ -70,14 +74,22 @@ class RRAMSpec
 public:
     RRAMSpec(int argc, char** argv);
 
-    void jsonOutputWrite(int dramConfigID);
-    string arrangeOutput(const string isCsv);
+    string arrangeOutput(const string isCsv, const RRAMSpecResults& results);
+    string arrangeParetoFront(const RRAMSpecResults& results);
+    // Performance counters summed over all the configurations
+    string arrangePerfStats(const PerfStats& stats);
 
     void runRramSpec(int argc, char** argv);
+    // Runs the configurations streaming their results to stdout as records
+    //  in the chosen output format, instead of the table
+    void writeRecords();
 
     ArgumentsParser * arg;
-    Bank * bank;
+    // Configurations whose run failed - their error replaces their results
+    size_t nFailedConfigs;
 
+    // Help text, printed once the run returns - results are printed to
+    //  stdout as soon as they are done
     ostringstream output;
 };
 
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+#include "RramSpecLib.h"
+
+#include <sstream>
+
+RRAMSpecResults
+runRRAMSpecConfig(const Config& config)
+{
+  RRAMSpecResults results;
+
+  // Messages are kept apart from whatever the calling thread prints
+  ostringstream messages;
+  {
+    MessageRedirection redirection(&messages);
+    PerfStatsCollection statsCollection;
+    Bank bank(config);
+
+    results = collectRRAMSpecResults(bank);
+    results.stats = statsCollection.collected();
+  }
+
+  results.messages = messages.str();
+  return results;
+}
+
+RRAMSpecResults
+collectRRAMSpecResults(const Bank& bank)
+{
+  RRAMSpecResults results;
+
+  results.optMode = bank.getOptMode();
+
+  results.rowDecoderDelay = SCALE_QUANTITY(bank.getRowDecoderDelay(),
+                                           rrs::nanosecond_unit);
+  results.colDecoderDelay = SCALE_QUANTITY(bank.getColDecoderDelay(),
+                                           rrs::nanosecond_unit);
+  results.globalBusDelay = SCALE_QUANTITY(bank.getGlobalBusDelay(),
+                                          rrs::nanosecond_unit);
+  results.prechargeTime = SCALE_QUANTITY(bank.getPrechargeTime(),
+                                         rrs::nanosecond_unit);
+  results.writeTime = SCALE_QUANTITY(bank.getWriteTime(),
+                                     rrs::nanosecond_unit);
+  results.readTime = SCALE_QUANTITY(bank.getReadTime(), rrs::nanosecond_unit);
+  results.tccdr = SCALE_QUANTITY(bank.getTccdr(), rrs::nanosecond_unit);
+  results.tccdw = SCALE_QUANTITY(bank.getTccdw(), rrs::nanosecond_unit);
+  results.trl = SCALE_QUANTITY(bank.getTrl(), rrs::nanosecond_unit);
+  results.twl = SCALE_QUANTITY(bank.getTwl(), rrs::nanosecond_unit);
+
+  results.interfaceBusEnergy = SCALE_QUANTITY(bank.getInterfaceBusEnergy(),
+                                              rrs::picojoule_unit);
+  results.prechargeEnergy = SCALE_QUANTITY(bank.getPrechargeEnergy(),
+                                           rrs::picojoule_unit);
+  results.readEnergy = SCALE_QUANTITY(bank.getReadEnergy(),
+                                      rrs::picojoule_unit);
+  results.writeEnergy = SCALE_QUANTITY(bank.getWriteEnergy(),
+                                       rrs::picojoule_unit);
+  results.leakagePower = SCALE_QUANTITY(bank.getLeakagePower(),
+                                        rrs::nanowatt_unit);
+
+  results.nSubarrays = bank.getNSubarrays();
+  results.nActiveSubarraysPerAccess = bank.getNActiveSubarraysPerAccess();
+  results.nSubarraysPerRow = bank.getNSubarraysPerRow();
+  results.nSubarraysPerCol = bank.getNSubarraysPerCol();
+  results.pageSize = bank.getPageSize();
+  results.nRowAddressLines = bank.getNRowAddressLines();
+  results.nColAddressLines = bank.getNColAddressLines();
+  results.bankHeight = SCALE_QUANTITY(bank.getHeight(), rrs::nanometer_unit);
+  results.bankWidth = SCALE_QUANTITY(bank.getWidth(), rrs::nanometer_unit);
+  results.bankArea = SCALE_QUANTITY(bank.getArea(),
+                                    rrs::square_nanometer_unit);
+  results.bankAreaEfficiency = bank.getAreaEfficiency();
+
+  const XPointArray& subarray = bank.subarray;
+  results.nRows = subarray.getNRows();
+  results.nCols = subarray.getNCols();
+  results.subarrayHeight = SCALE_QUANTITY(subarray.getHeight(),
+                                          rrs::nanometer_unit);
+  results.subarrayWidth = SCALE_QUANTITY(subarray.getWidth(),
+                                         rrs::nanometer_unit);
+  results.subarrayArea = SCALE_QUANTITY(subarray.getArea(),
+                                        rrs::square_nanometer_unit);
+  results.subarrayAreaEfficiency = subarray.getAreaEfficiency();
+
+  results.readVoltage = subarray.getReadVoltage();
+  results.writeVoltage = subarray.getWriteVoltage();
+  results.wlDelay = SCALE_QUANTITY(subarray.getWLDelay(),
+                                   rrs::nanosecond_unit);
+  results.blDelay = SCALE_QUANTITY(subarray.getBLDelay(),
+                                   rrs::nanosecond_unit);
+  results.subarrayPrechargeTime = SCALE_QUANTITY(subarray.getPrechargeTime(),
+                                                 rrs::nanosecond_unit);
+  results.setTime = SCALE_QUANTITY(subarray.getSetTime(),
+                                   rrs::nanosecond_unit);
+  results.resetTime = SCALE_QUANTITY(subarray.getResetTime(),
+                                     rrs::nanosecond_unit);
+  results.subarrayWriteTime = SCALE_QUANTITY(subarray.getWriteTime(),
+                                             rrs::nanosecond_unit);
+  results.subarrayReadTime = SCALE_QUANTITY(subarray.getReadTime(),
+                                            rrs::nanosecond_unit);
+  results.setCurrent = SCALE_QUANTITY(subarray.getSetCurrent(),
+                                      rrs::nanoampere_unit);
+  results.resetCurrent = SCALE_QUANTITY(subarray.getResetCurrent(),
+                                        rrs::nanoampere_unit);
+  results.readHRSSCCurrent = SCALE_QUANTITY(subarray.getReadHRSSCCurrent(),
+                                            rrs::nanoampere_unit);
+  results.readHRSSPCurrent = SCALE_QUANTITY(subarray.getReadHRSSPCurrent(),
+                                            rrs::nanoampere_unit);
+  results.readLRSSCCurrent = SCALE_QUANTITY(subarray.getReadLRSSCCurrent(),
+                                            rrs::nanoampere_unit);
+  results.readLRSSPCurrent = SCALE_QUANTITY(subarray.getReadLRSSPCurrent(),
+                                            rrs::nanoampere_unit);
+  results.prechargeCurrent = SCALE_QUANTITY(subarray.getPrechargeCurrent(),
+                                            rrs::nanoampere_unit);
+  results.writeCurrent = SCALE_QUANTITY(subarray.getWriteCurrent(),
+                                        rrs::nanoampere_unit);
+  results.readCurrent = SCALE_QUANTITY(subarray.getReadCurrent(),
+                                       rrs::nanoampere_unit);
+  results.subarrayPrechargeEnergy =
+    SCALE_QUANTITY(subarray.getPrechargeEnergy(), rrs::picojoule_unit);
+  results.subarrayWriteEnergy = SCALE_QUANTITY(subarray.getWriteEnergy(),
+                                               rrs::picojoule_unit);
+  results.subarrayReadEnergy = SCALE_QUANTITY(subarray.getReadEnergy(),
+                                              rrs::picojoule_unit);
+
+  results.paretoFront = bank.getParetoFront();
+
+  return results;
+}
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+#ifndef RRAMSPECLIB_H
+#define RRAMSPECLIB_H
+
+#include "ArgumentsParser.h"
+
+#include "../core/Bank.h"
+
+#include "../expandedBoostUnits/Units/rramSpec_units.h"
+
+#include <string>
+#include <vector>
+
+namespace bu=boost::units;
+namespace rrs=boost::units::rramspec;
+
+using namespace std;
+
+/* Entry point of the embeddable RRAMSpec library (librramspec), for
+ * callers running the model in-process, e.g. from a design space
+ * exploration loop. A configuration is given by its description files or
+ * by their JSON texts in memory, and its results come back typed, in the
+ * units they are reported in (ns, pJ, nW, nA, nm) - the pareto front
+ * solutions keep the SI units of the model. Nothing is printed: all the
+ * messages of the model, warnings included, are returned with the results.
+ * Several configurations may be run at once from different threads.
+*/
+
+// Results of one configuration
+struct RRAMSpecResults {
+  string optMode;
+
+  // Bank timings
+  bu::quantity<rrs::nanosecond_unit> rowDecoderDelay;
+  bu::quantity<rrs::nanosecond_unit> colDecoderDelay;
+  bu::quantity<rrs::nanosecond_unit> globalBusDelay;
+  bu::quantity<rrs::nanosecond_unit> prechargeTime;
+  bu::quantity<rrs::nanosecond_unit> writeTime;
+  bu::quantity<rrs::nanosecond_unit> readTime;
+  bu::quantity<rrs::nanosecond_unit> tccdr;
+  bu::quantity<rrs::nanosecond_unit> tccdw;
+  bu::quantity<rrs::nanosecond_unit> trl;
+  bu::quantity<rrs::nanosecond_unit> twl;
+
+  // Bank energies and power
+  bu::quantity<rrs::picojoule_unit> interfaceBusEnergy;
+  bu::quantity<rrs::picojoule_unit> prechargeEnergy;
+  bu::quantity<rrs::picojoule_unit> readEnergy;
+  bu::quantity<rrs::picojoule_unit> writeEnergy;
+  bu::quantity<rrs::nanowatt_unit> leakagePower;
+
+  // Bank organization and geometry
+  bu::quantity<rrs::dimensionless> nSubarrays;
+  bu::quantity<rrs::dimensionless> nActiveSubarraysPerAccess;
+  bu::quantity<rrs::dimensionless> nSubarraysPerRow;
+  bu::quantity<rrs::dimensionless> nSubarraysPerCol;
+  bu::quantity<rrs::bit_unit> pageSize;
+  bu::quantity<rrs::dimensionless> nRowAddressLines;
+  bu::quantity<rrs::dimensionless> nColAddressLines;
+  bu::quantity<rrs::nanometer_unit> bankHeight;
+  bu::quantity<rrs::nanometer_unit> bankWidth;
+  bu::quantity<rrs::square_nanometer_unit> bankArea;
+  bu::quantity<rrs::dimensionless> bankAreaEfficiency;
+
+  // Subarray geometry
+  bu::quantity<rrs::dimensionless> nRows;
+  bu::quantity<rrs::dimensionless> nCols;
+  bu::quantity<rrs::nanometer_unit> subarrayHeight;
+  bu::quantity<rrs::nanometer_unit> subarrayWidth;
+  bu::quantity<rrs::square_nanometer_unit> subarrayArea;
+  bu::quantity<rrs::dimensionless> subarrayAreaEfficiency;
+
+  // Subarray operation - chosen voltages, timings, currents and energies
+  bu::quantity<rrs::volt_unit> readVoltage;
+  bu::quantity<rrs::volt_unit> writeVoltage;
+  bu::quantity<rrs::nanosecond_unit> wlDelay;
+  bu::quantity<rrs::nanosecond_unit> blDelay;
+  bu::quantity<rrs::nanosecond_unit> subarrayPrechargeTime;
+  bu::quantity<rrs::nanosecond_unit> setTime;
+  bu::quantity<rrs::nanosecond_unit> resetTime;
+  bu::quantity<rrs::nanosecond_unit> subarrayWriteTime;
+  bu::quantity<rrs::nanosecond_unit> subarrayReadTime;
+  bu::quantity<rrs::nanoampere_unit> setCurrent;
+  bu::quantity<rrs::nanoampere_unit> resetCurrent;
+  bu::quantity<rrs::nanoampere_unit> readHRSSCCurrent;
+  bu::quantity<rrs::nanoampere_unit> readHRSSPCurrent;
+  bu::quantity<rrs::nanoampere_unit> readLRSSCCurrent;
+  bu::quantity<rrs::nanoampere_unit> readLRSSPCurrent;
+  bu::quantity<rrs::nanoampere_unit> prechargeCurrent;
+  bu::quantity<rrs::nanoampere_unit> writeCurrent;
+  bu::quantity<rrs::nanoampere_unit> readCurrent;
+  bu::quantity<rrs::picojoule_unit> subarrayPrechargeEnergy;
+  bu::quantity<rrs::picojoule_unit> subarrayWriteEnergy;
+  bu::quantity<rrs::picojoule_unit> subarrayReadEnergy;
+
+  // Non-dominated array sizes - pareto mode only
+  vector<Bank::SolutionCandidate> paretoFront;
+
+  // Messages printed by the model while running the configuration
+  string messages;
+
+  // Performance counters of the run - zero unless enabled, see PerfStats.h
+  PerfStats stats = PerfStats();
+};
+
+// Runs the configuration - each description is taken from its JSON text
+//  in config, or from its file when the text is empty. Failures throw the
+//  [ERROR] message as a string, as everywhere in RRAMSpec
+RRAMSpecResults runRRAMSpecConfig(const Config& config);
+
+// Results of a bank already built and run - with no messages
+RRAMSpecResults collectRRAMSpecResults(const Bank& bank);
+
+#endif // RRAMSPECLIB_H
@@ -0,0 +1,13 @@
+#!/bin/bash
+
+script="`readlink -f "${BASH_SOURCE[0]}"`"
+CALLDIR="`dirname "$script"`"
+cd ${CALLDIR}
+
+qmake CONFIG+=release CONFIG+=rramspec_bench RRAMSpec.pro
+echo "Compiling..."
+sleep 0.1
+make -s -j 16
+
+echo "Benchmarking..."
+./build/release/rramspec_bench "$@"
@@ -81,6 +81,27 @@ BOOST_AUTO_TEST_CASE( checkInputParametersParser_wrong_first_flag )
           "(Include IO termination currents for read and write operations.)\n"
         "    -printAll                                 "
           "(Enable print out of all internal variables.)\n"
+        "    -j       <N>                              "
+          "(Run up to N configurations at once, 0 for all hardware "
+            "threads. Default is 1.)\n"
+        "    -server                                   "
+          "(Answer newline-delimited JSON requests on stdin instead of "
+            "running configurations.)\n"
+        "    -socket  <path/to/socket>                 "
+          "(Answer newline-delimited JSON requests on a Unix socket "
+            "instead of running configurations.)\n"
+        "    -output  <table|jsonl|csv>                "
+          "(Print the results as a table, as JSON lines or as CSV. "
+            "Default is table.)\n"
+        "    -log     <error|warning|info|debug>       "
+          "(Print the messages of this level and the more important "
+            "ones. Default is info.)\n"
+        "    -stats                                    "
+          "(Report the performance counters of the solvers and the "
+            "model, per configuration in JSON lines and CSV.)\n"
+        "    -trace   <path/to/trace.json>             "
+          "(Write a timeline of the model evaluation as a Chrome "
+            "trace.)\n"
         "For more information, see README.md.\n";
 
     string expectedMsg("[ERROR] ");
@@ -132,6 +153,27 @@ BOOST_AUTO_TEST_CASE( checkInputParametersParser_wrong_second_flag1 )
           "(Include IO termination currents for read and write operations.)\n"
         "    -printAll                                 "
           "(Enable print out of all internal variables.)\n"
+        "    -j       <N>                              "
+          "(Run up to N configurations at once, 0 for all hardware "
+            "threads. Default is 1.)\n"
+        "    -server                                   "
+          "(Answer newline-delimited JSON requests on stdin instead of "
+            "running configurations.)\n"
+        "    -socket  <path/to/socket>                 "
+          "(Answer newline-delimited JSON requests on a Unix socket "
+            "instead of running configurations.)\n"
+        "    -output  <table|jsonl|csv>                "
+          "(Print the results as a table, as JSON lines or as CSV. "
+            "Default is table.)\n"
+        "    -log     <error|warning|info|debug>       "
+          "(Print the messages of this level and the more important "
+            "ones. Default is info.)\n"
+        "    -stats                                    "
+          "(Report the performance counters of the solvers and the "
+            "model, per configuration in JSON lines and CSV.)\n"
+        "    -trace   <path/to/trace.json>             "
+          "(Write a timeline of the model evaluation as a Chrome "
+            "trace.)\n"
         "For more information, see README.md.\n";
 
     string expectedMsg("[ERROR] ");
@@ -183,6 +225,27 @@ BOOST_AUTO_TEST_CASE( checkInputParametersParser_wrong_third_flag )
           "(Include IO termination currents for read and write operations.)\n"
         "    -printAll                                 "
           "(Enable print out of all internal variables.)\n"
+        "    -j       <N>                              "
+          "(Run up to N configurations at once, 0 for all hardware "
+            "threads. Default is 1.)\n"
+        "    -server                                   "
+          "(Answer newline-delimited JSON requests on stdin instead of "
+            "running configurations.)\n"
+        "    -socket  <path/to/socket>                 "
+          "(Answer newline-delimited JSON requests on a Unix socket "
+            "instead of running configurations.)\n"
+        "    -output  <table|jsonl|csv>                "
+          "(Print the results as a table, as JSON lines or as CSV. "
+            "Default is table.)\n"
+        "    -log     <error|warning|info|debug>       "
+          "(Print the messages of this level and the more important "
+            "ones. Default is info.)\n"
+        "    -stats                                    "
+          "(Report the performance counters of the solvers and the "
+            "model, per configuration in JSON lines and CSV.)\n"
+        "    -trace   <path/to/trace.json>             "
+          "(Write a timeline of the model evaluation as a Chrome "
+            "trace.)\n"
         "For more information, see README.md.\n";
 
     string expectedMsg("[ERROR] ");
@@ -229,6 +292,27 @@ BOOST_AUTO_TEST_CASE( checkInputParametersParser_no_config )
           "(Include IO termination currents for read and write operations.)\n"
         "    -printAll                                 "
           "(Enable print out of all internal variables.)\n"
+        "    -j       <N>                              "
+          "(Run up to N configurations at once, 0 for all hardware "
+            "threads. Default is 1.)\n"
+        "    -server                                   "
+          "(Answer newline-delimited JSON requests on stdin instead of "
+            "running configurations.)\n"
+        "    -socket  <path/to/socket>                 "
+          "(Answer newline-delimited JSON requests on a Unix socket "
+            "instead of running configurations.)\n"
+        "    -output  <table|jsonl|csv>                "
+          "(Print the results as a table, as JSON lines or as CSV. "
+            "Default is table.)\n"
+        "    -log     <error|warning|info|debug>       "
+          "(Print the messages of this level and the more important "
+            "ones. Default is info.)\n"
+        "    -stats                                    "
+          "(Report the performance counters of the solvers and the "
+            "model, per configuration in JSON lines and CSV.)\n"
+        "    -trace   <path/to/trace.json>             "
+          "(Write a timeline of the model evaluation as a Chrome "
+            "trace.)\n"
         "For more information, see README.md.\n";
 
     string expectedMsg("[ERROR] ");
@@ -777,6 +861,332 @@ BOOST_AUTO_TEST_CASE( checkInputParametersParser_wrong_config_file )
 }
 
 
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_nJobs )
+{
+    int sim_argc = 5;
+    char* sim_argv[] = {"./executable",
+                        "-conf",
+                        "../../tests/configs/test_config.txt",
+                        "-j",
+                        "4"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("No exception.");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    std::string expectedMsg("No exception.");
+    BOOST_REQUIRE_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    BOOST_CHECK_MESSAGE(inputFileName.configs.size() == 1,
+                        "Number of configurations different "
+                        "from the expected:"
+                        << "\nExpected: " << 1
+                        << "\nGot:" << inputFileName.configs.size());
+
+    BOOST_CHECK_MESSAGE(inputFileName.nJobs == 4,
+                        "Number of jobs missmatch!"
+                        << "\nExpected: " << 4
+                        << "\nGot:" << inputFileName.nJobs);
+
+    // Number of jobs missing
+    int sim_argc2 = 4;
+    char* sim_argv2[] = {"./executable",
+                         "-conf",
+                         "../../tests/configs/test_config.txt",
+                         "-j"};
+
+    ArgumentsParser inputFileName2(sim_argc2, sim_argv2);
+
+    exceptionMsg = "No exception.";
+    try {
+        inputFileName2.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    expectedMsg = "[ERROR] Unexpected argument \'-j\'\n";
+    expectedMsg.append(inputFileName2.helpMessage);
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+}
+
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_server )
+{
+    int sim_argc = 3;
+    char* sim_argv[] = {"./executable",
+                        "-socket",
+                        "rramspec_test.sock"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("No exception.");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    std::string expectedMsg("No exception.");
+    BOOST_REQUIRE_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    BOOST_CHECK_MESSAGE(inputFileName.serverMode
+                        && inputFileName.serverSocketPath
+                           == "rramspec_test.sock",
+                        "Server socket missmatch!"
+                        << "\nExpected: rramspec_test.sock"
+                        << "\nGot:" << inputFileName.serverSocketPath);
+
+    BOOST_CHECK_MESSAGE(inputFileName.configs.empty(),
+                        "Number of configurations different "
+                        "from the expected:"
+                        << "\nExpected: " << 0
+                        << "\nGot:" << inputFileName.configs.size());
+
+    // Configurations come from the requests
+    int sim_argc2 = 4;
+    char* sim_argv2[] = {"./executable",
+                         "-server",
+                         "-conf",
+                         "../../tests/configs/test_config.txt"};
+
+    ArgumentsParser inputFileName2(sim_argc2, sim_argv2);
+
+    exceptionMsg = "No exception.";
+    try {
+        inputFileName2.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    expectedMsg = "[ERROR] Configuration files are given by the requests";
+    expectedMsg.append(" in server mode, not as arguments.\n");
+    expectedMsg.append(inputFileName2.helpMessage);
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+}
+
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_output )
+{
+    int sim_argc = 5;
+    char* sim_argv[] = {"./executable",
+                        "-conf",
+                        "../../tests/configs/test_config.txt",
+                        "-output",
+                        "csv"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("No exception.");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    std::string expectedMsg("No exception.");
+    BOOST_REQUIRE_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    BOOST_CHECK_MESSAGE(inputFileName.outputFormat == "csv",
+                        "Output format missmatch!"
+                        << "\nExpected: csv"
+                        << "\nGot:" << inputFileName.outputFormat);
+    BOOST_CHECK_EQUAL(inputFileName.configs.size(), 1);
+    BOOST_CHECK_EQUAL(inputFileName.logLevelName, "info");
+
+    // Unknown formats point at the flag
+    int sim_argc2 = 5;
+    char* sim_argv2[] = {"./executable",
+                         "-output",
+                         "xml",
+                         "-conf",
+                         "../../tests/configs/test_config.txt"};
+
+    ArgumentsParser inputFileName2(sim_argc2, sim_argv2);
+
+    exceptionMsg = "No exception.";
+    try {
+        inputFileName2.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    expectedMsg = "[ERROR] ";
+    expectedMsg.append("Unexpected argument \'");
+    expectedMsg.append("-output\'\n");
+    expectedMsg.append(inputFileName2.helpMessage);
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+}
+
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_log )
+{
+    int sim_argc = 5;
+    char* sim_argv[] = {"./executable",
+                        "-log",
+                        "warning",
+                        "-conf",
+                        "../../tests/configs/test_config.txt"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("No exception.");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    std::string expectedMsg("No exception.");
+    BOOST_REQUIRE_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    BOOST_CHECK_MESSAGE(inputFileName.logLevelName == "warning",
+                        "Log level missmatch!"
+                        << "\nExpected: warning"
+                        << "\nGot:" << inputFileName.logLevelName);
+
+    // Unknown levels point at the flag
+    int sim_argc2 = 3;
+    char* sim_argv2[] = {"./executable",
+                         "-log",
+                         "verbose"};
+
+    ArgumentsParser inputFileName2(sim_argc2, sim_argv2);
+
+    exceptionMsg = "No exception.";
+    try {
+        inputFileName2.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    expectedMsg = "[ERROR] ";
+    expectedMsg.append("Unexpected argument \'");
+    expectedMsg.append("-log\'\n");
+    expectedMsg.append(inputFileName2.helpMessage);
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+}
+
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_stats )
+{
+    int sim_argc = 4;
+    char* sim_argv[] = {"./executable",
+                        "-conf",
+                        "../../tests/configs/test_config.txt",
+                        "-stats"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    BOOST_CHECK_MESSAGE(inputFileName.printStats == false,
+                        "Performance counters reported by default!");
+
+    std::string exceptionMsg("No exception.");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    std::string expectedMsg("No exception.");
+    BOOST_REQUIRE_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    BOOST_CHECK_MESSAGE(inputFileName.printStats == true,
+                        "Performance counters flag not set!");
+    BOOST_CHECK_MESSAGE(inputFileName.configs.size() == 1,
+                        "Number of configurations missmatch!"
+                        << "\nExpected: 1"
+                        << "\nGot:" << inputFileName.configs.size());
+
+}
+
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_trace )
+{
+    int sim_argc = 5;
+    char* sim_argv[] = {"./executable",
+                        "-trace",
+                        "trace.json",
+                        "-conf",
+                        "../../tests/configs/test_config.txt"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("No exception.");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    std::string expectedMsg("No exception.");
+    BOOST_REQUIRE_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    BOOST_CHECK_MESSAGE(inputFileName.traceFileName == "trace.json",
+                        "Trace file name missmatch!"
+                        << "\nExpected: trace.json"
+                        << "\nGot:" << inputFileName.traceFileName);
+
+    // A missing file name points at the flag
+    int sim_argc2 = 4;
+    char* sim_argv2[] = {"./executable",
+                         "-trace",
+                         "-conf",
+                         "../../tests/configs/test_config.txt"};
+
+    ArgumentsParser inputFileName2(sim_argc2, sim_argv2);
+
+    exceptionMsg = "No exception.";
+    try {
+        inputFileName2.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    expectedMsg = "[ERROR] ";
+    expectedMsg.append("Unexpected argument \'");
+    expectedMsg.append("-trace\'\n");
+    expectedMsg.append(inputFileName2.helpMessage);
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif // ARGUMENTSPARSERTEST_CPP
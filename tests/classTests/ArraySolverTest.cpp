@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+
+#ifndef ARRAYSOLVERTEST_CPP
+#define ARRAYSOLVERTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../../core/ArraySolver.h"
+#include "../../core/LineSolver.h"
+
+#include "../../parser/ArgumentsParser.h"
+
+namespace bu=boost::units;
+namespace rrs=boost::units::rramspec;
+
+using namespace std;
+
+BOOST_AUTO_TEST_SUITE( testArraySolver )
+
+BOOST_AUTO_TEST_CASE( checkArraySolver_Errors )
+{
+  string exceptionMsg("No exception.");
+  string expectedThrownMsg("No exception.");
+
+  exceptionMsg = "No exception.";
+  try {
+    ArraySolver myArraySolver;
+    myArraySolver.calcVSelectedCell(1., 1., 0.);
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+  expectedThrownMsg = "[ERROR] ";
+  expectedThrownMsg.append("Unexpected behaviour - ");
+  expectedThrownMsg.append("tried to run the array solver");
+  expectedThrownMsg.append(" before its lines and cells were set.\n");
+  BOOST_CHECK_MESSAGE( exceptionMsg == expectedThrownMsg,
+                       "Exception message from solving an unset array"
+                       << " different from the expected."
+                       << "\nExpected: " << expectedThrownMsg
+                       << "\nGot: " << exceptionMsg);
+
+  exceptionMsg = "No exception.";
+  try {
+    ArraySolver myArraySolver;
+    myArraySolver.setArray(1, 0, 1., 1., 1., 1., 1.);
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+  expectedThrownMsg = "[ERROR] ";
+  expectedThrownMsg.append("Unexpected behaviour - ");
+  expectedThrownMsg.append("tried to set up the array solver");
+  expectedThrownMsg.append(" with empty lines or unknown resistances.\n");
+  BOOST_CHECK_MESSAGE( exceptionMsg == expectedThrownMsg,
+                       "Exception message from setting an empty array"
+                       << " different from the expected."
+                       << "\nExpected: " << expectedThrownMsg
+                       << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_CASE( checkArraySolver_VsLineSolver )
+{
+  int sim_argc = 3;
+  char* sim_argv[] = {"./executable",
+                      "-conf",
+                      "../../tests/configs/test_config.txt"};
+
+  ArgumentsParser argParser(sim_argc, sim_argv);
+
+  Cell myCell;
+  string exceptionMsg("No exception.");
+  try {
+    argParser.runArgParser();
+    myCell = Cell(argParser.configs.at(0).cellFileName.c_str());
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+  string expectedThrownMsg("No exception.");
+  BOOST_REQUIRE_MESSAGE( exceptionMsg == expectedThrownMsg,
+                       "Exception message from cell constructor"
+                       << " different for the expected."
+                       << "\nExpected: " << expectedThrownMsg
+                       << "\nGot: " << exceptionMsg);
+
+  // A single selected PL on ideal unselected NLs is the lumped model
+  //  with no half selected cells on the NL
+  size_t nSigFigs = 4;
+
+  LineSolver myLineSolver;
+  myLineSolver.setMethod("newton");
+  myLineSolver.setLines(256, 1, 10., 0., 1000., 2000.);
+  myLineSolver.setCells(&myCell, &myCell, &myCell);
+
+  ArraySolver myArraySolver;
+  myArraySolver.setArray(256, 1, 10., 0., 1000., 2000., 0.);
+  myArraySolver.setCells(&myCell, &myCell);
+
+  double expDouble = myLineSolver.calcVSelectedCell(5.5, 5.5, 0.);
+  double gotValue = myArraySolver.calcVSelectedCell(5.5, 5.5, 0.);
+  BOOST_CHECK_MESSAGE( round(gotValue, nSigFigs)
+                        == round(expDouble, nSigFigs),
+                       setprecision(nSigFigs)
+                       << "Array solver selected cell voltage"
+                       << " different from the line solver one."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+
+  expDouble = myLineSolver.getSPCurrent();
+  gotValue = myArraySolver.getSPCurrent();
+  BOOST_CHECK_MESSAGE( round(gotValue, nSigFigs)
+                        == round(expDouble, nSigFigs),
+                       setprecision(nSigFigs)
+                       << "Array solver sneak path current"
+                       << " different from the line solver one."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+
+  expDouble = myLineSolver.calcVEdge(3., 0., true);
+  gotValue = myArraySolver.calcVEdge(3., 0., true);
+  BOOST_CHECK_MESSAGE( round(gotValue, nSigFigs)
+                        == round(expDouble, nSigFigs),
+                       setprecision(nSigFigs)
+                       << "Array solver driver voltage"
+                       << " different from the line solver one."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+
+  // Unselected lines bias must be set the same way on both models
+  myLineSolver.setBiasScheme(third_bias);
+  myArraySolver.setBiasScheme(third_bias);
+  expDouble = myLineSolver.calcVEdge(3., 0., true);
+  gotValue = myArraySolver.calcVEdge(3., 0., true);
+  BOOST_CHECK_MESSAGE( round(gotValue, nSigFigs)
+                        == round(expDouble, nSigFigs),
+                       setprecision(nSigFigs)
+                       << "Array solver V/3 driver voltage"
+                       << " different from the line solver one."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+
+  myLineSolver.setBiasScheme(floating_bias);
+  myArraySolver.setBiasScheme(floating_bias);
+  expDouble = myLineSolver.calcVEdge(3., 0., true);
+  gotValue = myArraySolver.calcVEdge(3., 0., true);
+  BOOST_CHECK_MESSAGE( round(gotValue, nSigFigs)
+                        == round(expDouble, nSigFigs),
+                       setprecision(nSigFigs)
+                       << "Array solver floating driver voltage"
+                       << " different from the line solver one."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+}
+
+BOOST_AUTO_TEST_CASE( checkArraySolver_Threads )
+{
+  int sim_argc = 3;
+  char* sim_argv[] = {"./executable",
+                      "-conf",
+                      "../../tests/configs/test_config.txt"};
+
+  ArgumentsParser argParser(sim_argc, sim_argv);
+
+  Cell myCell;
+  string exceptionMsg("No exception.");
+  try {
+    argParser.runArgParser();
+    myCell = Cell(argParser.configs.at(0).cellFileName.c_str());
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+  string expectedThrownMsg("No exception.");
+  BOOST_REQUIRE_MESSAGE( exceptionMsg == expectedThrownMsg,
+                       "Exception message from cell constructor"
+                       << " different for the expected."
+                       << "\nExpected: " << expectedThrownMsg
+                       << "\nGot: " << exceptionMsg);
+
+  // Results must not depend on the number of threads
+  ArraySolver serialSolver;
+  serialSolver.setNThreads(1);
+  serialSolver.setArray(256, 256, 10., 5., 1000., 2000., 1000.);
+  serialSolver.setCells(&myCell, &myCell);
+
+  ArraySolver parallelSolver;
+  parallelSolver.setNThreads(4);
+  parallelSolver.setArray(256, 256, 10., 5., 1000., 2000., 1000.);
+  parallelSolver.setCells(&myCell, &myCell);
+
+  double expDouble = serialSolver.calcVSelectedCell(5.5, 5.5, 0.);
+  double gotValue = parallelSolver.calcVSelectedCell(5.5, 5.5, 0.);
+  BOOST_CHECK_MESSAGE( gotValue == expDouble,
+                       setprecision(17)
+                       << "Multithreaded selected cell voltage"
+                       << " different from the single threaded one."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+
+  expDouble = serialSolver.getSPCurrent();
+  gotValue = parallelSolver.getSPCurrent();
+  BOOST_CHECK_MESSAGE( gotValue == expDouble,
+                       setprecision(17)
+                       << "Multithreaded sneak path current"
+                       << " different from the single threaded one."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // ARRAYSOLVERTEST_CPP
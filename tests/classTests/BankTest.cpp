@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+
+
+#ifndef BANKTEST_CPP
+#define BANKTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "../../core/Bank.h"
+
+#include "../../parser/ArgumentsParser.h"
+
+namespace bu=boost::units;
+namespace rrs=boost::units::rramspec;
+
+using namespace std;
+
+BOOST_AUTO_TEST_SUITE( testBank )
+
+BOOST_AUTO_TEST_CASE( checkBank_pareto )
+{
+
+  int sim_argc = 3;
+  char* sim_argv[] = {"./executable",
+                      "-conf",
+                      "../../tests/configs/test_config_pareto.txt"};
+
+  ArgumentsParser argParser(sim_argc, sim_argv);
+  argParser.runArgParser();
+
+  string exceptionMsg("No exception.");
+  string expectedThrownMsg("No exception.");
+
+  Bank* myBank = nullptr;
+  try {
+    myBank = new Bank(argParser.configs.at(0));
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+  BOOST_REQUIRE_MESSAGE( exceptionMsg == expectedThrownMsg,
+                       "Exception message from bank constructor"
+                       << " different from the expected."
+                       << "\nExpected: " << expectedThrownMsg
+                       << "\nGot: " << exceptionMsg);
+
+  BOOST_CHECK_MESSAGE( myBank->getOptMode() == "pareto",
+                       "Optimization mode different from the expected."
+                       << "\nExpected: pareto"
+                       << "\nGot: " << myBank->getOptMode());
+
+  auto paretoFront = myBank->getParetoFront();
+  BOOST_REQUIRE_MESSAGE( !paretoFront.empty(), "Empty Pareto front.");
+
+  auto objectives = [](const Bank::SolutionCandidate& solution) {
+    return vector<double>{ solution.tccdw.value(), solution.tccdr.value(),
+                           solution.writeEnergy.value(),
+                           solution.readEnergy.value(),
+                           solution.leakagePower.value(),
+                           solution.area.value() };
+  };
+
+  // No solution of the front dominates another one
+  for (const auto& lhs : paretoFront) {
+    for (const auto& rhs : paretoFront) {
+      BOOST_CHECK_MESSAGE( !dominates(objectives(lhs), objectives(rhs)),
+                           "Pareto front solution " << lhs.nRows << " x "
+                           << lhs.nCols << " dominates solution "
+                           << rhs.nRows << " x " << rhs.nCols << ".");
+    }
+  }
+
+  // Detailed results are the ones of the fastest write of the front
+  auto fastestTccdw = paretoFront.front().tccdw;
+  for (const auto& solution : paretoFront) {
+    fastestTccdw = min(fastestTccdw, solution.tccdw);
+  }
+  BOOST_CHECK_MESSAGE( myBank->getTccdw() == fastestTccdw,
+                       "Bank tCCDW different from the fastest of the front."
+                       << "\nExpected: " << fastestTccdw
+                       << "\nGot: " << myBank->getTccdw());
+
+  delete myBank;
+
+}
+
+BOOST_AUTO_TEST_CASE( checkBank_resultCache )
+{
+
+  int sim_argc = 3;
+  char* sim_argv[] = {"./executable",
+                      "-conf",
+                      "../../tests/configs/test_config_cache.txt"};
+
+  ArgumentsParser argParser(sim_argc, sim_argv);
+  argParser.runArgParser();
+
+  const char* cacheFileName = "test_bank_cache.bin";
+  remove(cacheFileName);
+  auto cacheFileSize = [cacheFileName]() {
+    ifstream cacheFile(cacheFileName, ifstream::binary | ifstream::ate);
+    return cacheFile.tellg();
+  };
+
+  // First run solves every array size, the second one only reads them
+  vector<Bank::SolutionCandidate> runResults;
+  vector<streampos> cacheFileSizes;
+  for (size_t runID = 0; runID < 2; ++runID) {
+    string exceptionMsg("No exception.");
+    string expectedThrownMsg("No exception.");
+    try {
+      Bank myBank(argParser.configs.at(0));
+
+      Bank::SolutionCandidate result;
+      result.nRows = myBank.subarray.getNRows();
+      result.nCols = myBank.subarray.getNCols();
+      result.tccdw = myBank.getTccdw();
+      result.tccdr = myBank.getTccdr();
+      result.writeEnergy = myBank.getWriteEnergy();
+      runResults.push_back(result);
+    }catch (string exceptionMsgThrown){
+      exceptionMsg = exceptionMsgThrown;
+    }
+    BOOST_REQUIRE_MESSAGE( exceptionMsg == expectedThrownMsg,
+                         "Exception message from bank constructor"
+                         << " different from the expected."
+                         << "\nExpected: " << expectedThrownMsg
+                         << "\nGot: " << exceptionMsg);
+    cacheFileSizes.push_back(cacheFileSize());
+  }
+
+  BOOST_CHECK_MESSAGE( cacheFileSizes[0] > 0,
+                       "No result stored in the result cache." );
+  BOOST_CHECK_MESSAGE( cacheFileSizes[1] == cacheFileSizes[0],
+                       "Results solved again despite the result cache."
+                       << "\nCache size after the first run: "
+                       << cacheFileSizes[0]
+                       << "\nCache size after the second run: "
+                       << cacheFileSizes[1]);
+
+  BOOST_CHECK_MESSAGE( runResults[1].nRows == runResults[0].nRows
+                       && runResults[1].nCols == runResults[0].nCols
+                       && runResults[1].tccdw == runResults[0].tccdw
+                       && runResults[1].tccdr == runResults[0].tccdr
+                       && runResults[1].writeEnergy
+                          == runResults[0].writeEnergy,
+                       "Results read from the result cache different from"
+                       << " the solved ones.");
+
+  remove(cacheFileName);
+
+}
+
+BOOST_AUTO_TEST_CASE( checkBank_failedCandidates )
+{
+
+  // A single iteration per solve - every candidate solved fails
+  Config config;
+  config.cellFileName = "../../tests/cells/test_cell.json";
+  config.techFileName = "../../tests/techs/test_tech.json";
+  config.archJSON = "{\"Optimization mode []\": \"performance\","
+                    " \"Solver iteration limit []\": 1,"
+                    " \"Bank capacity [Gb]\": 1,"
+                    " \"Data bus width [bits]\": 4,"
+                    " \"Prefetch []\": 4}";
+
+  // Warnings go with the other messages of the thread
+  ostringstream messages;
+  string exceptionMsg("No exception.");
+  try {
+    MessageRedirection redirection(&messages);
+    Bank myBank(config);
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+
+  // Candidates are skipped one by one, then the run fails as a whole
+  string expectedThrownMsg("[ERROR] Every candidate array size evaluated"
+                           " failed");
+  BOOST_CHECK_MESSAGE( exceptionMsg.find(expectedThrownMsg) == 0,
+                       "Exception message from bank constructor"
+                       << " different from the expected."
+                       << "\nExpected: " << expectedThrownMsg
+                       << "\nGot: " << exceptionMsg);
+  string expectedWarning("[WARNING] Skipped the ");
+  BOOST_CHECK_MESSAGE( messages.str().find(expectedWarning)
+                         != string::npos,
+                       "No warning for the skipped candidates."
+                       << "\nExpected: " << expectedWarning
+                       << "\nGot: " << messages.str());
+  expectedWarning = "Line solver did not converge after 1 iterations.";
+  BOOST_CHECK_MESSAGE( messages.str().find(expectedWarning)
+                         != string::npos,
+                       "Skipped candidates warning without the failure."
+                       << "\nExpected: " << expectedWarning
+                       << "\nGot: " << messages.str());
+
+  // Some candidates fail - the same ones are reported whatever the number
+  //  of candidates evaluated at once
+  vector<string> threadMessages;
+  for (string nThreads : {"1", "3", "8"}) {
+    config.archJSON = "{\"Optimization mode []\": \"performance\","
+                      " \"Solver iteration limit []\": 8,"
+                      " \"Optimization threads []\": " + nThreads + ","
+                      " \"Bank capacity [Gb]\": 1,"
+                      " \"Data bus width [bits]\": 4,"
+                      " \"Prefetch []\": 4}";
+    ostringstream runMessages;
+    exceptionMsg = "No exception.";
+    try {
+      MessageRedirection redirection(&runMessages);
+      Bank myBank(config);
+    }catch (string exceptionMsgThrown){
+      exceptionMsg = exceptionMsgThrown;
+    }
+    BOOST_REQUIRE_MESSAGE( exceptionMsg == "No exception.",
+                           "Exception message from bank constructor"
+                           << " on " << nThreads << " threads."
+                           << "\nGot: " << exceptionMsg);
+    threadMessages.push_back(runMessages.str());
+  }
+  BOOST_CHECK_MESSAGE( threadMessages[0].find("[WARNING] Skipped the ")
+                         != string::npos,
+                       "No candidate failed to check the reported ones.");
+  BOOST_CHECK_MESSAGE( threadMessages[1] == threadMessages[0]
+                       && threadMessages[2] == threadMessages[0],
+                       "Messages of the candidates depend on the threads."
+                       << "\nOn 1 thread: " << threadMessages[0]
+                       << "\nOn 3 threads: " << threadMessages[1]
+                       << "\nOn 8 threads: " << threadMessages[2]);
+
+  // Limits are checked on reading
+  config.archJSON = "{\"Optimization mode []\": \"performance\","
+                    " \"Solver time limit [s]\": -1,"
+                    " \"Bank capacity [Gb]\": 1,"
+                    " \"Data bus width [bits]\": 4,"
+                    " \"Prefetch []\": 4}";
+  exceptionMsg = "No exception.";
+  try {
+    MessageRedirection redirection(&messages);
+    Bank myBank(config);
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+  expectedThrownMsg = "[ERROR] Solver time limit must not be negative";
+  BOOST_CHECK_MESSAGE( exceptionMsg.find(expectedThrownMsg) == 0,
+                       "Exception message from bank constructor"
+                       << " different from the expected."
+                       << "\nExpected: " << expectedThrownMsg
+                       << "\nGot: " << exceptionMsg);
+
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // BANKTEST_CPP
@@ -241,22 +241,22 @@ BOOST_AUTO_TEST_CASE( checkCell_Setters_and_Getters )
 
 
   ++expDouble;
-  myCell.setSelDevLeakageCurrent( expDouble * rrs::nanoamperes );
+  myCell.setSelDevLeakageCurrent( expDouble * rrs::amperes );
   BOOST_CHECK_MESSAGE( myCell.getSelDevLeakageCurrent()
-                        == expDouble * rrs::nanoamperes,
+                        == expDouble * rrs::amperes,
                       "Selector device leakage current"
                        << " was not correctly set."
-                       << "\nExpected: " << expDouble * rrs::nanoamperes
+                       << "\nExpected: " << expDouble * rrs::amperes
                        << "\nGot: " << myCell.getSelDevLeakageCurrent());
 
 
   ++expDouble;
-  myCell.setSelDevMaxCurrent( expDouble * rrs::nanoamperes );
+  myCell.setSelDevMaxCurrent( expDouble * rrs::amperes );
   BOOST_CHECK_MESSAGE( myCell.getSelDevMaxCurrent()
-                        == expDouble * rrs::nanoamperes,
+                        == expDouble * rrs::amperes,
                       "Selector device maximum current"
                        << " was not correctly set."
-                       << "\nExpected: " << expDouble * rrs::nanoamperes
+                       << "\nExpected: " << expDouble * rrs::amperes
                        << "\nGot: " << myCell.getSelDevMaxCurrent());
 
 
@@ -271,12 +271,12 @@ BOOST_AUTO_TEST_CASE( checkCell_Setters_and_Getters )
 
 
   ++expDouble;
-  myCell.setSelCurrentDataPoint( expDouble * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( expDouble * rrs::amperes );
   BOOST_CHECK_MESSAGE( myCell.getSelCurrentDataPoints().at(0)
-                        == expDouble * rrs::nanoamperes,
+                        == expDouble * rrs::amperes,
                       "Selector device current data points"
                        << " was not correctly set."
-                       << "\nExpected: " << expDouble * rrs::nanoamperes
+                       << "\nExpected: " << expDouble * rrs::amperes
                        << "\nGot: " << myCell.getSelCurrentDataPoints().at(0));
 
   ++expDouble;
@@ -289,21 +289,21 @@ BOOST_AUTO_TEST_CASE( checkCell_Setters_and_Getters )
                        << "\nGot: " << myCell.getCellSetVoltage());
 
   ++expDouble;
-  myCell.setCellSetCurrent( expDouble * rrs::nanoamperes, only_set );
+  myCell.setCellSetCurrent( expDouble * rrs::amperes, only_set );
   BOOST_CHECK_MESSAGE( myCell.getCellSetCurrent()
-                        == expDouble * rrs::nanoamperes,
+                        == expDouble * rrs::amperes,
                       "Cell set current"
                        << " was not correctly set."
-                       << "\nExpected: " << expDouble * rrs::nanoamperes
+                       << "\nExpected: " << expDouble * rrs::amperes
                        << "\nGot: " << myCell.getCellSetCurrent());
 
   ++expDouble;
-  myCell.setCellSetComplianceCurrent( expDouble * rrs::nanoamperes );
+  myCell.setCellSetComplianceCurrent( expDouble * rrs::amperes );
   BOOST_CHECK_MESSAGE( myCell.getCellSetComplianceCurrent()
-                        == expDouble * rrs::nanoamperes,
+                        == expDouble * rrs::amperes,
                       "Cell set compliance current"
                        << " was not correctly set."
-                       << "\nExpected: " << expDouble * rrs::nanoamperes
+                       << "\nExpected: " << expDouble * rrs::amperes
                        << "\nGot: " << myCell.getCellSetComplianceCurrent());
 
   ++expDouble;
@@ -316,12 +316,12 @@ BOOST_AUTO_TEST_CASE( checkCell_Setters_and_Getters )
                        << "\nGot: " << myCell.getCellResetVoltage());
 
   ++expDouble;
-  myCell.setCellResetCurrent( expDouble * rrs::nanoamperes, only_set );
+  myCell.setCellResetCurrent( expDouble * rrs::amperes, only_set );
   BOOST_CHECK_MESSAGE( myCell.getCellResetCurrent()
-                        == expDouble * rrs::nanoamperes,
+                        == expDouble * rrs::amperes,
                       "Cell reset current"
                        << " was not correctly set."
-                       << "\nExpected: " << expDouble * rrs::nanoamperes
+                       << "\nExpected: " << expDouble * rrs::amperes
                        << "\nGot: " << myCell.getCellResetCurrent());
 
   ++expDouble;
@@ -334,48 +334,48 @@ BOOST_AUTO_TEST_CASE( checkCell_Setters_and_Getters )
                        << "\nGot: " << myCell.getCellReadVoltage());
 
   ++expDouble;
-  myCell.setCellReadCurrent( expDouble * rrs::nanoamperes, only_set );
+  myCell.setCellReadCurrent( expDouble * rrs::amperes, only_set );
   BOOST_CHECK_MESSAGE( myCell.getCellReadCurrent()
-                        == expDouble * rrs::nanoamperes,
+                        == expDouble * rrs::amperes,
                       "Cell read current"
                        << " was not correctly set."
-                       << "\nExpected: " << expDouble * rrs::nanoamperes
+                       << "\nExpected: " << expDouble * rrs::amperes
                        << "\nGot: " << myCell.getCellReadCurrent());
 
   ++expDouble;
-  myCell.setCellWidth( expDouble * rrs::nanometers );
+  myCell.setCellWidth( expDouble * rrs::meters );
   BOOST_CHECK_MESSAGE( myCell.getCellWidth()
-                        == expDouble * rrs::nanometers,
+                        == expDouble * rrs::meters,
                       "Cell width"
                        << " was not correctly set."
-                       << "\nExpected: " << expDouble * rrs::nanometers
+                       << "\nExpected: " << expDouble * rrs::meters
                        << "\nGot: " << myCell.getCellWidth());
 
   ++expDouble;
-  myCell.setCellHeight( expDouble * rrs::nanometers );
+  myCell.setCellHeight( expDouble * rrs::meters );
   BOOST_CHECK_MESSAGE( myCell.getCellHeight()
-                        == expDouble * rrs::nanometers,
+                        == expDouble * rrs::meters,
                       "Cell height"
                        << " was not correctly set."
-                       << "\nExpected: " << expDouble * rrs::nanometers
+                       << "\nExpected: " << expDouble * rrs::meters
                        << "\nGot: " << myCell.getCellHeight());
 
   ++expDouble;
-  myCell.setCellToCellSpacing( expDouble * rrs::nanometers );
+  myCell.setCellToCellSpacing( expDouble * rrs::meters );
   BOOST_CHECK_MESSAGE( myCell.getCellToCellSpacing()
-                        == expDouble * rrs::nanometers,
+                        == expDouble * rrs::meters,
                       "Cell to cell spacing"
                        << " was not correctly set."
-                       << "\nExpected: " << expDouble * rrs::nanometers
+                       << "\nExpected: " << expDouble * rrs::meters
                        << "\nGot: " << myCell.getCellToCellSpacing());
 
   ++expDouble;
-  myCell.setCellThickness( expDouble * rrs::nanometers );
+  myCell.setCellThickness( expDouble * rrs::meters );
   BOOST_CHECK_MESSAGE( myCell.getCellThickness()
-                        == expDouble * rrs::nanometers,
+                        == expDouble * rrs::meters,
                       "Cell thickness"
                        << " was not correctly set."
-                       << "\nExpected: " << expDouble * rrs::nanometers
+                       << "\nExpected: " << expDouble * rrs::meters
                        << "\nGot: " << myCell.getCellThickness());
 
 
@@ -524,9 +524,9 @@ BOOST_AUTO_TEST_CASE( checkCell_IxV_model_erros_SelectorDevice )
   string exceptionMsg = expectedThrownMsg;
 
   myCell.setSelVoltageDataPoint( 0. * rrs::volts );
-  myCell.setSelCurrentDataPoint( 0. * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 0. * rrs::amperes );
   myCell.setSelVoltageDataPoint( 1 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 2 * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 2e-9 * rrs::amperes );
 
   // One voltage point more than current points
   myCell.setSelVoltageDataPoint( 3 * rrs::volts );
@@ -550,8 +550,8 @@ BOOST_AUTO_TEST_CASE( checkCell_IxV_model_erros_SelectorDevice )
 
 
   // One voltage point more than current points
-  myCell.setSelCurrentDataPoint( 4 * rrs::nanoamperes );
-  myCell.setSelCurrentDataPoint( 5 * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 4e-9 * rrs::amperes );
+  myCell.setSelCurrentDataPoint( 5e-9 * rrs::amperes );
   expectedThrownMsg.clear();
   expectedThrownMsg.append("[ERROR] ");
   expectedThrownMsg.append("IxV curve based selector model");
@@ -610,8 +610,8 @@ BOOST_AUTO_TEST_CASE( checkCell_SelectorDevice )
   //  "A Cross Point Cu-RRAM with a Novel OTS Selector ..."
   //  from Shuichiro Yasuda et al.
   myCell.setSelDevSnapVoltage(3.2 * rrs::volts);
-  myCell.setSelDevLeakageCurrent(10. * rrs::nanoamperes);
-  myCell.setSelDevMaxCurrent(40e3 * rrs::nanoamperes);
+  myCell.setSelDevLeakageCurrent(1e-8 * rrs::amperes);
+  myCell.setSelDevMaxCurrent(4e-5 * rrs::amperes);
 
   expDouble = 3.2;
   BOOST_CHECK_MESSAGE( myCell.getSelDevSnapVoltage()
@@ -621,20 +621,20 @@ BOOST_AUTO_TEST_CASE( checkCell_SelectorDevice )
                        << "\nExpected: " << expDouble * rrs::volts
                        << "\nGot: " << myCell.getSelDevSnapVoltage());
 
-  expDouble = 10.;
+  expDouble = 1e-8;
   BOOST_CHECK_MESSAGE( myCell.getSelDevLeakageCurrent()
-                        == expDouble * rrs::nanoamperes,
+                        == expDouble * rrs::amperes,
                       "Selector device leakage current"
                        << " different for the expected."
-                       << "\nExpected: " << expDouble * rrs::nanoamperes
+                       << "\nExpected: " << expDouble * rrs::amperes
                        << "\nGot: " << myCell.getSelDevLeakageCurrent());
 
-  expDouble = 40e3;
+  expDouble = 4e-5;
   BOOST_CHECK_MESSAGE( myCell.getSelDevMaxCurrent()
-                        == expDouble * rrs::nanoamperes,
+                        == expDouble * rrs::amperes,
                       "Selector device maximum (saturation) current"
                        << " different for the expected."
-                       << "\nExpected: " << expDouble * rrs::nanoamperes
+                       << "\nExpected: " << expDouble * rrs::amperes
                        << "\nGot: " << myCell.getSelDevMaxCurrent());
 
   expectedThrownMsg.clear();
@@ -732,7 +732,9 @@ BOOST_AUTO_TEST_CASE( checkCell_SelectorDevice )
   exceptionMsg.append("No exception.");
   for (size_t i = 0; i < selVs.size(); i++) {
     try {
-      gotCurrent = myCell.calcSelCurrent(selVs.at(i) * rrs::volts);
+      gotCurrent = SCALE_QUANTITY(
+          myCell.calcSelCurrent(selVs.at(i) * rrs::volts),
+          rrs::nanoampere_unit);
     } catch(string exceptionMsgThrown) {
       exceptionMsg = exceptionMsgThrown;
     }
@@ -756,39 +758,39 @@ BOOST_AUTO_TEST_CASE( checkCell_SelectorDevice )
   //  "A Cross Point Cu-RRAM with a Novel OTS Selector ..."
   //  from Shuichiro Yasuda et al.
   myCell.setSelVoltageDataPoint( 0. * rrs::volts );
-  myCell.setSelCurrentDataPoint( 0. * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 0. * rrs::amperes );
   myCell.setSelVoltageDataPoint( 0.1 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 0.12 * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 1.2e-10 * rrs::amperes );
   myCell.setSelVoltageDataPoint( 1.6 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 0.12 * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 1.2e-10 * rrs::amperes );
   myCell.setSelVoltageDataPoint( 2 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 3.2 * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 3.2e-9 * rrs::amperes );
   myCell.setSelVoltageDataPoint( 2.25 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 8. * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 8e-9 * rrs::amperes );
   myCell.setSelVoltageDataPoint( 2.5 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 12. * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 1.2e-8 * rrs::amperes );
   myCell.setSelVoltageDataPoint( 2.75 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 16. * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 1.6e-8 * rrs::amperes );
   myCell.setSelVoltageDataPoint( 3.0 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 40. * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 4e-8 * rrs::amperes );
   myCell.setSelVoltageDataPoint( 3.1 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 120. * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 1.2e-7 * rrs::amperes );
   myCell.setSelVoltageDataPoint( 3.12 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 360. * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 3.6e-7 * rrs::amperes );
   myCell.setSelVoltageDataPoint( 3.14 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 1.2e3 * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 1.2e-6 * rrs::amperes );
   myCell.setSelVoltageDataPoint( 3.16 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 3.2e3 * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 3.2e-6 * rrs::amperes );
   myCell.setSelVoltageDataPoint( 3.18 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 8e3 * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 8e-6 * rrs::amperes );
   myCell.setSelVoltageDataPoint( 3.2 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 28e3 * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 2.8e-5 * rrs::amperes );
   myCell.setSelVoltageDataPoint( 4.0 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 34e3 * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 3.4e-5 * rrs::amperes );
   myCell.setSelVoltageDataPoint( 4.5 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 36e3 * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 3.6e-5 * rrs::amperes );
   myCell.setSelVoltageDataPoint( 6 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 40e3 * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 4e-5 * rrs::amperes );
 
   expectedThrownMsg.clear();
   expectedThrownMsg.append("[ERROR] ");
@@ -838,7 +840,9 @@ BOOST_AUTO_TEST_CASE( checkCell_SelectorDevice )
   exceptionMsg.append("No exception.");
   for (size_t i = 0; i < selVs.size(); i++) {
     try {
-      gotCurrent = myCell.calcSelCurrent(selVs.at(i) * rrs::volts);
+      gotCurrent = SCALE_QUANTITY(
+          myCell.calcSelCurrent(selVs.at(i) * rrs::volts),
+          rrs::nanoampere_unit);
     } catch(string exceptionMsgThrown) {
       exceptionMsg = exceptionMsgThrown;
     }
@@ -880,8 +884,8 @@ BOOST_AUTO_TEST_CASE( checkCell_CellCurrent_and_Voltage )
   //  "A Cross Point Cu-RRAM with a Novel OTS Selector ..."
   //  from Shuichiro Yasuda et al.
   myCell.setSelDevSnapVoltage(3.2 * rrs::volts);
-  myCell.setSelDevLeakageCurrent(10. * rrs::nanoamperes);
-  myCell.setSelDevMaxCurrent(40e3 * rrs::nanoamperes);
+  myCell.setSelDevLeakageCurrent(1e-8 * rrs::amperes);
+  myCell.setSelDevMaxCurrent(4e-5 * rrs::amperes);
 
   myCell.setMaxCurrentRelativeError( 1e-3 );
 
@@ -917,7 +921,9 @@ BOOST_AUTO_TEST_CASE( checkCell_CellCurrent_and_Voltage )
   exceptionMsg.append("No exception.");
   for (size_t i = 0; i < cellVs.size(); i++) {
     try {
-      gotCurrent = myCell.calcCellCurrent(cellVs.at(i) * rrs::volts);
+      gotCurrent = SCALE_QUANTITY(
+          myCell.calcCellCurrent(cellVs.at(i) * rrs::volts),
+          rrs::nanoampere_unit);
     } catch(string exceptionMsgThrown) {
       exceptionMsg = exceptionMsgThrown;
     }
@@ -948,7 +954,8 @@ BOOST_AUTO_TEST_CASE( checkCell_CellCurrent_and_Voltage )
   exceptionMsg.append("No exception.");
   for (size_t i = 0; i < cellVs.size(); i++) {
     try {
-      gotVoltage = myCell.calcCellVoltage( cellIs.at(i) * rrs::nanoamperes );
+      gotVoltage = myCell.calcCellVoltage(
+          SCALE_QUANTITY(cellIs.at(i) * rrs::nanoamperes, rrs::ampere_unit) );
     } catch(string exceptionMsgThrown) {
       exceptionMsg = exceptionMsgThrown;
     }
@@ -973,39 +980,39 @@ BOOST_AUTO_TEST_CASE( checkCell_CellCurrent_and_Voltage )
   //  "A Cross Point Cu-RRAM with a Novel OTS Selector ..."
   //  from Shuichiro Yasuda et al.
   myCell.setSelVoltageDataPoint( 0. * rrs::volts );
-  myCell.setSelCurrentDataPoint( 0. * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 0. * rrs::amperes );
   myCell.setSelVoltageDataPoint( 0.1 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 0.12 * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 1.2e-10 * rrs::amperes );
   myCell.setSelVoltageDataPoint( 1.6 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 0.12 * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 1.2e-10 * rrs::amperes );
   myCell.setSelVoltageDataPoint( 2 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 3.2 * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 3.2e-9 * rrs::amperes );
   myCell.setSelVoltageDataPoint( 2.25 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 8. * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 8e-9 * rrs::amperes );
   myCell.setSelVoltageDataPoint( 2.5 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 12. * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 1.2e-8 * rrs::amperes );
   myCell.setSelVoltageDataPoint( 2.75 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 16. * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 1.6e-8 * rrs::amperes );
   myCell.setSelVoltageDataPoint( 3.0 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 40. * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 4e-8 * rrs::amperes );
   myCell.setSelVoltageDataPoint( 3.1 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 120. * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 1.2e-7 * rrs::amperes );
   myCell.setSelVoltageDataPoint( 3.12 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 360. * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 3.6e-7 * rrs::amperes );
   myCell.setSelVoltageDataPoint( 3.14 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 1.2e3 * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 1.2e-6 * rrs::amperes );
   myCell.setSelVoltageDataPoint( 3.16 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 3.2e3 * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 3.2e-6 * rrs::amperes );
   myCell.setSelVoltageDataPoint( 3.18 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 8e3 * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 8e-6 * rrs::amperes );
   myCell.setSelVoltageDataPoint( 3.2 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 28e3 * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 2.8e-5 * rrs::amperes );
   myCell.setSelVoltageDataPoint( 4.0 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 34e3 * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 3.4e-5 * rrs::amperes );
   myCell.setSelVoltageDataPoint( 4.5 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 36e3 * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 3.6e-5 * rrs::amperes );
   myCell.setSelVoltageDataPoint( 6 * rrs::volts );
-  myCell.setSelCurrentDataPoint( 40e3 * rrs::nanoamperes );
+  myCell.setSelCurrentDataPoint( 4e-5 * rrs::amperes );
 
   expectedThrownMsg.clear();
   expectedThrownMsg.append("No exception.");
@@ -1024,8 +1031,8 @@ BOOST_AUTO_TEST_CASE( checkCell_CellCurrent_and_Voltage )
 
 
   cellVs = {0, 1, -1, 1.8, 2.9, 3.15, -3.15, 10, -10};
-  cellIs = {0, 0.119995, -0.119995, 1.65849, 30.2215,
-            453.624, -453.624, 40018.1, -40018.1};
+  cellIs = {0, 0.12, -0.12, 1.65922, 30.2224,
+            453.603, -453.603, 40000., -40000.};
   gotCurrent = INVALID_DOUBLE * rrs::nanoamperes;
 
   expectedThrownMsg.clear();
@@ -1034,7 +1041,9 @@ BOOST_AUTO_TEST_CASE( checkCell_CellCurrent_and_Voltage )
   exceptionMsg.append("No exception.");
   for (size_t i = 0; i < cellVs.size(); i++) {
     try {
-      gotCurrent = myCell.calcCellCurrent(cellVs.at(i) * rrs::volts);
+      gotCurrent = SCALE_QUANTITY(
+          myCell.calcCellCurrent(cellVs.at(i) * rrs::volts),
+          rrs::nanoampere_unit);
     } catch(string exceptionMsgThrown) {
       exceptionMsg = exceptionMsgThrown;
     }
@@ -1066,7 +1075,8 @@ BOOST_AUTO_TEST_CASE( checkCell_CellCurrent_and_Voltage )
   exceptionMsg.append("No exception.");
   for (size_t i = 0; i < cellVs.size(); i++) {
     try {
-      gotVoltage = myCell.calcCellVoltage( cellIs.at(i) * rrs::nanoamperes );
+      gotVoltage = myCell.calcCellVoltage(
+          SCALE_QUANTITY(cellIs.at(i) * rrs::nanoamperes, rrs::ampere_unit) );
     } catch(string exceptionMsgThrown) {
       exceptionMsg = exceptionMsgThrown;
     }
@@ -1199,7 +1209,8 @@ BOOST_AUTO_TEST_CASE( checkCell_BuildCell_IxV )
                          << "\nGot: " << round(gotVoltage, nSigFigs));
 
     expCurrent = cellIs.at(i) * rrs::nanoamperes;
-    gotCurrent = myCell.getSelCurrentDataPoints().at(i);
+    gotCurrent = SCALE_QUANTITY(myCell.getSelCurrentDataPoints().at(i),
+                                rrs::nanoampere_unit);
     BOOST_CHECK_MESSAGE( round(gotCurrent, nSigFigs) == expCurrent,
                          setprecision(nSigFigs)
                          << "Current point from selector device"
@@ -1240,7 +1251,8 @@ BOOST_AUTO_TEST_CASE( checkCell_BuildCell_IxV )
 //                       << "\nGot: " << round(gotCurrent, nSigFigs));
 
   expCurrent = 10000 * rrs::nanoamperes;
-  gotCurrent = myCell.getCellSetComplianceCurrent();
+  gotCurrent = SCALE_QUANTITY(myCell.getCellSetComplianceCurrent(),
+                              rrs::nanoampere_unit);
   BOOST_CHECK_MESSAGE( round(gotCurrent, nSigFigs) == expCurrent,
                        setprecision(nSigFigs)
                        << "Cell set compliance current"
@@ -1300,7 +1312,7 @@ BOOST_AUTO_TEST_CASE( checkCell_BuildCell_IxV )
   bu::quantity<rrs::nanometer_unit> gotLength;
 
   expLength = 50 * rrs::nanometers;
-  gotLength = myCell.getCellThickness();
+  gotLength = SCALE_QUANTITY(myCell.getCellThickness(), rrs::nanometer_unit);
   BOOST_CHECK_MESSAGE( round(gotLength, nSigFigs) == expLength,
                        setprecision(nSigFigs)
                        << "Cell thickness"
@@ -1400,7 +1412,8 @@ BOOST_AUTO_TEST_CASE( checkCell_BuildCell_semiIdeal )
   bu::quantity<rrs::nanoampere_unit> gotCurrent;
 
   expCurrent = 10 * rrs::nanoamperes;
-  gotCurrent = myCell.getSelDevLeakageCurrent();
+  gotCurrent = SCALE_QUANTITY(myCell.getSelDevLeakageCurrent(),
+                              rrs::nanoampere_unit);
   BOOST_CHECK_MESSAGE( round(gotCurrent, nSigFigs) == expCurrent,
                        setprecision(nSigFigs)
                        << "Selector device leakage current"
@@ -1410,7 +1423,8 @@ BOOST_AUTO_TEST_CASE( checkCell_BuildCell_semiIdeal )
 
 
   expCurrent = 50e3 * rrs::nanoamperes;
-  gotCurrent = myCell.getSelDevMaxCurrent();
+  gotCurrent = SCALE_QUANTITY(myCell.getSelDevMaxCurrent(),
+                              rrs::nanoampere_unit);
   BOOST_CHECK_MESSAGE( round(gotCurrent, nSigFigs) == expCurrent,
                        setprecision(nSigFigs)
                        << "Selector device maximum current"
@@ -1451,7 +1465,8 @@ BOOST_AUTO_TEST_CASE( checkCell_BuildCell_semiIdeal )
 //                       << "\nGot: " << round(gotCurrent, nSigFigs));
 
   expCurrent = 30000 * rrs::nanoamperes;
-  gotCurrent = myCell.getCellSetComplianceCurrent();
+  gotCurrent = SCALE_QUANTITY(myCell.getCellSetComplianceCurrent(),
+                              rrs::nanoampere_unit);
   BOOST_CHECK_MESSAGE( round(gotCurrent, nSigFigs) == expCurrent,
                        setprecision(nSigFigs)
                        << "Cell set compliance current"
@@ -1511,7 +1526,7 @@ BOOST_AUTO_TEST_CASE( checkCell_BuildCell_semiIdeal )
   bu::quantity<rrs::nanometer_unit> gotLength;
 
   expLength = 50 * rrs::nanometers;
-  gotLength = myCell.getCellThickness();
+  gotLength = SCALE_QUANTITY(myCell.getCellThickness(), rrs::nanometer_unit);
   BOOST_CHECK_MESSAGE( round(gotLength, nSigFigs) == expLength,
                        setprecision(nSigFigs)
                        << "Cell thickness"
@@ -1523,6 +1538,175 @@ BOOST_AUTO_TEST_CASE( checkCell_BuildCell_semiIdeal )
 }
 
 
+BOOST_AUTO_TEST_CASE( checkCell_IxVCache )
+{
+
+  int sim_argc = 3;
+  char* sim_argv[] = {"./executable",
+                      "-conf",
+                      "../../tests/configs/test_config.txt"};
+
+  ArgumentsParser argParser(sim_argc, sim_argv);
+
+  string exceptionMsg("No exception.");
+  try {
+      argParser.runArgParser();
+  }catch (string exceptionMsgThrown){
+      exceptionMsg = exceptionMsgThrown;
+  }
+  string expectedThrownMsg("No exception.");
+  BOOST_REQUIRE_MESSAGE( exceptionMsg == expectedThrownMsg,
+                       "Exception message from arguments parser run"
+                       << " different for the expected."
+                       << "\nExpected: " << expectedThrownMsg
+                       << "\nGot: " << exceptionMsg);
+
+  Cell::clearCellIxVCache();
+  BOOST_CHECK_MESSAGE( Cell::getCellIxVCacheSize() == 0,
+                       "Cell I-V cache not empty after being cleared.");
+
+  Cell myCell;
+  Cell otherCell;
+  exceptionMsg.clear();
+  exceptionMsg.append("No exception.");
+  try {
+    myCell = Cell(argParser.configs.at(0).cellFileName.c_str());
+    otherCell = Cell(argParser.configs.at(0).cellFileName.c_str());
+  }catch (string exceptionMsgThrown){
+      exceptionMsg = exceptionMsgThrown;
+  }
+  BOOST_REQUIRE_MESSAGE( exceptionMsg == expectedThrownMsg,
+                       "Exception message from cell constructor"
+                       << " different for the expected."
+                       << "\nExpected: " << expectedThrownMsg
+                       << "\nGot: " << exceptionMsg);
+
+  // Both cells have the same parameters, so share the same tables
+  BOOST_CHECK_MESSAGE( Cell::getCellIxVCacheSize() == 1,
+                       "Cell I-V cache size different for the expected."
+                       << "\nExpected: " << 1
+                       << "\nGot: " << Cell::getCellIxVCacheSize());
+
+  // Another series resistance gives other tables
+  otherCell.setMemDevHRSResistance(otherCell.getMemDevHRSResistance() * 2.);
+  otherCell.buildCellIxV();
+  BOOST_CHECK_MESSAGE( Cell::getCellIxVCacheSize() == 2,
+                       "Cell I-V cache size different for the expected."
+                       << "\nExpected: " << 2
+                       << "\nGot: " << Cell::getCellIxVCacheSize());
+
+  // Cached tables are the same as freshly built ones
+  myCell.setMemDevResistanceState(false);
+  otherCell.setMemDevResistanceState(false);
+  vector<double> cachedCurrents;
+  bool sharedTable = true;
+  for ( double vCell = 0.; vCell < 3.; vCell += 0.25 ) {
+    cachedCurrents.push_back(otherCell.getRawCellCurrent(vCell));
+    if ( cachedCurrents.back() != myCell.getRawCellCurrent(vCell) ) {
+      sharedTable = false;
+    }
+  }
+  BOOST_CHECK_MESSAGE( !sharedTable,
+                       "Cells with different resistances share a table.");
+  Cell::clearCellIxVCache();
+  otherCell.buildCellIxV();
+  size_t i = 0;
+  for ( double vCell = 0.; vCell < 3.; vCell += 0.25, ++i ) {
+    BOOST_CHECK_MESSAGE( otherCell.getRawCellCurrent(vCell)
+                          == cachedCurrents.at(i),
+                         "Cached cell current different from the built one"
+                         << " at " << vCell << " V."
+                         << "\nExpected: "
+                         << otherCell.getRawCellCurrent(vCell)
+                         << "\nGot: " << cachedCurrents.at(i));
+  }
+}
+
+BOOST_AUTO_TEST_CASE( checkCell_RawCellCurrents )
+{
+
+  int sim_argc = 3;
+  char* sim_argv[] = {"./executable",
+                      "-conf",
+                      "../../tests/configs/test_config.txt"};
+
+  ArgumentsParser argParser(sim_argc, sim_argv);
+
+  Cell myCell;
+  string exceptionMsg("No exception.");
+  try {
+    argParser.runArgParser();
+    myCell = Cell(argParser.configs.at(0).cellFileName.c_str());
+  }catch (string exceptionMsgThrown){
+      exceptionMsg = exceptionMsgThrown;
+  }
+  string expectedThrownMsg("No exception.");
+  BOOST_REQUIRE_MESSAGE( exceptionMsg == expectedThrownMsg,
+                       "Exception message from cell constructor"
+                       << " different for the expected."
+                       << "\nExpected: " << expectedThrownMsg
+                       << "\nGot: " << exceptionMsg);
+
+  // Voltages on and off the lookup grid, on both sides, past the table
+  vector<double> cellVs;
+  for ( double vCell = -3.; vCell < 3.; vCell += 0.0137 ) {
+    cellVs.push_back(vCell);
+  }
+  cellVs.push_back(0.);
+  cellVs.push_back(12.);
+  cellVs.push_back(-1e3);
+  cellVs.push_back(1e6);
+
+  for ( ebool state = 0; state < 2; ++state ) {
+    myCell.setMemDevResistanceState(state);
+
+    vector<double> gotCurrents(cellVs.size());
+    vector<double> gotConductances(cellVs.size());
+    myCell.getRawCellCurrents(cellVs.data(), gotCurrents.data(),
+                              gotConductances.data(), cellVs.size());
+    vector<double> gotInPlace = cellVs;
+    myCell.getRawCellCurrents(gotInPlace.data(), gotInPlace.data(),
+                              nullptr, gotInPlace.size());
+
+    for ( size_t i = 0; i < cellVs.size(); ++i ) {
+      // Grid lookup finds the same segment as the units aware search
+      double expDouble =
+          SCALE_QUANTITY(myCell.getCellCurrent(cellVs.at(i) * rrs::volts),
+                         rrs::nanoampere_unit).value();
+      double gotValue = myCell.getRawCellCurrent(cellVs.at(i)) * 1e9;
+      BOOST_CHECK_MESSAGE( round(gotValue, 10) == round(expDouble, 10),
+                           setprecision(10)
+                           << "Raw cell current different from the cell"
+                           << " current at " << cellVs.at(i) << " V."
+                           << "\nExpected: " << expDouble
+                           << "\nGot: " << gotValue);
+
+      double expConductance;
+      double expCurrent = myCell.getRawCellCurrent(cellVs.at(i),
+                                                   expConductance);
+      BOOST_CHECK_MESSAGE( gotCurrents.at(i) == expCurrent
+                            && gotConductances.at(i) == expConductance,
+                           setprecision(17)
+                           << "Batch cell current or slope different from"
+                           << " the single cell ones at "
+                           << cellVs.at(i) << " V."
+                           << "\nExpected: " << expCurrent
+                           << ", " << expConductance
+                           << "\nGot: " << gotCurrents.at(i)
+                           << ", " << gotConductances.at(i));
+
+      expCurrent = myCell.getRawCellCurrent(cellVs.at(i));
+      BOOST_CHECK_MESSAGE( gotInPlace.at(i) == expCurrent,
+                           setprecision(17)
+                           << "In place batch cell current different from"
+                           << " the single cell one at "
+                           << cellVs.at(i) << " V."
+                           << "\nExpected: " << expCurrent
+                           << "\nGot: " << gotInPlace.at(i));
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif // CELLTEST_CPP
@@ -41,6 +41,8 @@
 
 #include "../../utils/functions.h"
 
+#include <sstream>
+
 using namespace std;
 
 BOOST_AUTO_TEST_SUITE( testFunctions )
@@ -1424,6 +1426,150 @@ BOOST_AUTO_TEST_CASE( checkFunctions_round )
 
 }
 
+BOOST_AUTO_TEST_CASE( checkFunctions_dominates )
+{
+  vector<double> point = {1., 2., 3.};
+
+  BOOST_CHECK_MESSAGE( dominates({1., 2., 2.}, point),
+                       "Point smaller on one objective and equal on the"
+                       << " others does not dominate.");
+  BOOST_CHECK_MESSAGE( !dominates(point, point),
+                       "Point dominates itself.");
+  BOOST_CHECK_MESSAGE( !dominates({0., 3., 3.}, point),
+                       "Point greater on one objective dominates.");
+  BOOST_CHECK_MESSAGE( !dominates(point, {1., 2., 2.}),
+                       "Dominated point dominates.");
+}
+
+BOOST_AUTO_TEST_CASE( checkFunctions_runParallelTasks )
+{
+  BOOST_CHECK_MESSAGE( nWorkerThreads(3) == 3,
+                       "Worker threads for 3 requested threads"
+                       << " different from the expected."
+                       << "\nExpected: 3"
+                       << "\nGot: " << nWorkerThreads(3));
+  BOOST_CHECK_MESSAGE( nWorkerThreads(0) >= 1,
+                       "No worker threads for all hardware threads.");
+
+  size_t nTasks = 37;
+  vector<size_t> nRuns(nTasks, 0);
+  vector<ostringstream> taskMessages(nTasks);
+
+  runParallelTasks(nTasks, 4, [&](size_t taskID) {
+    redirectMessages(&taskMessages[taskID]);
+    messageStream() << "Task " << taskID;
+    ++nRuns[taskID];
+    redirectMessages(nullptr);
+  });
+
+  for (size_t taskID = 0; taskID < nTasks; ++taskID) {
+    BOOST_CHECK_MESSAGE( nRuns[taskID] == 1,
+                         "Parallel task " << taskID << " ran "
+                         << nRuns[taskID] << " times instead of once.");
+
+    string expString = "Task " + to_string(taskID);
+    string gotString = taskMessages[taskID].str();
+    BOOST_CHECK_MESSAGE( gotString == expString,
+                         "Messages of a parallel task"
+                         << " different from the expected."
+                         << "\nExpected: " << expString
+                         << "\nGot: " << gotString);
+  }
+
+  // The lowest failing task is reported, whatever the timing
+  string exceptionMsg("No exception.");
+  try {
+    runParallelTasks(nTasks, 4, [&](size_t taskID) {
+      if ( taskID % 10 == 3 ) {
+        throw string("[ERROR] Task ") + to_string(taskID);
+      }
+    });
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+  string expectedThrownMsg("[ERROR] Task 3");
+  BOOST_CHECK_MESSAGE( exceptionMsg == expectedThrownMsg,
+                       "Exception message from parallel tasks"
+                       << " different from the expected."
+                       << "\nExpected: " << expectedThrownMsg
+                       << "\nGot: " << exceptionMsg);
+
+  // Tasks split the thread budget of the caller, one thread at least each
+  ThreadBudget budget(8);
+  BOOST_CHECK_MESSAGE( nWorkerThreads(0) == 8,
+                       "Worker threads for the thread budget"
+                       << " different from the expected."
+                       << "\nExpected: 8"
+                       << "\nGot: " << nWorkerThreads(0));
+  for (size_t nThreads : {4, 16}) {
+    vector<size_t> taskBudgets(nTasks, 0);
+    runParallelTasks(nTasks, nThreads, [&](size_t taskID) {
+      taskBudgets[taskID] = nWorkerThreads(0);
+    });
+    size_t expBudget = max(8 / nThreads, (size_t) 1);
+    for (size_t taskID = 0; taskID < nTasks; ++taskID) {
+      BOOST_CHECK_MESSAGE( taskBudgets[taskID] == expBudget,
+                           "Thread budget of a task on " << nThreads
+                           << " threads different from the expected."
+                           << "\nExpected: " << expBudget
+                           << "\nGot: " << taskBudgets[taskID]);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE( checkFunctions_logging )
+{
+  ostringstream messages;
+  {
+    MessageRedirection redirection(&messages);
+
+    // Warnings are kept in order with the other levels
+    PRINT_INFO("Shown " << 1);
+    PRINT_WARNING("Shown " << 2);
+    PRINT_DEBUG("Hidden " << 3);
+
+    // Messages below the level are not even formatted
+    setLogLevel(LOG_LEVEL_WARNING);
+    int nFormatted = 0;
+    PRINT_INFO("Hidden " << ++nFormatted);
+    BOOST_CHECK_EQUAL(nFormatted, 0);
+    setLogLevel(LOG_LEVEL_INFO);
+
+    // Buffered messages reach the redirected stream at once
+    {
+      MessageBuffer buffer;
+      PRINT_INFO("Buffered");
+      BOOST_CHECK_EQUAL(messages.str(),
+                        "[INFO] Shown 1\n[WARNING] Shown 2\n");
+    }
+  }
+  BOOST_CHECK_EQUAL(messages.str(), "[INFO] Shown 1\n[WARNING] Shown 2\n"
+                                    "[INFO] Buffered\n");
+  BOOST_CHECK(&messageStream() == &cout);
+
+  // Outside of any redirection, messages go to the stream of their level
+  ostringstream printedOut;
+  ostringstream printedErr;
+  auto outBuffer = cout.rdbuf(printedOut.rdbuf());
+  auto errBuffer = cerr.rdbuf(printedErr.rdbuf());
+  printMessages("[INFO] Out\n[WARNING] Err\n  continued\n"
+                "[ERROR] Err\n[DEBUG] Out\n");
+  cout.rdbuf(outBuffer);
+  cerr.rdbuf(errBuffer);
+  BOOST_CHECK_EQUAL(printedOut.str(), "[INFO] Out\n[DEBUG] Out\n");
+  BOOST_CHECK_EQUAL(printedErr.str(),
+                    "[WARNING] Err\n  continued\n[ERROR] Err\n");
+
+  BOOST_CHECK_EQUAL(logLevelFromName("debug"), LOG_LEVEL_DEBUG);
+  string exceptionMsg("No exception.");
+  try {
+    logLevelFromName("verbose");
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+  BOOST_CHECK(exceptionMsg.find("[ERROR] Log level \"verbose\"") == 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif // FUNCTIONSTEST_CPP
@@ -0,0 +1,939 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+#ifndef LINESOLVERTEST_CPP
+#define LINESOLVERTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../../core/LineSolver.h"
+
+#include "../../parser/ArgumentsParser.h"
+
+namespace bu=boost::units;
+namespace rrs=boost::units::rramspec;
+
+using namespace std;
+
+BOOST_AUTO_TEST_SUITE( testLineSolver )
+
+BOOST_AUTO_TEST_CASE( checkLineSolver_Errors )
+{
+  string exceptionMsg("No exception.");
+  string expectedThrownMsg("No exception.");
+
+  exceptionMsg = "No exception.";
+  try {
+    LineSolver myLineSolver;
+    myLineSolver.calcVSelectedCell(1., 1., 0.);
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+  expectedThrownMsg = "[ERROR] ";
+  expectedThrownMsg.append("Unexpected behaviour - ");
+  expectedThrownMsg.append("tried to run the line solver");
+  expectedThrownMsg.append(" before its lines and cells were set.\n");
+  BOOST_CHECK_MESSAGE( exceptionMsg == expectedThrownMsg,
+                       "Exception message from solving unset lines"
+                       << " different from the expected."
+                       << "\nExpected: " << expectedThrownMsg
+                       << "\nGot: " << exceptionMsg);
+
+  exceptionMsg = "No exception.";
+  try {
+    LineSolver myLineSolver;
+    myLineSolver.setLines(0, 1, 1., 1., 1., 1.);
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+  expectedThrownMsg = "[ERROR] ";
+  expectedThrownMsg.append("Unexpected behaviour - ");
+  expectedThrownMsg.append("tried to set up the line solver");
+  expectedThrownMsg.append(" with empty lines or unknown resistances.\n");
+  BOOST_CHECK_MESSAGE( exceptionMsg == expectedThrownMsg,
+                       "Exception message from setting empty lines"
+                       << " different from the expected."
+                       << "\nExpected: " << expectedThrownMsg
+                       << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_CASE( checkLineSolver_SingleCell )
+{
+  int sim_argc = 3;
+  char* sim_argv[] = {"./executable",
+                      "-conf",
+                      "../../tests/configs/test_config.txt"};
+
+  ArgumentsParser argParser(sim_argc, sim_argv);
+
+  Cell myCell;
+  string exceptionMsg("No exception.");
+  try {
+    argParser.runArgParser();
+    myCell = Cell(argParser.configs.at(0).cellFileName.c_str());
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+  string expectedThrownMsg("No exception.");
+  BOOST_REQUIRE_MESSAGE( exceptionMsg == expectedThrownMsg,
+                       "Exception message from cell constructor"
+                       << " different for the expected."
+                       << "\nExpected: " << expectedThrownMsg
+                       << "\nGot: " << exceptionMsg);
+
+  size_t nSigFigs = 6;
+
+  // Raw lookup must match the unit-checked one
+  vector<double> cellVs = {-3.5, -1., 0., 0.5, 2., 3.15, 4., 7.};
+  for (auto cellV : cellVs) {
+    bu::quantity<rrs::ampere_unit> expCurrent;
+    expCurrent = myCell.getCellCurrent(cellV * rrs::volts);
+    bu::quantity<rrs::ampere_unit> gotCurrent;
+    gotCurrent = myCell.getRawCellCurrent(cellV) * rrs::amperes;
+    BOOST_CHECK_MESSAGE( round(gotCurrent, nSigFigs)
+                          == round(expCurrent, nSigFigs),
+                         setprecision(nSigFigs)
+                         << "Raw cell current at " << cellV << " V"
+                         << " different from the expected."
+                         << "\nExpected: " << expCurrent
+                         << "\nGot: " << gotCurrent);
+  }
+
+  // A single cell on ideal lines sees the whole driver voltage
+  LineSolver myLineSolver;
+  myLineSolver.setLines(1, 1, 0., 0., 0., 0.);
+  myLineSolver.setCells(&myCell, &myCell, &myCell);
+
+  double expDouble = 3.;
+  double gotValue = myLineSolver.calcVSelectedCell(expDouble, expDouble, 0.);
+  BOOST_CHECK_MESSAGE( round(gotValue, nSigFigs) == expDouble,
+                       setprecision(nSigFigs)
+                       << "Selected cell voltage on ideal lines"
+                       << " different from the expected."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+
+  expDouble = myCell.getRawCellCurrent(3.);
+  gotValue = myLineSolver.getSCCurrent();
+  BOOST_CHECK_MESSAGE( gotValue == expDouble,
+                       setprecision(nSigFigs)
+                       << "Selected cell current on ideal lines"
+                       << " different from the expected."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+
+  expDouble = 0.;
+  gotValue = myLineSolver.getSPCurrent();
+  BOOST_CHECK_MESSAGE( gotValue == expDouble,
+                       setprecision(nSigFigs)
+                       << "Sneak path current without half selected cells"
+                       << " different from the expected."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+
+  expDouble = 3.;
+  gotValue = myLineSolver.calcVEdge(expDouble, 0., true);
+  BOOST_CHECK_MESSAGE( round(gotValue, nSigFigs) == expDouble,
+                       setprecision(nSigFigs)
+                       << "Driver voltage on ideal lines"
+                       << " different from the expected."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+}
+
+BOOST_AUTO_TEST_CASE( checkLineSolver_AsymmetricLines )
+{
+  int sim_argc = 3;
+  char* sim_argv[] = {"./executable",
+                      "-conf",
+                      "../../tests/configs/test_config.txt"};
+
+  ArgumentsParser argParser(sim_argc, sim_argv);
+
+  Cell myCell;
+  string exceptionMsg("No exception.");
+  try {
+    argParser.runArgParser();
+    myCell = Cell(argParser.configs.at(0).cellFileName.c_str());
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+  string expectedThrownMsg("No exception.");
+  BOOST_REQUIRE_MESSAGE( exceptionMsg == expectedThrownMsg,
+                       "Exception message from cell constructor"
+                       << " different for the expected."
+                       << "\nExpected: " << expectedThrownMsg
+                       << "\nGot: " << exceptionMsg);
+
+  size_t nSigFigs = 4;
+
+  // Driving the lines with the driver voltage found for a selected cell
+  //  voltage gives that voltage back - the PL segments follow the PL
+  //  resistance in both directions, also when it differs from the NL one,
+  //  as for a reset, with the PL on the bitline
+  LineSolver myLineSolver;
+  myLineSolver.setLines(512, 256, 5., 10., 2000., 1000.);
+  myLineSolver.setCells(&myCell, &myCell, &myCell);
+
+  double expDouble = 5.;
+  double vP = myLineSolver.calcVEdge(expDouble, 0., true);
+  myLineSolver.setLines(512, 256, 5., 10., 2000., 1000.);
+  double gotValue = myLineSolver.calcVSelectedCell(vP, vP, 0.);
+  BOOST_CHECK_MESSAGE( round(gotValue, nSigFigs) == expDouble,
+                       setprecision(nSigFigs)
+                       << "Selected cell voltage at the driver voltage"
+                       << " found for it different from the expected."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+}
+
+BOOST_AUTO_TEST_CASE( checkLineSolver_Methods )
+{
+  string exceptionMsg("No exception.");
+  string expectedThrownMsg("No exception.");
+
+  LineSolver myLineSolver;
+  string expString = "fixed-point";
+  string gotString = myLineSolver.getMethod();
+  BOOST_CHECK_MESSAGE( gotString == expString,
+                       "Default line solver method"
+                       << " different from the expected."
+                       << "\nExpected: " << expString
+                       << "\nGot: " << gotString);
+
+  expString = "jacobi";
+  myLineSolver.setMethod(expString);
+  gotString = myLineSolver.getMethod();
+  BOOST_CHECK_MESSAGE( gotString == expString,
+                       "Line solver method"
+                       << " different from the expected."
+                       << "\nExpected: " << expString
+                       << "\nGot: " << gotString);
+
+  expString = "newton";
+  myLineSolver.setMethod(expString);
+  gotString = myLineSolver.getMethod();
+  BOOST_CHECK_MESSAGE( gotString == expString,
+                       "Line solver method"
+                       << " different from the expected."
+                       << "\nExpected: " << expString
+                       << "\nGot: " << gotString);
+
+  exceptionMsg = "No exception.";
+  try {
+    myLineSolver.setMethod("bisection");
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+  expectedThrownMsg = "[ERROR] ";
+  expectedThrownMsg.append("Tried to set a line solver method for");
+  expectedThrownMsg.append(" crosspoint array, \"bisection\"");
+  expectedThrownMsg.append(", different from the ones supported:\n");
+  expectedThrownMsg.append("  \"fixed-point\"\n");
+  expectedThrownMsg.append("  \"jacobi\"\n");
+  expectedThrownMsg.append("  \"newton\"\n");
+  BOOST_CHECK_MESSAGE( exceptionMsg == expectedThrownMsg,
+                       "Exception message from setting unknown method"
+                       << " different from the expected."
+                       << "\nExpected: " << expectedThrownMsg
+                       << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_CASE( checkLineSolver_Limits )
+{
+  int sim_argc = 3;
+  char* sim_argv[] = {"./executable",
+                      "-conf",
+                      "../../tests/configs/test_config.txt"};
+
+  ArgumentsParser argParser(sim_argc, sim_argv);
+
+  Cell myCell;
+  string exceptionMsg("No exception.");
+  try {
+    argParser.runArgParser();
+    myCell = Cell(argParser.configs.at(0).cellFileName.c_str());
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+  string expectedThrownMsg("No exception.");
+  BOOST_REQUIRE_MESSAGE( exceptionMsg == expectedThrownMsg,
+                       "Exception message from cell constructor"
+                       << " different for the expected."
+                       << "\nExpected: " << expectedThrownMsg
+                       << "\nGot: " << exceptionMsg);
+
+  SolverLimits limits;
+  limits.maxIterations = 1;
+
+  // Every method fails once out of iterations
+  for (string method : {"fixed-point", "jacobi", "newton"}) {
+    LineSolver myLineSolver;
+    myLineSolver.setMethod(method);
+    myLineSolver.setLines(256, 512, 10., 5., 1000., 2000.);
+    myLineSolver.setCells(&myCell, &myCell, &myCell);
+    double expDouble = myLineSolver.calcVEdge(5., 0., true);
+
+    myLineSolver.setLimits(limits);
+    exceptionMsg = "No exception.";
+    try {
+      myLineSolver.calcVEdge(5., 0., true);
+    }catch (string exceptionMsgThrown){
+      exceptionMsg = exceptionMsgThrown;
+    }
+    expectedThrownMsg = "[ERROR] Line solver did not converge after 1";
+    expectedThrownMsg.append(" iterations.\n");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedThrownMsg,
+                         "Exception message from a " << method
+                         << " solve out of iterations"
+                         << " different from the expected."
+                         << "\nExpected: " << expectedThrownMsg
+                         << "\nGot: " << exceptionMsg);
+
+    // Nothing of a failed solve is left once the lines are set again
+    myLineSolver.setLimits(SolverLimits());
+    myLineSolver.setLines(256, 512, 10., 5., 1000., 2000.);
+    double gotValue = myLineSolver.calcVEdge(5., 0., true);
+    BOOST_CHECK_MESSAGE( round(gotValue, 6) == round(expDouble, 6),
+                         "Driver voltage of a " << method
+                         << " solve after a failed one"
+                         << " different from the expected."
+                         << "\nExpected: " << expDouble
+                         << "\nGot: " << gotValue);
+  }
+}
+
+BOOST_AUTO_TEST_CASE( checkLineSolver_Acceleration )
+{
+  int sim_argc = 3;
+  char* sim_argv[] = {"./executable",
+                      "-conf",
+                      "../../tests/configs/test_config.txt"};
+
+  ArgumentsParser argParser(sim_argc, sim_argv);
+
+  Cell myCell;
+  string exceptionMsg("No exception.");
+  try {
+    argParser.runArgParser();
+    myCell = Cell(argParser.configs.at(0).cellFileName.c_str());
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+  string expectedThrownMsg("No exception.");
+  BOOST_REQUIRE_MESSAGE( exceptionMsg == expectedThrownMsg,
+                       "Exception message from cell constructor"
+                       << " different for the expected."
+                       << "\nExpected: " << expectedThrownMsg
+                       << "\nGot: " << exceptionMsg);
+
+  LineSolver myLineSolver;
+  string expString = "none";
+  string gotString = myLineSolver.getAcceleration();
+  BOOST_CHECK_MESSAGE( gotString == expString,
+                       "Default line solver acceleration"
+                       << " different from the expected."
+                       << "\nExpected: " << expString
+                       << "\nGot: " << gotString);
+
+  exceptionMsg = "No exception.";
+  try {
+    myLineSolver.setAcceleration("chebyshev");
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+  expectedThrownMsg = "[ERROR] ";
+  expectedThrownMsg.append("Tried to set a line solver acceleration for");
+  expectedThrownMsg.append(" crosspoint array, \"chebyshev\"");
+  expectedThrownMsg.append(", different from the ones supported:\n");
+  expectedThrownMsg.append("  \"none\"\n");
+  expectedThrownMsg.append("  \"sor\"\n");
+  expectedThrownMsg.append("  \"anderson\"\n");
+  BOOST_CHECK_MESSAGE( exceptionMsg == expectedThrownMsg,
+                       "Exception message from setting unknown acceleration"
+                       << " different from the expected."
+                       << "\nExpected: " << expectedThrownMsg
+                       << "\nGot: " << exceptionMsg);
+
+  exceptionMsg = "No exception.";
+  try {
+    myLineSolver.setSORFactor(2.);
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+  expectedThrownMsg = "[ERROR] Line solver SOR factor must be between";
+  expectedThrownMsg.append(" 0 and 2, got 2.000000.\n");
+  BOOST_CHECK_MESSAGE( exceptionMsg == expectedThrownMsg,
+                       "Exception message from setting SOR factor 2"
+                       << " different from the expected."
+                       << "\nExpected: " << expectedThrownMsg
+                       << "\nGot: " << exceptionMsg);
+
+  // Accelerated sweeps reach the same lines state - Anderson mixing in
+  //  fewer sweeps
+  size_t nSigFigs = 4;
+  double expVSC = INVALID_DOUBLE;
+  size_t expIterations = 0;
+  for (string acceleration : {"none", "sor", "anderson"}) {
+    LineSolver acceleratedSolver;
+    acceleratedSolver.setAcceleration(acceleration);
+    acceleratedSolver.setLines(1024, 1024, 10., 5., 1000., 2000.);
+    acceleratedSolver.setCells(&myCell, &myCell, &myCell);
+
+    uint64_t firstIteration = threadPerfStats().solverIterations;
+    double gotVSC = acceleratedSolver.calcVSelectedCell(3.5, 3.5, 0.);
+    size_t gotIterations =
+        threadPerfStats().solverIterations - firstIteration;
+    if ( acceleration == "none" ) {
+      expVSC = gotVSC;
+      expIterations = gotIterations;
+      continue;
+    }
+
+    BOOST_CHECK_MESSAGE( round(gotVSC, nSigFigs) == round(expVSC, nSigFigs),
+                         setprecision(nSigFigs)
+                         << "Selected cell voltage with " << acceleration
+                         << " acceleration different from the expected."
+                         << "\nExpected: " << expVSC
+                         << "\nGot: " << gotVSC);
+    if ( acceleration == "anderson" ) {
+      BOOST_CHECK_MESSAGE( gotIterations < expIterations,
+                           "Anderson mixing took no fewer sweeps."
+                           << "\nUnaccelerated: " << expIterations
+                           << "\nGot: " << gotIterations);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE( checkLineSolver_NewtonVsFixedPoint )
+{
+  int sim_argc = 3;
+  char* sim_argv[] = {"./executable",
+                      "-conf",
+                      "../../tests/configs/test_config.txt"};
+
+  ArgumentsParser argParser(sim_argc, sim_argv);
+
+  Cell myCell;
+  string exceptionMsg("No exception.");
+  try {
+    argParser.runArgParser();
+    myCell = Cell(argParser.configs.at(0).cellFileName.c_str());
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+  string expectedThrownMsg("No exception.");
+  BOOST_REQUIRE_MESSAGE( exceptionMsg == expectedThrownMsg,
+                       "Exception message from cell constructor"
+                       << " different for the expected."
+                       << "\nExpected: " << expectedThrownMsg
+                       << "\nGot: " << exceptionMsg);
+
+  // Both methods must agree within the fixed-point tolerance
+  size_t nSigFigs = 4;
+
+  LineSolver fixedPointSolver;
+  fixedPointSolver.setLines(256, 512, 10., 5., 1000., 2000.);
+  fixedPointSolver.setCells(&myCell, &myCell, &myCell);
+
+  LineSolver newtonSolver;
+  newtonSolver.setMethod("newton");
+  newtonSolver.setLines(256, 512, 10., 5., 1000., 2000.);
+  newtonSolver.setCells(&myCell, &myCell, &myCell);
+
+  double expDouble = fixedPointSolver.calcVEdge(5., 0., true);
+  double gotValue = newtonSolver.calcVEdge(5., 0., true);
+  BOOST_CHECK_MESSAGE( round(gotValue, nSigFigs)
+                        == round(expDouble, nSigFigs),
+                       setprecision(nSigFigs)
+                       << "Newton driver voltage"
+                       << " different from the fixed-point one."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+
+  expDouble = fixedPointSolver.getSPCurrent();
+  gotValue = newtonSolver.getSPCurrent();
+  BOOST_CHECK_MESSAGE( round(gotValue, nSigFigs)
+                        == round(expDouble, nSigFigs),
+                       setprecision(nSigFigs)
+                       << "Newton sneak path current"
+                       << " different from the fixed-point one."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+
+  expDouble = fixedPointSolver.calcVSelectedCell(5.5, 5., 0.);
+  gotValue = newtonSolver.calcVSelectedCell(5.5, 5., 0.);
+  BOOST_CHECK_MESSAGE( round(gotValue, nSigFigs)
+                        == round(expDouble, nSigFigs),
+                       setprecision(nSigFigs)
+                       << "Newton selected cell voltage"
+                       << " different from the fixed-point one."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+
+  expDouble = fixedPointSolver.getSCCurrent();
+  gotValue = newtonSolver.getSCCurrent();
+  BOOST_CHECK_MESSAGE( round(gotValue, nSigFigs)
+                        == round(expDouble, nSigFigs),
+                       setprecision(nSigFigs)
+                       << "Newton selected cell current"
+                       << " different from the fixed-point one."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+
+  // Half selected cells of each line in series with the other line, as
+  //  the crosspoint array sets them up - distinct when the lines differ
+  Cell HSCellPL = myCell;
+  HSCellPL.setMemDevLRSResistance(myCell.getMemDevLRSResistance()
+                                  + 512 * 5. * rrs::ohms);
+  HSCellPL.setMemDevHRSResistance(myCell.getMemDevHRSResistance()
+                                  + 512 * 5. * rrs::ohms);
+  HSCellPL.buildCellIxV();
+  Cell HSCellNL = myCell;
+  HSCellNL.setMemDevLRSResistance(myCell.getMemDevLRSResistance()
+                                  + 256 * 1e3 * rrs::ohms);
+  HSCellNL.setMemDevHRSResistance(myCell.getMemDevHRSResistance()
+                                  + 256 * 1e3 * rrs::ohms);
+  HSCellNL.buildCellIxV();
+
+  fixedPointSolver.setLines(256, 512, 1e3, 5., 1000., 2000.);
+  fixedPointSolver.setCells(&myCell, &HSCellPL, &HSCellNL);
+  newtonSolver.setLines(256, 512, 1e3, 5., 1000., 2000.);
+  newtonSolver.setCells(&myCell, &HSCellPL, &HSCellNL);
+
+  expDouble = fixedPointSolver.calcVSelectedCell(5.5, 5.5, 0.);
+  gotValue = newtonSolver.calcVSelectedCell(5.5, 5.5, 0.);
+  BOOST_CHECK_MESSAGE( round(gotValue, nSigFigs)
+                        == round(expDouble, nSigFigs),
+                       setprecision(nSigFigs)
+                       << "Newton selected cell voltage with distinct"
+                       << " half selected cells"
+                       << " different from the fixed-point one."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+
+  expDouble = fixedPointSolver.getSPCurrent();
+  gotValue = newtonSolver.getSPCurrent();
+  BOOST_CHECK_MESSAGE( round(gotValue, nSigFigs)
+                        == round(expDouble, nSigFigs),
+                       setprecision(nSigFigs)
+                       << "Newton sneak path current with distinct"
+                       << " half selected cells"
+                       << " different from the fixed-point one."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+
+  // Lines are reset before each solve, as the crosspoint array does
+  fixedPointSolver.setLines(256, 512, 1e3, 5., 1000., 2000.);
+  expDouble = fixedPointSolver.calcVEdge(5., 0., true);
+  gotValue = newtonSolver.calcVEdge(5., 0., true);
+  BOOST_CHECK_MESSAGE( round(gotValue, nSigFigs)
+                        == round(expDouble, nSigFigs),
+                       setprecision(nSigFigs)
+                       << "Newton driver voltage with distinct"
+                       << " half selected cells"
+                       << " different from the fixed-point one."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+}
+
+BOOST_AUTO_TEST_CASE( checkLineSolver_JacobiVsFixedPoint )
+{
+  int sim_argc = 3;
+  char* sim_argv[] = {"./executable",
+                      "-conf",
+                      "../../tests/configs/test_config.txt"};
+
+  ArgumentsParser argParser(sim_argc, sim_argv);
+
+  Cell myCell;
+  string exceptionMsg("No exception.");
+  try {
+    argParser.runArgParser();
+    myCell = Cell(argParser.configs.at(0).cellFileName.c_str());
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+  string expectedThrownMsg("No exception.");
+  BOOST_REQUIRE_MESSAGE( exceptionMsg == expectedThrownMsg,
+                       "Exception message from cell constructor"
+                       << " different for the expected."
+                       << "\nExpected: " << expectedThrownMsg
+                       << "\nGot: " << exceptionMsg);
+
+  // Both sweeps converge to the same lines state
+  size_t nSigFigs = 4;
+
+  LineSolver fixedPointSolver;
+  fixedPointSolver.setLines(256, 512, 10., 5., 1000., 2000.);
+  fixedPointSolver.setCells(&myCell, &myCell, &myCell);
+
+  LineSolver jacobiSolver;
+  jacobiSolver.setMethod("jacobi");
+  jacobiSolver.setLines(256, 512, 10., 5., 1000., 2000.);
+  jacobiSolver.setCells(&myCell, &myCell, &myCell);
+
+  double expDouble = fixedPointSolver.calcVEdge(5., 0., true);
+  double gotValue = jacobiSolver.calcVEdge(5., 0., true);
+  BOOST_CHECK_MESSAGE( round(gotValue, nSigFigs)
+                        == round(expDouble, nSigFigs),
+                       setprecision(nSigFigs)
+                       << "Jacobi driver voltage"
+                       << " different from the fixed-point one."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+
+  expDouble = fixedPointSolver.getSPCurrent();
+  gotValue = jacobiSolver.getSPCurrent();
+  BOOST_CHECK_MESSAGE( round(gotValue, nSigFigs)
+                        == round(expDouble, nSigFigs),
+                       setprecision(nSigFigs)
+                       << "Jacobi sneak path current"
+                       << " different from the fixed-point one."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+
+  expDouble = fixedPointSolver.calcVSelectedCell(5.5, 5., 0.);
+  gotValue = jacobiSolver.calcVSelectedCell(5.5, 5., 0.);
+  BOOST_CHECK_MESSAGE( round(gotValue, nSigFigs)
+                        == round(expDouble, nSigFigs),
+                       setprecision(nSigFigs)
+                       << "Jacobi selected cell voltage"
+                       << " different from the fixed-point one."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+
+  expDouble = fixedPointSolver.getSCCurrent();
+  gotValue = jacobiSolver.getSCCurrent();
+  BOOST_CHECK_MESSAGE( round(gotValue, nSigFigs)
+                        == round(expDouble, nSigFigs),
+                       setprecision(nSigFigs)
+                       << "Jacobi selected cell current"
+                       << " different from the fixed-point one."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+
+  // Both sweeps evaluate each line with its own half selected cells
+  Cell HSCellPL = myCell;
+  HSCellPL.setMemDevLRSResistance(myCell.getMemDevLRSResistance()
+                                  + 512 * 5. * rrs::ohms);
+  HSCellPL.setMemDevHRSResistance(myCell.getMemDevHRSResistance()
+                                  + 512 * 5. * rrs::ohms);
+  HSCellPL.buildCellIxV();
+  Cell HSCellNL = myCell;
+  HSCellNL.setMemDevLRSResistance(myCell.getMemDevLRSResistance()
+                                  + 256 * 1e3 * rrs::ohms);
+  HSCellNL.setMemDevHRSResistance(myCell.getMemDevHRSResistance()
+                                  + 256 * 1e3 * rrs::ohms);
+  HSCellNL.buildCellIxV();
+
+  fixedPointSolver.setLines(256, 512, 1e3, 5., 1000., 2000.);
+  fixedPointSolver.setCells(&myCell, &HSCellPL, &HSCellNL);
+  jacobiSolver.setLines(256, 512, 1e3, 5., 1000., 2000.);
+  jacobiSolver.setCells(&myCell, &HSCellPL, &HSCellNL);
+
+  expDouble = fixedPointSolver.calcVSelectedCell(5.5, 5.5, 0.);
+  gotValue = jacobiSolver.calcVSelectedCell(5.5, 5.5, 0.);
+  BOOST_CHECK_MESSAGE( round(gotValue, nSigFigs)
+                        == round(expDouble, nSigFigs),
+                       setprecision(nSigFigs)
+                       << "Jacobi selected cell voltage with distinct"
+                       << " half selected cells"
+                       << " different from the fixed-point one."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+
+  expDouble = fixedPointSolver.getSPCurrent();
+  gotValue = jacobiSolver.getSPCurrent();
+  BOOST_CHECK_MESSAGE( round(gotValue, nSigFigs)
+                        == round(expDouble, nSigFigs),
+                       setprecision(nSigFigs)
+                       << "Jacobi sneak path current with distinct"
+                       << " half selected cells"
+                       << " different from the fixed-point one."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+
+  // Lines are reset before each solve, as the crosspoint array does
+  fixedPointSolver.setLines(256, 512, 1e3, 5., 1000., 2000.);
+  jacobiSolver.setLines(256, 512, 1e3, 5., 1000., 2000.);
+  expDouble = fixedPointSolver.calcVEdge(5., 0., true);
+  gotValue = jacobiSolver.calcVEdge(5., 0., true);
+  BOOST_CHECK_MESSAGE( round(gotValue, nSigFigs)
+                        == round(expDouble, nSigFigs),
+                       setprecision(nSigFigs)
+                       << "Jacobi driver voltage with distinct"
+                       << " half selected cells"
+                       << " different from the fixed-point one."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+
+  jacobiSolver.setLines(256, 512, 10., 5., 1000., 2000.);
+  jacobiSolver.setCells(&myCell, &myCell, &myCell);
+
+  // Floating lines settle where the half selected cells currents balance
+  //  Both sweeps only stop once the floating node stopped moving, so they
+  //  agree to the solvers tolerance
+  nSigFigs = 6;
+  fixedPointSolver.setLines(256, 512, 10., 5., 1000., 2000.);
+  fixedPointSolver.setCells(&myCell, &myCell, &myCell);
+  fixedPointSolver.setBiasScheme(floating_bias);
+  jacobiSolver.setBiasScheme(floating_bias);
+  expDouble = fixedPointSolver.calcVEdge(5., 0., true);
+  gotValue = jacobiSolver.calcVEdge(5., 0., true);
+  BOOST_CHECK_MESSAGE( round(gotValue, nSigFigs)
+                        == round(expDouble, nSigFigs),
+                       setprecision(nSigFigs)
+                       << "Jacobi driver voltage with floating lines"
+                       << " different from the fixed-point one."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+
+  expDouble = fixedPointSolver.getSPCurrent();
+  gotValue = jacobiSolver.getSPCurrent();
+  BOOST_CHECK_MESSAGE( round(gotValue, nSigFigs)
+                        == round(expDouble, nSigFigs),
+                       setprecision(nSigFigs)
+                       << "Jacobi sneak path current with floating lines"
+                       << " different from the fixed-point one."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+
+  fixedPointSolver.setLines(256, 512, 10., 5., 1000., 2000.);
+  jacobiSolver.setLines(256, 512, 10., 5., 1000., 2000.);
+  expDouble = fixedPointSolver.calcVSelectedCell(5.5, 0., 0.);
+  gotValue = jacobiSolver.calcVSelectedCell(5.5, 0., 0.);
+  BOOST_CHECK_MESSAGE( round(gotValue, nSigFigs)
+                        == round(expDouble, nSigFigs),
+                       setprecision(nSigFigs)
+                       << "Jacobi selected cell voltage with floating lines"
+                       << " different from the fixed-point one."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+}
+
+BOOST_AUTO_TEST_CASE( checkLineSolver_BiasSchemes )
+{
+  int sim_argc = 3;
+  char* sim_argv[] = {"./executable",
+                      "-conf",
+                      "../../tests/configs/test_config.txt"};
+
+  ArgumentsParser argParser(sim_argc, sim_argv);
+
+  Cell myCell;
+  string exceptionMsg("No exception.");
+  try {
+    argParser.runArgParser();
+    myCell = Cell(argParser.configs.at(0).cellFileName.c_str());
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+  string expectedThrownMsg("No exception.");
+  BOOST_REQUIRE_MESSAGE( exceptionMsg == expectedThrownMsg,
+                       "Exception message from cell constructor"
+                       << " different for the expected."
+                       << "\nExpected: " << expectedThrownMsg
+                       << "\nGot: " << exceptionMsg);
+
+  size_t nSigFigs = 4;
+
+  LineSolver fixedPointSolver;
+  fixedPointSolver.setLines(256, 512, 10., 5., 1000., 2000.);
+  fixedPointSolver.setCells(&myCell, &myCell, &myCell);
+
+  LineSolver newtonSolver;
+  newtonSolver.setMethod("newton");
+  newtonSolver.setLines(256, 512, 10., 5., 1000., 2000.);
+  newtonSolver.setCells(&myCell, &myCell, &myCell);
+
+  BOOST_CHECK_MESSAGE( fixedPointSolver.getBiasScheme() == half_bias,
+                       "Default line solver bias scheme is not V/2.");
+
+  exceptionMsg = "No exception.";
+  try {
+    fixedPointSolver.setBiasScheme(invalid_bias);
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+  expectedThrownMsg = "[ERROR] ";
+  expectedThrownMsg.append("Unexpected behaviour - ");
+  expectedThrownMsg.append("tried to set an invalid bias scheme");
+  expectedThrownMsg.append(" in the line solver.\n");
+  BOOST_CHECK_MESSAGE( exceptionMsg == expectedThrownMsg,
+                       "Exception message from setting invalid bias scheme"
+                       << " different from the expected."
+                       << "\nExpected: " << expectedThrownMsg
+                       << "\nGot: " << exceptionMsg);
+
+  // Half selected cells see V/3 instead of V/2, so they sneak less current
+  // Lines are reset before each solve, as the crosspoint array does
+  fixedPointSolver.calcVEdge(5., 0., true);
+  double halfBiasSPCurrent = fixedPointSolver.getSPCurrent();
+  fixedPointSolver.setBiasScheme(third_bias);
+  fixedPointSolver.setLines(256, 512, 10., 5., 1000., 2000.);
+  fixedPointSolver.calcVEdge(5., 0., true);
+  double thirdBiasSPCurrent = fixedPointSolver.getSPCurrent();
+  BOOST_CHECK_MESSAGE( thirdBiasSPCurrent < halfBiasSPCurrent,
+                       "V/3 sneak path current not lower than the V/2 one."
+                       << "\nV/2: " << halfBiasSPCurrent
+                       << "\nV/3: " << thirdBiasSPCurrent);
+
+  newtonSolver.setBiasScheme(third_bias);
+  fixedPointSolver.setLines(256, 512, 10., 5., 1000., 2000.);
+  double expDouble = fixedPointSolver.calcVSelectedCell(5.5, 5.5, 0.);
+  double gotValue = newtonSolver.calcVSelectedCell(5.5, 5.5, 0.);
+  BOOST_CHECK_MESSAGE( round(gotValue, nSigFigs)
+                        == round(expDouble, nSigFigs),
+                       setprecision(nSigFigs)
+                       << "Newton V/3 selected cell voltage"
+                       << " different from the fixed-point one."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+
+  // Floating lines settle where the half selected cells currents balance
+  fixedPointSolver.setBiasScheme(floating_bias);
+  newtonSolver.setBiasScheme(floating_bias);
+  fixedPointSolver.setLines(256, 512, 10., 5., 1000., 2000.);
+  expDouble = fixedPointSolver.calcVEdge(5., 0., true);
+  gotValue = newtonSolver.calcVEdge(5., 0., true);
+  BOOST_CHECK_MESSAGE( round(gotValue, nSigFigs)
+                        == round(expDouble, nSigFigs),
+                       setprecision(nSigFigs)
+                       << "Newton floating driver voltage"
+                       << " different from the fixed-point one."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+
+  expDouble = fixedPointSolver.getSPCurrent();
+  gotValue = newtonSolver.getSPCurrent();
+  BOOST_CHECK_MESSAGE( round(gotValue, nSigFigs)
+                        == round(expDouble, nSigFigs),
+                       setprecision(nSigFigs)
+                       << "Newton floating sneak path current"
+                       << " different from the fixed-point one."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+}
+
+BOOST_AUTO_TEST_CASE( checkLineSolver_WarmStart )
+{
+  int sim_argc = 3;
+  char* sim_argv[] = {"./executable",
+                      "-conf",
+                      "../../tests/configs/test_config.txt"};
+
+  ArgumentsParser argParser(sim_argc, sim_argv);
+
+  Cell myCell;
+  string exceptionMsg("No exception.");
+  try {
+    argParser.runArgParser();
+    myCell = Cell(argParser.configs.at(0).cellFileName.c_str());
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+  string expectedThrownMsg("No exception.");
+  BOOST_REQUIRE_MESSAGE( exceptionMsg == expectedThrownMsg,
+                       "Exception message from cell constructor"
+                       << " different for the expected."
+                       << "\nExpected: " << expectedThrownMsg
+                       << "\nGot: " << exceptionMsg);
+
+  size_t nSigFigs = 4;
+
+  LineSolver coldSolver;
+  coldSolver.setLines(256, 512, 10., 5., 1000., 2000.);
+  coldSolver.setCells(&myCell, &myCell, &myCell);
+
+  LineSolver warmSolver;
+  warmSolver.setCells(&myCell, &myCell, &myCell);
+
+  // No solve yet, so no state to start from
+  BOOST_CHECK_MESSAGE( coldSolver.getState().vPLCells.empty(),
+                       "Line solver state not empty before any solve.");
+
+  // State from half the lines and another voltage, as in a sweep
+  warmSolver.setLines(128, 256, 10., 5., 1000., 2000.);
+  warmSolver.calcVSelectedCell(5., 5., 0.);
+  LineSolver::State state = warmSolver.getState();
+  BOOST_CHECK_MESSAGE( state.vPLCells.size() == 128
+                        && state.vNLCells.size() == 256,
+                       "Line solver state sizes different from the lines.");
+
+  warmSolver.setLines(256, 512, 10., 5., 1000., 2000.);
+  warmSolver.setInitialState(state);
+  double expDouble = coldSolver.calcVSelectedCell(5.5, 5.5, 0.);
+  double gotValue = warmSolver.calcVSelectedCell(5.5, 5.5, 0.);
+  BOOST_CHECK_MESSAGE( round(gotValue, nSigFigs)
+                        == round(expDouble, nSigFigs),
+                       setprecision(nSigFigs)
+                       << "Warm started selected cell voltage"
+                       << " different from the cold started one."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+
+  state = warmSolver.getState();
+  warmSolver.setLines(512, 1024, 10., 5., 1000., 2000.);
+  warmSolver.setInitialState(state);
+  coldSolver.setLines(512, 1024, 10., 5., 1000., 2000.);
+  expDouble = coldSolver.calcVEdge(5., 0., true);
+  gotValue = warmSolver.calcVEdge(5., 0., true);
+  BOOST_CHECK_MESSAGE( round(gotValue, nSigFigs)
+                        == round(expDouble, nSigFigs),
+                       setprecision(nSigFigs)
+                       << "Warm started driver voltage"
+                       << " different from the cold started one."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+
+  // Newton takes the same guess
+  warmSolver.setMethod("newton");
+  state = warmSolver.getState();
+  warmSolver.setLines(512, 1024, 10., 5., 1000., 2000.);
+  warmSolver.setInitialState(state);
+  gotValue = warmSolver.calcVEdge(5., 0., true);
+  BOOST_CHECK_MESSAGE( round(gotValue, nSigFigs)
+                        == round(expDouble, nSigFigs),
+                       setprecision(nSigFigs)
+                       << "Warm started Newton driver voltage"
+                       << " different from the cold started fixed-point one."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotValue);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // LINESOLVERTEST_CPP
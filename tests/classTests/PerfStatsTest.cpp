@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+#ifndef PERFSTATSTEST_CPP
+#define PERFSTATSTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <string>
+
+#include "../../utils/functions.h"
+#include "../../utils/PerfStats.h"
+
+using namespace std;
+
+BOOST_AUTO_TEST_SUITE( testPerfStats )
+
+BOOST_AUTO_TEST_CASE( checkPerfStats_collection )
+{
+
+  // Nothing is counted unless enabled
+  {
+    PerfStatsCollection collection;
+    COUNT_PERF(cellCurrentEvaluations, 3);
+    {
+      COUNT_PERF_SOLVE(edgeSolves, edgeIterations);
+      COUNT_SOLVER_ITERATION();
+    }
+    BOOST_CHECK_MESSAGE( collection.collected().cellCurrentEvaluations == 0
+                         && collection.collected().edgeSolves == 0,
+                         "Counted while the counters are disabled." );
+  }
+
+  setPerfStatsEnabled(true);
+  {
+    PerfStatsCollection outerCollection;
+    COUNT_PERF(cellCurrentEvaluations, 1);
+    {
+      PerfStatsCollection innerCollection;
+      COUNT_PERF(cellCurrentEvaluations, 3);
+      {
+        COUNT_PERF_SOLVE(edgeSolves, edgeIterations);
+        COUNT_SOLVER_ITERATION();
+        COUNT_SOLVER_ITERATION();
+      }
+      {
+        TIME_PERF(geometrySeconds);
+      }
+      const PerfStats& inner = innerCollection.collected();
+      BOOST_CHECK_MESSAGE( inner.cellCurrentEvaluations == 3,
+                           "Cell current evaluations missmatch!"
+                           << "\nExpected: 3"
+                           << "\nGot: " << inner.cellCurrentEvaluations );
+      BOOST_CHECK_MESSAGE( inner.edgeSolves == 1
+                           && inner.edgeIterations == 2,
+                           "Solve counters missmatch!"
+                           << "\nExpected: 1 solve, 2 iterations"
+                           << "\nGot: " << inner.edgeSolves << " solve(s), "
+                           << inner.edgeIterations << " iteration(s)" );
+      BOOST_CHECK_MESSAGE( inner.geometrySeconds >= 0.,
+                           "Negative time counted." );
+    }
+    // Inner collections add up in the outer ones
+    const PerfStats& outer = outerCollection.collected();
+    BOOST_CHECK_MESSAGE( outer.cellCurrentEvaluations == 4
+                         && outer.edgeSolves == 1,
+                         "Nested collection not added to the outer one!"
+                         << "\nExpected: 4 evaluations, 1 solve"
+                         << "\nGot: " << outer.cellCurrentEvaluations
+                         << " evaluations, " << outer.edgeSolves
+                         << " solve(s)" );
+  }
+  setPerfStatsEnabled(false);
+
+}
+
+BOOST_AUTO_TEST_CASE( checkPerfStats_workerThreads )
+{
+
+  // Counters of the worker threads go to the thread running the tasks
+  const size_t nTasks = 16;
+  setPerfStatsEnabled(true);
+  PerfStatsCollection collection;
+  runParallelTasks(nTasks, 4, [&](size_t taskID) {
+    COUNT_PERF(readVoltageSearches, 1);
+    COUNT_PERF(readVoltageIterations, taskID);
+  });
+  setPerfStatsEnabled(false);
+
+  const PerfStats& stats = collection.collected();
+  BOOST_CHECK_MESSAGE( stats.readVoltageSearches == nTasks,
+                       "Counters of the worker threads lost!"
+                       << "\nExpected: " << nTasks
+                       << "\nGot: " << stats.readVoltageSearches );
+  BOOST_CHECK_MESSAGE( stats.readVoltageIterations
+                         == nTasks * (nTasks - 1) / 2,
+                       "Counters of the worker threads lost!"
+                       << "\nExpected: " << nTasks * (nTasks - 1) / 2
+                       << "\nGot: " << stats.readVoltageIterations );
+
+  // Fields report the ratios per call
+  for (const auto& field : perfStatsFields()) {
+    if ( string(field.name) == "Iterations per read voltage search []" ) {
+      BOOST_CHECK_CLOSE( field.value(stats), (nTasks - 1) / 2., 1e-9 );
+    }
+  }
+
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // PERFSTATSTEST_CPP
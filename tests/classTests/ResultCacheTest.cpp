@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+#ifndef RESULTCACHETEST_CPP
+#define RESULTCACHETEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <cstdio>
+#include <fstream>
+
+#include "../../utils/ResultCache.h"
+
+using namespace std;
+
+BOOST_AUTO_TEST_SUITE( testResultCache )
+
+BOOST_AUTO_TEST_CASE( checkResultCache_storeAndFind )
+{
+
+  const char* fileName = "test_result_cache.bin";
+  remove(fileName);
+
+  ResultCache::Record record;
+  record.key = 42;
+  record.stages = 1;
+  for (size_t valueID = 0; valueID < ResultCache::nRecordValues; ++valueID) {
+    record.values[valueID] = 0.5 * valueID;
+  }
+
+  ResultCache cache(fileName);
+  ResultCache::Record foundRecord;
+  BOOST_CHECK_MESSAGE( !cache.find(record.key, foundRecord),
+                       "Key found in an empty result cache." );
+
+  cache.store(record);
+  BOOST_REQUIRE_MESSAGE( cache.find(record.key, foundRecord),
+                         "Stored key not found in the result cache." );
+  BOOST_CHECK_MESSAGE( foundRecord.stages == record.stages
+                       && foundRecord.values[3] == record.values[3],
+                       "Found record different from the stored one." );
+
+  // A later record of the same key, as stored by another process
+  record.stages = 3;
+  record.values[3] = -1.;
+  {
+    ResultCache otherCache(fileName);
+    BOOST_REQUIRE_MESSAGE( otherCache.find(record.key, foundRecord),
+                           "Key stored by another cache not found." );
+    otherCache.store(record);
+  }
+  BOOST_REQUIRE_MESSAGE( cache.find(record.key, foundRecord),
+                         "Stored key not found in the result cache." );
+  BOOST_CHECK_MESSAGE( foundRecord.stages == 3
+                       && foundRecord.values[3] == -1.,
+                       "Found record is not the latest one stored." );
+  BOOST_CHECK_MESSAGE( !cache.find(record.key + 1, foundRecord),
+                       "Key never stored found in the result cache." );
+
+  remove(fileName);
+
+}
+
+BOOST_AUTO_TEST_CASE( checkResultCache_badfile )
+{
+
+  const char* fileName = "test_result_cache.bin";
+  {
+    ofstream notCacheFile(fileName, ofstream::trunc);
+    notCacheFile << "Not a result cache file." << endl;
+  }
+
+  string expectedThrownMsg("[ERROR] ");
+  expectedThrownMsg.append("File ");
+  expectedThrownMsg.append(fileName);
+  expectedThrownMsg.append(" is not a result cache of this RRAMSpec");
+  expectedThrownMsg.append(" version. Remove it or choose another");
+  expectedThrownMsg.append(" result cache file.\n");
+
+  string exceptionMsg("No exception.");
+  try {
+    ResultCache cache(fileName);
+  } catch(string exceptionMsgThrown) {
+    exceptionMsg = exceptionMsgThrown;
+  }
+  BOOST_CHECK_MESSAGE( exceptionMsg == expectedThrownMsg,
+                       "Exception message from result cache builder"
+                       << " different from the expected."
+                       << "\nExpected: " << expectedThrownMsg
+                       << "\nGot: " << exceptionMsg);
+
+  remove(fileName);
+
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // RESULTCACHETEST_CPP
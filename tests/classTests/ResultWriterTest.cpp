@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+
+#ifndef RESULTWRITERTEST_CPP
+#define RESULTWRITERTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+
+#include "../../parser/ResultWriter.h"
+
+using namespace std;
+
+BOOST_AUTO_TEST_SUITE( testResultWriter )
+
+BOOST_AUTO_TEST_CASE( checkResultWriter_records )
+{
+
+  Config config;
+  config.cellFileName = "../../tests/cells/test_cell.json";
+  config.techFileName = "../../tests/techs/test_tech.json";
+  config.archFileName = "../../tests/archs/test_arch_pareto.json";
+
+  RRAMSpecResults results;
+  string exceptionMsg("No exception.");
+  try {
+    results = runRRAMSpecConfig(config);
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+  BOOST_REQUIRE_EQUAL(exceptionMsg, "No exception.");
+  BOOST_REQUIRE(!results.paretoFront.empty());
+
+  // One JSON object per line, the front nested in it
+  ostringstream jsonOutput;
+  ResultWriter jsonWriter(jsonOutput, "jsonl");
+  jsonWriter.writeResults(0, config, results);
+  jsonWriter.writeError(1, config, "[ERROR] \"Failed\"\n");
+  string jsonText = jsonOutput.str();
+  BOOST_CHECK_EQUAL(count(jsonText.begin(), jsonText.end(), '\n'), 2);
+  BOOST_CHECK_EQUAL(jsonText.find("{\"Configuration []\":1,"), 0);
+  BOOST_CHECK(jsonText.find("\"Optimization mode []\":\"pareto\"")
+              != string::npos);
+  BOOST_CHECK(jsonText.find("\"Read voltage [V]\":") != string::npos);
+  BOOST_CHECK(jsonText.find("\"Pareto front\":[{") != string::npos);
+  BOOST_CHECK(jsonText.find("{\"Configuration []\":2,") != string::npos);
+  BOOST_CHECK(jsonText.find("\"Error\":\"[ERROR] \\\"Failed\\\"\\n\"}\n")
+              != string::npos);
+
+  // Header, one row for the configuration, one per front solution and
+  //  one for the error - all with the same number of fields
+  ostringstream csvOutput;
+  ResultWriter csvWriter(csvOutput, "csv");
+  csvWriter.writeResults(0, config, results);
+  csvWriter.writeError(1, config, "[ERROR] Failed, twice");
+  istringstream csvLines(csvOutput.str());
+  vector<string> lines;
+  string line;
+  while ( getline(csvLines, line) ) {
+    lines.push_back(line);
+  }
+  BOOST_REQUIRE_EQUAL(lines.size(), results.paretoFront.size() + 3);
+  BOOST_CHECK_EQUAL(lines[0].find("Configuration [],Cell file,"), 0);
+  size_t nCommas = count(lines[0].begin(), lines[0].end(), ',');
+  for (size_t lineID = 1; lineID < lines.size() - 1; ++lineID) {
+    BOOST_CHECK_EQUAL(count(lines[lineID].begin(), lines[lineID].end(), ','),
+                      nCommas);
+  }
+  BOOST_CHECK(lines[1].find(",pareto,,") != string::npos);
+  BOOST_CHECK(lines[2].find(",pareto,1,") != string::npos);
+  // Quoted error field holds one more comma
+  BOOST_CHECK_EQUAL(lines.back().find("2,"), 0);
+  BOOST_CHECK(lines.back().find(",\"[ERROR] Failed, twice\"")
+              != string::npos);
+
+  exceptionMsg = "No exception.";
+  try {
+    ResultWriter badWriter(csvOutput, "xml");
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+  BOOST_CHECK(exceptionMsg.find("[ERROR] Output format \"xml\"") == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // RESULTWRITERTEST_CPP
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+
+#ifndef RRAMSERVERTEST_CPP
+#define RRAMSERVERTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "../../parser/RramServer.h"
+
+using namespace std;
+
+BOOST_AUTO_TEST_SUITE( testRramServer )
+
+BOOST_AUTO_TEST_CASE( checkRramServer_answerRequest )
+{
+
+  RRAMSpecServer server;
+  string answer = server.answerRequest(
+    "{\"id\": 7, \"cell\": \"../../tests/cells/test_cell.json\","
+    " \"tech\": \"../../tests/techs/test_tech.json\","
+    " \"arch\": \"../../tests/archs/test_arch.json\"}");
+  BOOST_CHECK_EQUAL(answer.find("{\"id\":7,\"status\":\"ok\""), 0);
+  BOOST_CHECK(answer.find("\"tRL [ns]\":") != string::npos);
+  BOOST_CHECK(!server.isShutdownRequested());
+
+  // Failing requests are answered, not thrown
+  answer = server.answerRequest(
+    "{\"id\": \"b\", \"cell\": \"../../tests/cells/missing_cell.json\","
+    " \"tech\": \"../../tests/techs/test_tech.json\","
+    " \"arch\": \"../../tests/archs/test_arch.json\"}");
+  BOOST_CHECK_EQUAL(answer.find("{\"id\":\"b\",\"status\":\"error\""), 0);
+
+  answer = server.answerRequest("{\"id\": 8, \"cell\": ");
+  BOOST_CHECK(answer.find("\"status\":\"error\"") != string::npos);
+
+  answer = server.answerRequest("{\"id\": 9, \"command\": \"reboot\"}");
+  BOOST_CHECK_EQUAL(answer.find("{\"id\":9,\"status\":\"error\""), 0);
+  BOOST_CHECK(!server.isShutdownRequested());
+
+  answer = server.answerRequest("{\"id\": 10, \"command\": \"shutdown\"}");
+  BOOST_CHECK_EQUAL(answer, "{\"id\":10,\"status\":\"ok\"}");
+  BOOST_CHECK(server.isShutdownRequested());
+}
+
+BOOST_AUTO_TEST_CASE( checkRramServer_serveStream )
+{
+
+  RRAMSpecServer server;
+  istringstream requests(
+    "{\"id\": 1, \"command\": \"reboot\"}\n"
+    "\n"
+    "{\"id\": 2, \"command\": \"shutdown\"}\n"
+    "{\"id\": 3, \"command\": \"reboot\"}\n");
+  ostringstream answers;
+  server.serveStream(requests, answers);
+
+  // Nothing is answered after the shutdown
+  string answersText = answers.str();
+  BOOST_CHECK(answersText.find("{\"id\":1,\"status\":\"error\"") == 0);
+  BOOST_CHECK(answersText.find("{\"id\":2,\"status\":\"ok\"}\n")
+              != string::npos);
+  BOOST_CHECK(answersText.find("\"id\":3") == string::npos);
+}
+
+BOOST_AUTO_TEST_CASE( checkRramServer_serveSocket )
+{
+
+  const char* socketPath = "rramspec_test.sock";
+  RRAMSpecServer server;
+  thread serverThread([&server, socketPath]() {
+    server.serveSocket(socketPath);
+  });
+
+  sockaddr_un address;
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  strncpy(address.sun_path, socketPath, sizeof(address.sun_path)-1);
+
+  // An idle connection does not hold the others back
+  int idleDescriptor = -1;
+  int clientDescriptor = -1;
+  for (int nTries = 0; nTries < 100 && clientDescriptor < 0; ++nTries) {
+    int descriptor = socket(AF_UNIX, SOCK_STREAM, 0);
+    if ( connect(descriptor, (sockaddr*)&address, sizeof(address)) == 0 ) {
+      if ( idleDescriptor < 0 ) {
+        idleDescriptor = descriptor;
+        continue;
+      }
+      clientDescriptor = descriptor;
+    }
+    else {
+      close(descriptor);
+      this_thread::sleep_for(chrono::milliseconds(20));
+    }
+  }
+  BOOST_REQUIRE(clientDescriptor >= 0);
+
+  string requests("{\"id\": 1, \"command\": \"reboot\"}\n"
+                  "{\"id\": 2, \"command\": \"shutdown\"}\n");
+  BOOST_CHECK_EQUAL(send(clientDescriptor, requests.data(), requests.size(),
+                         0), ssize_t(requests.size()));
+
+  string answers;
+  char buffer[4096];
+  ssize_t nRead;
+  while ( (nRead = read(clientDescriptor, buffer, sizeof(buffer))) > 0 ) {
+    answers.append(buffer, size_t(nRead));
+  }
+  serverThread.join();
+  close(clientDescriptor);
+  close(idleDescriptor);
+
+  BOOST_CHECK(answers.find("{\"id\":1,\"status\":\"error\"") == 0);
+  BOOST_CHECK(answers.find("{\"id\":2,\"status\":\"ok\"}\n")
+              != string::npos);
+  BOOST_CHECK(server.isShutdownRequested());
+  BOOST_CHECK(access(socketPath, F_OK) != 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // RRAMSERVERTEST_CPP
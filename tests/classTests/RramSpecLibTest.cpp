@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+
+#ifndef RRAMSPECLIBTEST_CPP
+#define RRAMSPECLIBTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "../../parser/RramSpecLib.h"
+
+namespace bu=boost::units;
+namespace rrs=boost::units::rramspec;
+
+using namespace std;
+
+BOOST_AUTO_TEST_SUITE( testRramSpecLib )
+
+BOOST_AUTO_TEST_CASE( checkRramSpecLib_files )
+{
+
+  Config config;
+  config.cellFileName = "../../tests/cells/test_cell.json";
+  config.techFileName = "../../tests/techs/test_tech.json";
+  config.archFileName = "../../tests/archs/test_arch.json";
+
+  // Nothing is printed by the library
+  ostringstream printed;
+  streambuf* coutBuffer = cout.rdbuf(printed.rdbuf());
+  RRAMSpecResults results;
+  string exceptionMsg("No exception.");
+  try {
+    results = runRRAMSpecConfig(config);
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+  cout.rdbuf(coutBuffer);
+
+  BOOST_REQUIRE_EQUAL(exceptionMsg, "No exception.");
+  BOOST_CHECK(printed.str().empty());
+
+  BOOST_CHECK_EQUAL(results.optMode, "fixed");
+  BOOST_CHECK_EQUAL(results.nRows.value(), 1024);
+  BOOST_CHECK_EQUAL(results.nCols.value(), 2048);
+  BOOST_CHECK(results.tccdr.value() > 0);
+  BOOST_CHECK(results.writeEnergy.value() > 0);
+  BOOST_CHECK(results.bankArea.value() > 0);
+  BOOST_CHECK(results.paretoFront.empty());
+}
+
+BOOST_AUTO_TEST_CASE( checkRramSpecLib_stats )
+{
+
+  Config config;
+  config.cellFileName = "../../tests/cells/test_cell.json";
+  config.techFileName = "../../tests/techs/test_tech.json";
+  config.archFileName = "../../tests/archs/test_arch.json";
+
+  RRAMSpecResults results = runRRAMSpecConfig(config);
+  BOOST_CHECK_EQUAL(results.stats.arrayUpdates, 0);
+
+  // Counting changes no result
+  setPerfStatsEnabled(true);
+  RRAMSpecResults countedResults = runRRAMSpecConfig(config);
+  setPerfStatsEnabled(false);
+
+  BOOST_CHECK_EQUAL(countedResults.tccdr.value(), results.tccdr.value());
+  BOOST_CHECK_EQUAL(countedResults.writeEnergy.value(),
+                    results.writeEnergy.value());
+
+  const PerfStats& stats = countedResults.stats;
+  BOOST_CHECK(stats.arrayUpdates >= 1);
+  BOOST_CHECK(stats.selectedCellSolves > 0);
+  BOOST_CHECK(stats.selectedCellIterations >= stats.selectedCellSolves);
+  BOOST_CHECK(stats.readVoltageSearches > 0);
+  BOOST_CHECK(stats.cellIxVBuilds + stats.cellIxVCacheHits > 0);
+  BOOST_CHECK(stats.rawCellCurrentLookups > 0);
+}
+
+BOOST_AUTO_TEST_CASE( checkRramSpecLib_memory )
+{
+
+  Config fileConfig;
+  fileConfig.cellFileName = "../../tests/cells/test_cell.json";
+  fileConfig.techFileName = "../../tests/techs/test_tech.json";
+  fileConfig.archFileName = "../../tests/archs/test_arch_pareto.json";
+
+  // Same descriptions as texts, with no file to fall back to
+  Config memoryConfig;
+  ostringstream fileText;
+  fileText << ifstream(fileConfig.cellFileName).rdbuf();
+  memoryConfig.cellJSON = fileText.str();
+  fileText.str("");
+  fileText << ifstream(fileConfig.techFileName).rdbuf();
+  memoryConfig.techJSON = fileText.str();
+  fileText.str("");
+  fileText << ifstream(fileConfig.archFileName).rdbuf();
+  memoryConfig.archJSON = fileText.str();
+
+  // Reentrant - both configurations run at once
+  RRAMSpecResults fileResults;
+  RRAMSpecResults memoryResults;
+  string fileError;
+  thread fileThread([&]() {
+    try {
+      fileResults = runRRAMSpecConfig(fileConfig);
+    }catch (string exceptionMsgThrown){
+      fileError = exceptionMsgThrown;
+    }
+  });
+  string memoryError;
+  try {
+    memoryResults = runRRAMSpecConfig(memoryConfig);
+  }catch (string exceptionMsgThrown){
+    memoryError = exceptionMsgThrown;
+  }
+  fileThread.join();
+
+  BOOST_REQUIRE_EQUAL(fileError, "");
+  BOOST_REQUIRE_EQUAL(memoryError, "");
+
+  BOOST_CHECK_EQUAL(memoryResults.optMode, "pareto");
+  BOOST_CHECK_EQUAL(memoryResults.tccdr.value(), fileResults.tccdr.value());
+  BOOST_CHECK_EQUAL(memoryResults.writeEnergy.value(),
+                    fileResults.writeEnergy.value());
+  BOOST_CHECK_EQUAL(memoryResults.bankArea.value(),
+                    fileResults.bankArea.value());
+  BOOST_CHECK(!memoryResults.paretoFront.empty());
+  BOOST_CHECK_EQUAL(memoryResults.paretoFront.size(),
+                    fileResults.paretoFront.size());
+  // Banners of the optimization are returned, not printed
+  BOOST_CHECK(memoryResults.messages.find("Pareto Front") != string::npos);
+  // Every message has its line - no blank ones from the array updates
+  BOOST_CHECK(memoryResults.messages.find("\n\n") == string::npos);
+  BOOST_CHECK(memoryResults.messages.compare(0, 1, "\n") != 0);
+}
+
+BOOST_AUTO_TEST_CASE( checkRramSpecLib_error )
+{
+
+  Config config;
+  config.cellFileName = "../../tests/cells/test_cell.json";
+  config.techFileName = "../../tests/techs/test_tech.json";
+  config.archJSON = "{\"Optimization mode []\": \"fixed\"}";
+
+  string exceptionMsg("No exception.");
+  try {
+    runRRAMSpecConfig(config);
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+  BOOST_CHECK(exceptionMsg.find("[ERROR] Could not find member") == 0);
+  BOOST_CHECK(exceptionMsg.find("given in memory") != string::npos);
+  // Messages of the calling thread are restored after a failure
+  BOOST_CHECK(&messageStream() == &cout);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // RRAMSPECLIBTEST_CPP
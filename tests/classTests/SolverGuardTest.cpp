@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+#ifndef SOLVERGUARDTEST_CPP
+#define SOLVERGUARDTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <limits>
+#include <string>
+
+#include "../../utils/SolverGuard.h"
+
+using namespace std;
+
+BOOST_AUTO_TEST_SUITE( testSolverGuard )
+
+BOOST_AUTO_TEST_CASE( checkSolverGuard_limits )
+{
+
+  SolverLimits limits;
+  limits.maxIterations = 3;
+  SolverGuard guard(limits, "Test solver");
+
+  string exceptionMsg("No exception.");
+  try {
+    for (size_t iteration = 0; iteration < 3; ++iteration) {
+      guard.startIteration();
+    }
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+  string expectedThrownMsg("No exception.");
+  BOOST_CHECK_MESSAGE( exceptionMsg == expectedThrownMsg,
+                       "Exception message within the iteration limit"
+                       << " different from the expected."
+                       << "\nExpected: " << expectedThrownMsg
+                       << "\nGot: " << exceptionMsg);
+
+  try {
+    guard.startIteration();
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+  expectedThrownMsg = "[ERROR] Test solver did not converge after 3";
+  expectedThrownMsg.append(" iterations.\n");
+  BOOST_CHECK_MESSAGE( exceptionMsg == expectedThrownMsg,
+                       "Exception message past the iteration limit"
+                       << " different from the expected."
+                       << "\nExpected: " << expectedThrownMsg
+                       << "\nGot: " << exceptionMsg);
+
+  // A time limit already passed
+  limits.maxIterations = 100;
+  limits.maxSeconds = 1e-9;
+  SolverGuard timedGuard(limits, "Test solver");
+  exceptionMsg = "No exception.";
+  try {
+    for (size_t iteration = 0; iteration < 100; ++iteration) {
+      timedGuard.startIteration();
+    }
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+  expectedThrownMsg = "[ERROR] Test solver did not converge within";
+  BOOST_CHECK_MESSAGE( exceptionMsg.find(expectedThrownMsg) == 0,
+                       "Exception message past the time limit"
+                       << " different from the expected."
+                       << "\nExpected: " << expectedThrownMsg
+                       << "\nGot: " << exceptionMsg);
+
+}
+
+BOOST_AUTO_TEST_CASE( checkSolverGuard_relaxation )
+{
+
+  SolverLimits limits;
+  SolverGuard guard(limits, "Test solver");
+
+  // Decreasing errors never relax the solve
+  double relError = 1.;
+  for (size_t iteration = 0; iteration < 100; ++iteration) {
+    guard.startIteration();
+    relError /= 1.1;
+    guard.checkError(relError);
+  }
+  BOOST_CHECK_MESSAGE( guard.getRelaxation() == 1.,
+                       "Relaxation of a converging solve"
+                       << " different from the expected."
+                       << "\nExpected: 1"
+                       << "\nGot: " << guard.getRelaxation());
+
+  // Oscillating errors halve it once per stall
+  for (size_t iteration = 0; iteration < 2 * SOLVER_STALL_ITERATIONS;
+       ++iteration) {
+    guard.startIteration();
+    guard.checkError(iteration % 2 ? 1. : -1.);
+  }
+  BOOST_CHECK_MESSAGE( guard.getRelaxation() == 0.25,
+                       "Relaxation of an oscillating solve"
+                       << " different from the expected."
+                       << "\nExpected: 0.25"
+                       << "\nGot: " << guard.getRelaxation());
+
+  // Unrelaxed updates are exact, relaxed ones move part of the way
+  BOOST_CHECK( relaxedUpdate(0.1, 0.3, 1.) == 0.3 );
+  BOOST_CHECK( relaxedUpdate(1., 3., 0.5) == 2. );
+
+  // Largest step magnitudes keep a NaN wherever it shows up
+  const double nan = numeric_limits<double>::quiet_NaN();
+  BOOST_CHECK( maxMagnitude(maxMagnitude(0., -2.), 1.) == 2. );
+  BOOST_CHECK( std::isnan(maxMagnitude(maxMagnitude(0., nan), 1.)) );
+  BOOST_CHECK( std::isnan(maxMagnitude(maxMagnitude(0., 1.), nan)) );
+
+  // Non finite errors diverge at once
+  string exceptionMsg("No exception.");
+  try {
+    guard.startIteration();
+    guard.checkError(numeric_limits<double>::quiet_NaN());
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+  string expectedThrownMsg("[ERROR] Test solver diverged after ");
+  BOOST_CHECK_MESSAGE( exceptionMsg.find(expectedThrownMsg) == 0,
+                       "Exception message of a diverging solve"
+                       << " different from the expected."
+                       << "\nExpected: " << expectedThrownMsg
+                       << "\nGot: " << exceptionMsg);
+
+}
+
+BOOST_AUTO_TEST_CASE( checkSolverGuard_finite )
+{
+
+  SolverLimits limits;
+  SolverGuard guard(limits, "Test solver");
+
+  // Solves never relaxed are not relaxed by stalling errors, nor taken as
+  //  diverging however long they stall
+  for (size_t iteration = 0; iteration < 1000 * SOLVER_STALL_ITERATIONS;
+       ++iteration) {
+    guard.startIteration();
+    guard.checkFinite(1.);
+  }
+  BOOST_CHECK_MESSAGE( guard.getRelaxation() == 1.,
+                       "Relaxation of a stalling unrelaxed solve"
+                       << " different from the expected."
+                       << "\nExpected: 1"
+                       << "\nGot: " << guard.getRelaxation());
+
+  // Non finite errors still diverge at once
+  string exceptionMsg("No exception.");
+  try {
+    guard.startIteration();
+    guard.checkFinite(numeric_limits<double>::infinity());
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+  string expectedThrownMsg("[ERROR] Test solver diverged after ");
+  BOOST_CHECK_MESSAGE( exceptionMsg.find(expectedThrownMsg) == 0,
+                       "Exception message of a diverging unrelaxed solve"
+                       << " different from the expected."
+                       << "\nExpected: " << expectedThrownMsg
+                       << "\nGot: " << exceptionMsg);
+
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // SOLVERGUARDTEST_CPP
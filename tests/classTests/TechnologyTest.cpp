@@ -143,10 +143,10 @@ BOOST_AUTO_TEST_CASE( checkTechnology_Setters_and_Getters_Values )
   string expString = INVALID_STRING;
 
   expDouble = 1;
-  myTechnology.setMetalHalfPitch( expDouble * rrs::nanometers );
+  myTechnology.setMetalHalfPitch( expDouble * rrs::meters );
 
   expDouble++;
-  myTechnology.setMetalThickness( expDouble * rrs::nanometers );
+  myTechnology.setMetalThickness( expDouble * rrs::meters );
 
   expDouble++;
   myTechnology.setMetalResistivity( expDouble * rrs::ohm_meters );
@@ -155,66 +155,66 @@ BOOST_AUTO_TEST_CASE( checkTechnology_Setters_and_Getters_Values )
   myTechnology.setMetalSheetResistance( expDouble * rrs::ohms, forced );
 
   expDouble++;
-  myTechnology.setMetalResistancePerLength( expDouble * rrs::ohms_per_nanometer,
+  myTechnology.setMetalResistancePerLength( expDouble * rrs::ohms_per_meter,
                                             forced );
 
   expDouble++;
   myTechnology.setMetalCapacitancePerLength(
-        expDouble * rrs::nanofarads_per_meter );
+        expDouble * rrs::farads_per_meter );
 
   expDouble++;
   myTechnology.setSubsRelPermtvt( expDouble );
 
   expDouble++;
-  myTechnology.setSubsAbsPermtvt(expDouble*rrs::picofarads_per_meter, forced );
+  myTechnology.setSubsAbsPermtvt(expDouble*rrs::farads_per_meter, forced );
 
   expDouble++;
   myTechnology.setBreakdownVoltage( expDouble * rrs::volts );
 
   expDouble++;
-  myTechnology.setMinPMOSChannelLength( expDouble * rrs::nanometers );
+  myTechnology.setMinPMOSChannelLength( expDouble * rrs::meters );
 
   expDouble++;
-  myTechnology.setMinPMOSChannelWidth( expDouble * rrs::nanometers );
+  myTechnology.setMinPMOSChannelWidth( expDouble * rrs::meters );
 
   expDouble++;
-  myTechnology.setMinNMOSChannelLength( expDouble * rrs::nanometers );
+  myTechnology.setMinNMOSChannelLength( expDouble * rrs::meters );
 
   expDouble++;
-  myTechnology.setMinNMOSChannelWidth( expDouble * rrs::nanometers );
+  myTechnology.setMinNMOSChannelWidth( expDouble * rrs::meters );
 
   expDouble++;
-  myTechnology.setNMOSResWidthProduct( expDouble * rrs::microohm_meters );
+  myTechnology.setNMOSResWidthProduct( expDouble * rrs::ohm_meters );
 
   expDouble++;
-  myTechnology.setPMOSResWidthProduct( expDouble * rrs::microohm_meters );
+  myTechnology.setPMOSResWidthProduct( expDouble * rrs::ohm_meters );
 
   expDouble++;
-  myTechnology.setGateExtensionOfActive( expDouble * rrs::nanometers );
+  myTechnology.setGateExtensionOfActive( expDouble * rrs::meters );
 
   expDouble++;
-  myTechnology.setPolyToPolySpacing( expDouble * rrs::nanometers );
+  myTechnology.setPolyToPolySpacing( expDouble * rrs::meters );
 
   expDouble++;
-  myTechnology.setActiveExtensionOfPoly( expDouble * rrs::nanometers );
+  myTechnology.setActiveExtensionOfPoly( expDouble * rrs::meters );
 
   expDouble++;
-  myTechnology.setActiveToActiveSpacing( expDouble * rrs::nanometers );
+  myTechnology.setActiveToActiveSpacing( expDouble * rrs::meters );
 
   expDouble = 1;
   BOOST_CHECK_MESSAGE( myTechnology.getMetalHalfPitch()
-                        == expDouble * rrs::nanometers,
+                        == expDouble * rrs::meters,
                        "Metal half pitch"
                        << " was not correctly set."
-                       << "\nExpected: " << expDouble * rrs::nanometers
+                       << "\nExpected: " << expDouble * rrs::meters
                        << "\nGot: " << myTechnology.getMetalHalfPitch());
 
   expDouble++;
   BOOST_CHECK_MESSAGE( myTechnology.getMetalThickness()
-                        == expDouble * rrs::nanometers,
+                        == expDouble * rrs::meters,
                        "Metal thickness"
                        << " was not correctly set."
-                       << "\nExpected: " << expDouble * rrs::nanometers
+                       << "\nExpected: " << expDouble * rrs::meters
                        << "\nGot: " << myTechnology.getMetalThickness());
 
   expDouble++;
@@ -235,20 +235,20 @@ BOOST_AUTO_TEST_CASE( checkTechnology_Setters_and_Getters_Values )
 
   expDouble++;
   BOOST_CHECK_MESSAGE( myTechnology.getMetalResistancePerLength()
-                        == expDouble * rrs::ohms_per_nanometer,
+                        == expDouble * rrs::ohms_per_meter,
                        "Metal resistance per length"
                        << " was not correctly set."
-                       << "\nExpected: " << expDouble * rrs::ohms_per_nanometer
+                       << "\nExpected: " << expDouble * rrs::ohms_per_meter
                        << "\nGot: "
                        << myTechnology.getMetalResistancePerLength());
 
   expDouble++;
   BOOST_CHECK_MESSAGE( myTechnology.getMetalCapacitancePerLength()
-                        == expDouble * rrs::nanofarads_per_meter,
+                        == expDouble * rrs::farads_per_meter,
                        "Metal capacitance per length"
                        << " was not correctly set."
                        << "\nExpected: "
-                       << expDouble * rrs::nanofarads_per_meter
+                       << expDouble * rrs::farads_per_meter
                        << "\nGot: "
                        << myTechnology.getMetalCapacitancePerLength());
 
@@ -262,11 +262,11 @@ BOOST_AUTO_TEST_CASE( checkTechnology_Setters_and_Getters_Values )
 
   expDouble++;
   BOOST_CHECK_MESSAGE( myTechnology.getSubsAbsPermtvt()
-                        == expDouble * rrs::picofarads_per_meter,
+                        == expDouble * rrs::farads_per_meter,
                        "Substrate absolute permittivity"
                        << " was not correctly set."
                        << "\nExpected: "
-                       << expDouble * rrs::picofarads_per_meter
+                       << expDouble * rrs::farads_per_meter
                        << "\nGot: " << myTechnology.getSubsAbsPermtvt());
 
   expDouble++;
@@ -280,92 +280,92 @@ BOOST_AUTO_TEST_CASE( checkTechnology_Setters_and_Getters_Values )
 
   expDouble++;
   BOOST_CHECK_MESSAGE( myTechnology.getMinPMOSChannelLength()
-                        == expDouble * rrs::nanometers,
+                        == expDouble * rrs::meters,
                        "Minimum PMOS channel length"
                        << " was not correctly set."
                        << "\nExpected: "
-                       << expDouble * rrs::nanometers
+                       << expDouble * rrs::meters
                        << "\nGot: " << myTechnology.getMinPMOSChannelLength());
 
   expDouble++;
   BOOST_CHECK_MESSAGE( myTechnology.getMinPMOSChannelWidth()
-                        == expDouble * rrs::nanometers,
+                        == expDouble * rrs::meters,
                        "Minimum PMOS channel width"
                        << " was not correctly set."
                        << "\nExpected: "
-                       << expDouble * rrs::nanometers
+                       << expDouble * rrs::meters
                        << "\nGot: " << myTechnology.getMinPMOSChannelWidth());
 
   expDouble++;
   BOOST_CHECK_MESSAGE( myTechnology.getMinNMOSChannelLength()
-                        == expDouble * rrs::nanometers,
+                        == expDouble * rrs::meters,
                        "Minimum NMOS channel length"
                        << " was not correctly set."
                        << "\nExpected: "
-                       << expDouble * rrs::nanometers
+                       << expDouble * rrs::meters
                        << "\nGot: " << myTechnology.getMinNMOSChannelLength());
 
   expDouble++;
   BOOST_CHECK_MESSAGE( myTechnology.getMinNMOSChannelWidth()
-                        == expDouble * rrs::nanometers,
+                        == expDouble * rrs::meters,
                        "Minimum NMOS channel width"
                        << " was not correctly set."
                        << "\nExpected: "
-                       << expDouble * rrs::nanometers
+                       << expDouble * rrs::meters
                        << "\nGot: " << myTechnology.getMinNMOSChannelWidth());
 
   expDouble++;
   BOOST_CHECK_MESSAGE( myTechnology.getNMOSResWidthProduct()
-                        == 1000 * expDouble * rrs::nanoohm_meters,
+                        == expDouble * rrs::ohm_meters,
                        "NMOS resistance-width product"
                        << " was not correctly set."
                        << "\nExpected: "
-                       << 1000 * expDouble * rrs::nanoohm_meters
+                       << expDouble * rrs::ohm_meters
                        << "\nGot: " << myTechnology.getNMOSResWidthProduct());
 
   expDouble++;
   BOOST_CHECK_MESSAGE( myTechnology.getPMOSResWidthProduct()
-                        == 1000 * expDouble * rrs::nanoohm_meters,
+                        == expDouble * rrs::ohm_meters,
                        "PMOS resistance-width product"
                        << " was not correctly set."
                        << "\nExpected: "
-                       << 1000 * expDouble * rrs::nanoohm_meters
+                       << expDouble * rrs::ohm_meters
                        << "\nGot: " << myTechnology.getPMOSResWidthProduct());
 
   expDouble++;
   BOOST_CHECK_MESSAGE( myTechnology.getGateExtensionOfActive()
-                        == expDouble * rrs::nanometers,
+                        == expDouble * rrs::meters,
                        "Gate extension of active layer"
                        << " was not correctly set."
                        << "\nExpected: "
-                       << expDouble * rrs::nanometers
+                       << expDouble * rrs::meters
                        << "\nGot: " << myTechnology.getGateExtensionOfActive());
 
   expDouble++;
   BOOST_CHECK_MESSAGE( myTechnology.getPolyToPolySpacing()
-                        == expDouble * rrs::nanometers,
+                        == expDouble * rrs::meters,
                        "Poly to poly spacing"
                        << " was not correctly set."
                        << "\nExpected: "
-                       << expDouble * rrs::nanometers
+                       << expDouble * rrs::meters
                        << "\nGot: " << myTechnology.getPolyToPolySpacing());
 
   expDouble++;
   BOOST_CHECK_MESSAGE( myTechnology.getActiveExtensionOfPoly()
-                        == expDouble * rrs::nanometers,
+                        == expDouble * rrs::meters,
                        "Active layer extension of poly"
                        << " was not correctly set."
                        << "\nExpected: "
-                       << expDouble * rrs::nanometers
+                       << expDouble * rrs::meters
                        << "\nGot: " << myTechnology.getActiveExtensionOfPoly());
 
   expDouble++;
   BOOST_CHECK_MESSAGE( myTechnology.getActiveToActiveSpacing()
-                        == expDouble * rrs::nanometers,
+                        == expDouble * rrs::meters,
                        "Active layer to active layer spacing"
                        << " was not correctly set."
                        << "\nExpected: "
-                       << expDouble * rrs::nanometers
+                       << expDouble * rrs::meters
                        << "\nGot: " << myTechnology.getActiveToActiveSpacing());
 
 }
@@ -423,7 +423,7 @@ BOOST_AUTO_TEST_CASE( checkTechnology_Setters_and_Getters_Errors )
   exceptionMsg = "No exception.";
   try {
     Technology myTechnology;
-    myTechnology.setMetalThickness( 1. * rrs::nanometers );
+    myTechnology.setMetalThickness( 1e-9 * rrs::meters );
     myTechnology.setMetalSheetResistance( INVALID_DOUBLE * rrs::ohms );
   }catch (string exceptionMsgThrown) {
     exceptionMsg = exceptionMsgThrown;
@@ -447,7 +447,7 @@ BOOST_AUTO_TEST_CASE( checkTechnology_Setters_and_Getters_Errors )
   try {
     Technology myTechnology;
     myTechnology.setMetalResistivity( 10. * rrs::ohm_meters );
-    myTechnology.setMetalThickness( 2. * rrs::nanometers );
+    myTechnology.setMetalThickness( 2e-9 * rrs::meters );
     myTechnology.setMetalSheetResistance( 1. * rrs::ohms );
   }catch (string exceptionMsgThrown) {
     exceptionMsg = exceptionMsgThrown;
@@ -475,7 +475,7 @@ BOOST_AUTO_TEST_CASE( checkTechnology_Setters_and_Getters_Errors )
   exceptionMsg = "No exception.";
   try {
     Technology myTechnology;
-    myTechnology.setSubsAbsPermtvt( INVALID_DOUBLE*rrs::picofarads_per_meter );
+    myTechnology.setSubsAbsPermtvt( INVALID_DOUBLE*rrs::farads_per_meter );
   }catch (string exceptionMsgThrown) {
     exceptionMsg = exceptionMsgThrown;
   }
@@ -498,7 +498,7 @@ BOOST_AUTO_TEST_CASE( checkTechnology_Setters_and_Getters_Errors )
   try {
     Technology myTechnology;
     myTechnology.setSubsRelPermtvt( 1. );
-    myTechnology.setSubsAbsPermtvt( 1.*rrs::picofarads_per_meter );
+    myTechnology.setSubsAbsPermtvt( 1e-12*rrs::farads_per_meter );
   }catch (string exceptionMsgThrown) {
     exceptionMsg = exceptionMsgThrown;
   }
@@ -566,7 +566,9 @@ BOOST_AUTO_TEST_CASE( checkTechnology_Test_input )
   double expDouble = INVALID_DOUBLE;
 
   expDouble = 40;
-  BOOST_CHECK_MESSAGE( round(myTechnology.getMetalHalfPitch(), 6)
+  BOOST_CHECK_MESSAGE( round(SCALE_QUANTITY(
+                         myTechnology.getMetalHalfPitch(),
+                         rrs::nanometer_unit), 6)
                         == expDouble * rrs::nanometers,
                        "Metal half pitch"
                        << " was not correctly set."
@@ -574,7 +576,9 @@ BOOST_AUTO_TEST_CASE( checkTechnology_Test_input )
                        << "\nGot: " << myTechnology.getMetalHalfPitch());
 
   expDouble = 100;
-  BOOST_CHECK_MESSAGE( round(myTechnology.getMetalThickness(), 6)
+  BOOST_CHECK_MESSAGE( round(SCALE_QUANTITY(
+                         myTechnology.getMetalThickness(),
+                         rrs::nanometer_unit), 6)
                         == expDouble * rrs::nanometers,
                        "Metal thickness"
                        << " was not correctly set."
@@ -598,7 +602,9 @@ BOOST_AUTO_TEST_CASE( checkTechnology_Test_input )
                        << "\nGot: " << myTechnology.getMetalSheetResistance());
 
   expDouble = 0.025;
-  BOOST_CHECK_MESSAGE( round(myTechnology.getMetalResistancePerLength(), 6)
+  BOOST_CHECK_MESSAGE( round(SCALE_QUANTITY(
+                         myTechnology.getMetalResistancePerLength(),
+                         rrs::ohm_per_nanometer_unit), 6)
                         == expDouble * rrs::ohms_per_nanometer,
                        "Metal resistance per length"
                        << " was not correctly set."
@@ -607,7 +613,9 @@ BOOST_AUTO_TEST_CASE( checkTechnology_Test_input )
                        << myTechnology.getMetalResistancePerLength());
 
   expDouble = .2;
-  BOOST_CHECK_MESSAGE( myTechnology.getMetalCapacitancePerLength()
+  BOOST_CHECK_MESSAGE( round(SCALE_QUANTITY(
+                         myTechnology.getMetalCapacitancePerLength(),
+                         rrs::nanofarad_per_meter_unit), 6)
                         == expDouble * rrs::nanofarads_per_meter,
                        "Metal capacitance per length"
                        << " was not correctly set."
@@ -625,7 +633,9 @@ BOOST_AUTO_TEST_CASE( checkTechnology_Test_input )
                        << "\nGot: " << myTechnology.getSubsRelPermtvt());
 
   expDouble = 44.2709;
-  BOOST_CHECK_MESSAGE( round(myTechnology.getSubsAbsPermtvt(), 6)
+  BOOST_CHECK_MESSAGE( round(SCALE_QUANTITY(
+                         myTechnology.getSubsAbsPermtvt(),
+                         rrs::picofarad_per_meter_unit), 6)
                         == expDouble * rrs::picofarads_per_meter,
                        "Substrate absolute permittivity"
                        << " was not correctly set."
@@ -643,7 +653,9 @@ BOOST_AUTO_TEST_CASE( checkTechnology_Test_input )
                        << "\nGot: " << myTechnology.getBreakdownVoltage());
 
   expDouble = 400;
-  BOOST_CHECK_MESSAGE( round(myTechnology.getMinPMOSChannelLength(), 6)
+  BOOST_CHECK_MESSAGE( round(SCALE_QUANTITY(
+                         myTechnology.getMinPMOSChannelLength(),
+                         rrs::nanometer_unit), 6)
                         == expDouble * rrs::nanometers,
                        "Minimum PMOS channel length"
                        << " was not correctly set."
@@ -652,7 +664,9 @@ BOOST_AUTO_TEST_CASE( checkTechnology_Test_input )
                        << "\nGot: " << myTechnology.getMinPMOSChannelLength());
 
   expDouble = 320;
-  BOOST_CHECK_MESSAGE( round(myTechnology.getMinPMOSChannelWidth(), 6)
+  BOOST_CHECK_MESSAGE( round(SCALE_QUANTITY(
+                         myTechnology.getMinPMOSChannelWidth(),
+                         rrs::nanometer_unit), 6)
                         == expDouble * rrs::nanometers,
                        "Minimum PMOS channel width"
                        << " was not correctly set."
@@ -661,7 +675,9 @@ BOOST_AUTO_TEST_CASE( checkTechnology_Test_input )
                        << "\nGot: " << myTechnology.getMinPMOSChannelWidth());
 
   expDouble = 500;
-  BOOST_CHECK_MESSAGE( round(myTechnology.getMinNMOSChannelLength(), 6)
+  BOOST_CHECK_MESSAGE( round(SCALE_QUANTITY(
+                         myTechnology.getMinNMOSChannelLength(),
+                         rrs::nanometer_unit), 6)
                         == expDouble * rrs::nanometers,
                        "Minimum NMOS channel length"
                        << " was not correctly set."
@@ -670,7 +686,9 @@ BOOST_AUTO_TEST_CASE( checkTechnology_Test_input )
                        << "\nGot: " << myTechnology.getMinNMOSChannelLength());
 
   expDouble = 320;
-  BOOST_CHECK_MESSAGE( round(myTechnology.getMinNMOSChannelWidth(), 6)
+  BOOST_CHECK_MESSAGE( round(SCALE_QUANTITY(
+                         myTechnology.getMinNMOSChannelWidth(),
+                         rrs::nanometer_unit), 6)
                         == expDouble * rrs::nanometers,
                        "Minimum NMOS channel width"
                        << " was not correctly set."
@@ -679,7 +697,9 @@ BOOST_AUTO_TEST_CASE( checkTechnology_Test_input )
                        << "\nGot: " << myTechnology.getMinNMOSChannelWidth());
 
   expDouble = 2600000;
-  BOOST_CHECK_MESSAGE( round(myTechnology.getNMOSResWidthProduct(), 6)
+  BOOST_CHECK_MESSAGE( round(SCALE_QUANTITY(
+                         myTechnology.getNMOSResWidthProduct(),
+                         rrs::nanoohm_meter_unit), 6)
                         == expDouble * rrs::nanoohm_meters,
                        "NMOS resistance-width product"
                        << " was not correctly set."
@@ -688,7 +708,9 @@ BOOST_AUTO_TEST_CASE( checkTechnology_Test_input )
                        << "\nGot: " << myTechnology.getNMOSResWidthProduct());
 
   expDouble = 5000000;
-  BOOST_CHECK_MESSAGE( round(myTechnology.getPMOSResWidthProduct(), 6)
+  BOOST_CHECK_MESSAGE( round(SCALE_QUANTITY(
+                         myTechnology.getPMOSResWidthProduct(),
+                         rrs::nanoohm_meter_unit), 6)
                         == expDouble * rrs::nanoohm_meters,
                        "PMOS resistance-width product"
                        << " was not correctly set."
@@ -697,7 +719,9 @@ BOOST_AUTO_TEST_CASE( checkTechnology_Test_input )
                        << "\nGot: " << myTechnology.getPMOSResWidthProduct());
 
   expDouble = 120;
-  BOOST_CHECK_MESSAGE( round(myTechnology.getGateExtensionOfActive(), 6)
+  BOOST_CHECK_MESSAGE( round(SCALE_QUANTITY(
+                         myTechnology.getGateExtensionOfActive(),
+                         rrs::nanometer_unit), 6)
                         == expDouble * rrs::nanometers,
                        "Gate extension of active layer"
                        << " was not correctly set."
@@ -706,7 +730,9 @@ BOOST_AUTO_TEST_CASE( checkTechnology_Test_input )
                        << "\nGot: " << myTechnology.getGateExtensionOfActive());
 
   expDouble = 120;
-  BOOST_CHECK_MESSAGE( round(myTechnology.getPolyToPolySpacing(), 6)
+  BOOST_CHECK_MESSAGE( round(SCALE_QUANTITY(
+                         myTechnology.getPolyToPolySpacing(),
+                         rrs::nanometer_unit), 6)
                         == expDouble * rrs::nanometers,
                        "Poly to poly spacing"
                        << " was not correctly set."
@@ -715,7 +741,9 @@ BOOST_AUTO_TEST_CASE( checkTechnology_Test_input )
                        << "\nGot: " << myTechnology.getPolyToPolySpacing());
 
   expDouble = 90;
-  BOOST_CHECK_MESSAGE( round(myTechnology.getActiveExtensionOfPoly(), 6)
+  BOOST_CHECK_MESSAGE( round(SCALE_QUANTITY(
+                         myTechnology.getActiveExtensionOfPoly(),
+                         rrs::nanometer_unit), 6)
                         == expDouble * rrs::nanometers,
                        "Active layer extension of poly"
                        << " was not correctly set."
@@ -724,7 +752,9 @@ BOOST_AUTO_TEST_CASE( checkTechnology_Test_input )
                        << "\nGot: " << myTechnology.getActiveExtensionOfPoly());
 
   expDouble = 120;
-  BOOST_CHECK_MESSAGE( round(myTechnology.getActiveToActiveSpacing(), 6)
+  BOOST_CHECK_MESSAGE( round(SCALE_QUANTITY(
+                         myTechnology.getActiveToActiveSpacing(),
+                         rrs::nanometer_unit), 6)
                         == expDouble * rrs::nanometers,
                        "Active layer to active layer spacing"
                        << " was not correctly set."
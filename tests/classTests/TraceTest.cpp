@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+#ifndef TRACETEST_CPP
+#define TRACETEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "../../utils/functions.h"
+#include "../../utils/Trace.h"
+
+using namespace std;
+
+BOOST_AUTO_TEST_SUITE( testTrace )
+
+BOOST_AUTO_TEST_CASE( checkTrace_writeTrace )
+{
+
+  const char* fileName = "test_trace.json";
+  remove(fileName);
+
+  // Nothing is recorded unless enabled
+  {
+    TRACE_SCOPE("Untraced scope");
+  }
+
+  setTraceEnabled(true);
+  {
+    TRACE_SCOPE_DETAIL("Outer scope", "size " << 42);
+    {
+      TRACE_SCOPE("Inner scope");
+      COUNT_SOLVER_ITERATION();
+    }
+  }
+  // Scopes of worker threads get rows of their own
+  runParallelTasks(4, 2, [](size_t) {
+    TRACE_SCOPE("Worker scope");
+  });
+  setTraceEnabled(false);
+
+  writeTrace(fileName);
+
+  ifstream traceFile(fileName);
+  BOOST_REQUIRE_MESSAGE( traceFile.is_open(), "Trace file not written." );
+  stringstream trace;
+  trace << traceFile.rdbuf();
+  const string traceText = trace.str();
+
+  BOOST_CHECK( traceText.find("\"traceEvents\":[") != string::npos );
+  BOOST_CHECK( traceText.find("Untraced scope") == string::npos );
+  BOOST_CHECK( traceText.find("{\"name\":\"Outer scope\"") != string::npos );
+  BOOST_CHECK( traceText.find("\"detail\":\"size 42\"") != string::npos );
+  BOOST_CHECK( traceText.find("\"solver iterations\":1") != string::npos );
+  BOOST_CHECK( traceText.find("\"ph\":\"X\"") != string::npos );
+  BOOST_CHECK( traceText.find("\"name\":\"thread_name\"") != string::npos );
+
+  size_t nWorkerEvents = 0;
+  for (size_t found = traceText.find("Worker scope"); found != string::npos;
+       found = traceText.find("Worker scope", found + 1)) {
+    ++nWorkerEvents;
+  }
+  BOOST_CHECK_EQUAL( nWorkerEvents, 4 );
+
+  // Enabling again starts a new timeline
+  setTraceEnabled(true);
+  setTraceEnabled(false);
+  writeTrace(fileName);
+  ifstream emptyTraceFile(fileName);
+  stringstream emptyTrace;
+  emptyTrace << emptyTraceFile.rdbuf();
+  BOOST_CHECK( emptyTrace.str().find("Outer scope") == string::npos );
+
+  remove(fileName);
+
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // TRACETEST_CPP
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+#ifndef WORKERPOOLTEST_CPP
+#define WORKERPOOLTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <string>
+#include <vector>
+
+#include "../../utils/WorkerPool.h"
+
+using namespace std;
+
+BOOST_AUTO_TEST_SUITE( testWorkerPool )
+
+BOOST_AUTO_TEST_CASE( checkWorkerPool_run )
+{
+  WorkerPool pool;
+
+  // A single worker runs on the calling thread
+  vector<size_t> nRuns(4, 0);
+  pool.run(1, [&](size_t worker) { ++nRuns[worker]; });
+  BOOST_CHECK_MESSAGE( nRuns[0] == 1 && pool.getNThreads() == 0,
+                       "Single worker run not on the calling thread.");
+
+  // Threads are started once and kept for the next runs, also the ones
+  //  on fewer workers
+  for (size_t nWorkers : {4, 2, 4, 3}) {
+    nRuns.assign(4, 0);
+    pool.run(nWorkers, [&](size_t worker) { ++nRuns[worker]; });
+    for (size_t worker = 0; worker < 4; ++worker) {
+      size_t expRuns = (worker < nWorkers) ? 1 : 0;
+      BOOST_CHECK_MESSAGE( nRuns[worker] == expRuns,
+                           "Worker " << worker << " of a run on "
+                           << nWorkers << " workers ran " << nRuns[worker]
+                           << " times instead of " << expRuns << ".");
+    }
+    BOOST_CHECK_MESSAGE( pool.getNThreads() == 3,
+                         "Pool threads different from the expected."
+                         << "\nExpected: 3"
+                         << "\nGot: " << pool.getNThreads());
+  }
+
+  // Copies start without threads
+  WorkerPool poolCopy(pool);
+  BOOST_CHECK_MESSAGE( poolCopy.getNThreads() == 0,
+                       "Copied pool started with threads.");
+
+  // The lowest failing worker is reported, and the pool keeps running
+  string exceptionMsg("No exception.");
+  try {
+    pool.run(4, [&](size_t worker) {
+      if ( worker >= 2 ) {
+        throw string("[ERROR] Worker ") + to_string(worker);
+      }
+    });
+  }catch (string exceptionMsgThrown){
+    exceptionMsg = exceptionMsgThrown;
+  }
+  string expectedThrownMsg("[ERROR] Worker 2");
+  BOOST_CHECK_MESSAGE( exceptionMsg == expectedThrownMsg,
+                       "Exception message from pool workers"
+                       << " different from the expected."
+                       << "\nExpected: " << expectedThrownMsg
+                       << "\nGot: " << exceptionMsg);
+
+  nRuns.assign(4, 0);
+  pool.run(4, [&](size_t worker) { ++nRuns[worker]; });
+  BOOST_CHECK_MESSAGE( nRuns == vector<size_t>(4, 1),
+                       "Pool workers did not all run after a failure.");
+}
+
+BOOST_AUTO_TEST_CASE( checkWorkerPool_perfStats )
+{
+  // Every job counts, the one on the calling thread the longest - the pool
+  //  threads counters add up in the caller without losing any of its own
+  const size_t nRuns = 100;
+  const size_t nWorkers = 4;
+  const size_t nCounts = 1000;
+  const size_t nCallerCounts = 100 * nCounts;
+  WorkerPool pool;
+  setPerfStatsEnabled(true);
+  PerfStatsCollection collection;
+  for (size_t runID = 0; runID < nRuns; ++runID) {
+    pool.run(nWorkers, [&](size_t worker) {
+      size_t nJobCounts = (worker == 0) ? nCallerCounts : nCounts;
+      for (size_t count = 0; count < nJobCounts; ++count) {
+        COUNT_PERF(rawCellCurrentLookups, 1);
+      }
+    });
+  }
+  setPerfStatsEnabled(false);
+
+  const PerfStats& stats = collection.collected();
+  size_t expCounts = nRuns * (nCallerCounts + (nWorkers - 1) * nCounts);
+  BOOST_CHECK_MESSAGE( stats.rawCellCurrentLookups == expCounts,
+                       "Counters of the pool jobs lost!"
+                       << "\nExpected: " << expCounts
+                       << "\nGot: " << stats.rawCellCurrentLookups );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // WORKERPOOLTEST_CPP
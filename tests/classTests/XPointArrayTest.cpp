@@ -291,13 +291,13 @@ BOOST_AUTO_TEST_CASE( checkXPointArray_Setters_and_Getters_Values )
   myXPointArray.setNRows( expDouble );
 
   expDouble++;
-  myXPointArray.setWLMetalWidth( expDouble * rrs::nanometers, forced );
+  myXPointArray.setWLMetalWidth( expDouble * rrs::meters, forced );
 
   expDouble++;
-  myXPointArray.setBLMetalWidth( expDouble * rrs::nanometers, forced );
+  myXPointArray.setBLMetalWidth( expDouble * rrs::meters, forced );
 
   expDouble++;
-  myXPointArray.setArea( expDouble*rrs::square_nanometers, forced );
+  myXPointArray.setArea( expDouble*rrs::square_meters, forced );
 
   expDouble = 1;
   BOOST_CHECK_MESSAGE( myXPointArray.getNCols()
@@ -317,26 +317,26 @@ BOOST_AUTO_TEST_CASE( checkXPointArray_Setters_and_Getters_Values )
 
   expDouble++;
   BOOST_CHECK_MESSAGE( myXPointArray.getWLMetalWidth()
-                        == expDouble * rrs::nanometers ,
+                        == expDouble * rrs::meters ,
                        "Wordline metal width"
                        << " was not correctly set."
-                       << "\nExpected: " << expDouble * rrs::nanometers
+                       << "\nExpected: " << expDouble * rrs::meters
                        << "\nGot: " << myXPointArray.getWLMetalWidth());
 
   expDouble++;
   BOOST_CHECK_MESSAGE( myXPointArray.getBLMetalWidth()
-                        == expDouble * rrs::nanometers ,
+                        == expDouble * rrs::meters ,
                        "Bitline metal width"
                        << " was not correctly set."
-                       << "\nExpected: " << expDouble * rrs::nanometers
+                       << "\nExpected: " << expDouble * rrs::meters
                        << "\nGot: " << myXPointArray.getBLMetalWidth());
 
   expDouble++;
   BOOST_CHECK_MESSAGE( myXPointArray.getArea()
-                        == expDouble * rrs::square_nanometers,
+                        == expDouble * rrs::square_meters,
                        "Crosspoint array area"
                        << " was not correctly set."
-                       << "\nExpected: " << expDouble * rrs::square_nanometers
+                       << "\nExpected: " << expDouble * rrs::square_meters
                        << "\nGot: " << myXPointArray.getArea());
 
 }
@@ -392,8 +392,10 @@ BOOST_AUTO_TEST_CASE( checkXPointArray_Setters_and_Getters_Errors )
   exceptionMsg = "No exception.";
   try {
     XPointArray myXPointArray;
-    myXPointArray.tech.setMetalHalfPitch( expDouble * rrs::nanometers );
-    myXPointArray.setWLMetalWidth( expDouble/2. * rrs::nanometers );
+    myXPointArray.tech.setMetalHalfPitch(
+        SCALE_QUANTITY(expDouble * rrs::nanometers, rrs::meter_unit) );
+    myXPointArray.setWLMetalWidth(
+        SCALE_QUANTITY(expDouble/2. * rrs::nanometers, rrs::meter_unit) );
   }catch (string exceptionMsgThrown){
     exceptionMsg = exceptionMsgThrown;
   }
@@ -412,8 +414,10 @@ BOOST_AUTO_TEST_CASE( checkXPointArray_Setters_and_Getters_Errors )
   exceptionMsg = "No exception.";
   try {
     XPointArray myXPointArray;
-    myXPointArray.tech.setMetalHalfPitch( expDouble * rrs::nanometers );
-    myXPointArray.setBLMetalWidth( expDouble/2. * rrs::nanometers );
+    myXPointArray.tech.setMetalHalfPitch(
+        SCALE_QUANTITY(expDouble * rrs::nanometers, rrs::meter_unit) );
+    myXPointArray.setBLMetalWidth(
+        SCALE_QUANTITY(expDouble/2. * rrs::nanometers, rrs::meter_unit) );
   }catch (string exceptionMsgThrown){
     exceptionMsg = exceptionMsgThrown;
   }
@@ -432,15 +436,19 @@ BOOST_AUTO_TEST_CASE( checkXPointArray_Setters_and_Getters_Errors )
   exceptionMsg = "No exception.";
   try {
     XPointArray myXPointArray;
-    myXPointArray.tech.setMetalHalfPitch( expDouble * rrs::nanometers );
+    myXPointArray.tech.setMetalHalfPitch(
+        SCALE_QUANTITY(expDouble * rrs::nanometers, rrs::meter_unit) );
     myXPointArray.setNRows( expDouble );
     myXPointArray.setNCols( expDouble );
-    myXPointArray.setWLMetalWidth( expDouble * rrs::nanometers );
-    myXPointArray.setBLMetalWidth( expDouble * rrs::nanometers );
+    myXPointArray.setWLMetalWidth(
+        SCALE_QUANTITY(expDouble * rrs::nanometers, rrs::meter_unit) );
+    myXPointArray.setBLMetalWidth(
+        SCALE_QUANTITY(expDouble * rrs::nanometers, rrs::meter_unit) );
     myXPointArray.updateHeightwiseCellPitch();
     myXPointArray.updateWidthwiseCellPitch();
     myXPointArray.updateArea();
-    myXPointArray.setArea( expDouble * rrs::square_nanometers );
+    myXPointArray.setArea( SCALE_QUANTITY(expDouble * rrs::square_nanometers,
+                                          rrs::square_meter_unit) );
   }catch (string exceptionMsgThrown){
     exceptionMsg = exceptionMsgThrown;
   }
@@ -535,7 +543,8 @@ BOOST_AUTO_TEST_CASE( checkXPointArray_test_config )
   myXPointArray.updateXPointArray();
 
   expDouble = 40;
-  gotLength = round(myXPointArray.getWLMetalWidth(), 6);
+  gotLength = round(SCALE_QUANTITY(myXPointArray.getWLMetalWidth(),
+                                   rrs::nanometer_unit), 6);
   BOOST_CHECK_MESSAGE( gotLength == expDouble * rrs::nanometers,
                        setprecision(6)
                        << "Wordline metal width"
@@ -544,7 +553,8 @@ BOOST_AUTO_TEST_CASE( checkXPointArray_test_config )
                        << "\nGot: " << gotLength);
 
   expDouble = 40;
-  gotLength = round(myXPointArray.getBLMetalWidth(), 6);
+  gotLength = round(SCALE_QUANTITY(myXPointArray.getBLMetalWidth(),
+                                   rrs::nanometer_unit), 6);
   BOOST_CHECK_MESSAGE( gotLength == expDouble * rrs::nanometers,
                        setprecision(6)
                        << "Bitline metal width"
@@ -553,7 +563,8 @@ BOOST_AUTO_TEST_CASE( checkXPointArray_test_config )
                        << "\nGot: " << gotLength);
 
   expDouble = 80;
-  gotLength = round(myXPointArray.getHeightwiseCellPitch(), 6);
+  gotLength = round(SCALE_QUANTITY(myXPointArray.getHeightwiseCellPitch(),
+                                   rrs::nanometer_unit), 6);
   BOOST_CHECK_MESSAGE( gotLength == expDouble * rrs::nanometers,
                        setprecision(6)
                        << "Heighthwise cell pitch"
@@ -562,7 +573,8 @@ BOOST_AUTO_TEST_CASE( checkXPointArray_test_config )
                        << "\nGot: " << gotLength);
 
   expDouble = 80;
-  gotLength = round(myXPointArray.getWidthwiseCellPitch(), 6);
+  gotLength = round(SCALE_QUANTITY(myXPointArray.getWidthwiseCellPitch(),
+                                   rrs::nanometer_unit), 6);
   BOOST_CHECK_MESSAGE( gotLength == expDouble * rrs::nanometers,
                        setprecision(6)
                        << "Widthwise cell pitch"
@@ -571,7 +583,8 @@ BOOST_AUTO_TEST_CASE( checkXPointArray_test_config )
                        << "\nGot: " << gotLength);
 
   expDouble = 1.34218e10;
-  gotArea = round(myXPointArray.getArea(), 6);
+  gotArea = round(SCALE_QUANTITY(myXPointArray.getArea(),
+                                 rrs::square_nanometer_unit), 6);
   BOOST_CHECK_MESSAGE( gotArea == expDouble * rrs::square_nanometers,
                        setprecision(6)
                        << "Crosspoint array area"
@@ -646,6 +659,217 @@ BOOST_AUTO_TEST_CASE( checkXPointArray_test_config )
 }
 
 
+BOOST_AUTO_TEST_CASE( checkXPointArray_updateGeometry )
+{
+
+  int sim_argc = 3;
+  char* sim_argv[] = {"./executable",
+                      "-conf",
+                      "../../tests/configs/test_config.txt"};
+
+  ArgumentsParser argParser(sim_argc, sim_argv);
+  argParser.runArgParser();
+
+  XPointArray myXPointArray(argParser.configs.at(0));
+
+  double expDouble;
+
+  bu::quantity<rrs::dimensionless> gotDimensionless;
+  bu::quantity<rrs::square_nanometer_unit> gotArea;
+  bu::quantity<rrs::ohm_unit> gotResistance;
+
+  // Same geometry as the full update, but no cell voltage solved
+  myXPointArray.setNCols(2048);
+  myXPointArray.setNRows(1024);
+  myXPointArray.updateGeometry();
+
+  expDouble = 1.34218e10;
+  gotArea = round(SCALE_QUANTITY(myXPointArray.getArea(),
+                                 rrs::square_nanometer_unit), 6);
+  BOOST_CHECK_MESSAGE( gotArea == expDouble * rrs::square_nanometers,
+                       setprecision(6)
+                       << "Crosspoint array area"
+                       << " different from the expected."
+                       << "\nExpected: " << expDouble * rrs::square_nanometers
+                       << "\nGot: " << gotArea);
+
+  expDouble = 1;
+  gotDimensionless = myXPointArray.getAreaEfficiency();
+  BOOST_CHECK_MESSAGE( areEqual(gotDimensionless, expDouble),
+                       "Crosspoint array area efficiency"
+                       << " different from the expected."
+                       << "\nExpected: " << expDouble
+                       << "\nGot: " << gotDimensionless);
+
+  expDouble = 1761.96;
+  gotResistance = round(myXPointArray.getWLWriteDriverResistance(), 6);
+  BOOST_CHECK_MESSAGE( gotResistance == expDouble * rrs::ohms,
+                       setprecision(6)
+                       << "Resistance of wordline driver for write operation"
+                       << " different from the expected."
+                       << "\nExpected: " << expDouble * rrs::ohms
+                       << "\nGot: " << gotResistance);
+
+  BOOST_CHECK_MESSAGE( isInvalid(myXPointArray.selectedCell
+                                 .getCellSetVoltage()),
+                       "Selected cell set voltage solved by the geometry"
+                       << " update."
+                       << "\nGot: "
+                       << myXPointArray.selectedCell.getCellSetVoltage());
+
+  // Periphery does not fit underneath a tiny array
+  myXPointArray.setNCols(2);
+  myXPointArray.setNRows(2);
+  myXPointArray.updateGeometry();
+
+  gotDimensionless = myXPointArray.getAreaEfficiency();
+  BOOST_CHECK_MESSAGE( gotDimensionless < 1.,
+                       "Crosspoint array area efficiency"
+                       << " not smaller than one for a 2 x 2 array."
+                       << "\nGot: " << gotDimensionless);
+
+}
+
+
+BOOST_AUTO_TEST_CASE( checkXPointArray_staged_update )
+{
+
+  int sim_argc = 3;
+  char* sim_argv[] = {"./executable",
+                      "-conf",
+                      "../../tests/configs/test_config.txt"};
+
+  ArgumentsParser argParser(sim_argc, sim_argv);
+  argParser.runArgParser();
+
+  XPointArray fullXPointArray(argParser.configs.at(0));
+  fullXPointArray.setNCols(512);
+  fullXPointArray.setNRows(256);
+  fullXPointArray.updateXPointArray();
+
+  XPointArray stagedXPointArray(argParser.configs.at(0));
+  stagedXPointArray.setNCols(512);
+  stagedXPointArray.setNRows(256);
+  stagedXPointArray.updateGeometry();
+  stagedXPointArray.updateDelays();
+
+  // Bounds known before the solves never exceed the solved values
+  auto minWriteTime = stagedXPointArray.getMinWriteTime();
+  auto minWriteEnergy = stagedXPointArray.getMinWriteEnergy();
+  BOOST_CHECK_MESSAGE( minWriteTime <= fullXPointArray.getWriteTime(),
+                       "Write time lower bound greater than the write time."
+                       << "\nBound: " << minWriteTime
+                       << "\nGot: " << fullXPointArray.getWriteTime());
+  BOOST_CHECK_MESSAGE( minWriteEnergy <= fullXPointArray.getWriteEnergy(),
+                       "Write energy lower bound greater than the write"
+                       << " energy."
+                       << "\nBound: " << minWriteEnergy
+                       << "\nGot: " << fullXPointArray.getWriteEnergy());
+
+  // Write figures are final after the write stage
+  stagedXPointArray.updateWriteOperation();
+  BOOST_CHECK_MESSAGE( stagedXPointArray.getWriteTime()
+                       == fullXPointArray.getWriteTime(),
+                       "Write time after the write stage"
+                       << " different from the full update."
+                       << "\nExpected: " << fullXPointArray.getWriteTime()
+                       << "\nGot: " << stagedXPointArray.getWriteTime());
+  BOOST_CHECK_MESSAGE( stagedXPointArray.getWriteEnergy()
+                       == fullXPointArray.getWriteEnergy(),
+                       "Write energy after the write stage"
+                       << " different from the full update."
+                       << "\nExpected: " << fullXPointArray.getWriteEnergy()
+                       << "\nGot: " << stagedXPointArray.getWriteEnergy());
+
+  stagedXPointArray.updateReadOperation();
+  BOOST_CHECK_MESSAGE( stagedXPointArray.getReadVoltage()
+                       == fullXPointArray.getReadVoltage(),
+                       "Read voltage after the read stage"
+                       << " different from the full update."
+                       << "\nExpected: " << fullXPointArray.getReadVoltage()
+                       << "\nGot: " << stagedXPointArray.getReadVoltage());
+
+}
+
+
+BOOST_AUTO_TEST_CASE( checkXPointArray_third_bias_leakage )
+{
+
+  int sim_argc = 3;
+  char* sim_argv[] = {"./executable",
+                      "-conf",
+                      "../../tests/configs/test_config.txt"};
+
+  ArgumentsParser argParser(sim_argc, sim_argv);
+  argParser.runArgParser();
+
+  // V/2 leaves no voltage across the unselected cells
+  XPointArray halfXPointArray(argParser.configs.at(0));
+  halfXPointArray.setNCols(1024);
+  halfXPointArray.setNRows(1024);
+  halfXPointArray.updateXPointArray();
+  BOOST_CHECK_MESSAGE( halfXPointArray.getSetUCCurrent().value() == 0.,
+                       "V/2 unselected cells current not zero."
+                       << "\nGot: " << halfXPointArray.getSetUCCurrent());
+
+  // V/3 unselected cells leak, so the energies grow with the array area
+  XPointArray smallXPointArray(argParser.configs.at(0));
+  smallXPointArray.setBiasScheme("V/3");
+  smallXPointArray.setNCols(1024);
+  smallXPointArray.setNRows(1024);
+  smallXPointArray.updateXPointArray();
+
+  XPointArray largeXPointArray(argParser.configs.at(0));
+  largeXPointArray.setBiasScheme("V/3");
+  largeXPointArray.setNCols(2048);
+  largeXPointArray.setNRows(2048);
+  largeXPointArray.updateGeometry();
+  largeXPointArray.updateDelays();
+  auto minWriteEnergy = largeXPointArray.getMinWriteEnergy();
+  largeXPointArray.updateWriteOperation();
+  largeXPointArray.updateReadOperation();
+
+  BOOST_CHECK_MESSAGE( largeXPointArray.getSetUCCurrent()
+                       > smallXPointArray.getSetUCCurrent(),
+                       "V/3 unselected cells current not growing with the"
+                       << " array area."
+                       << "\n1024 x 1024: "
+                       << smallXPointArray.getSetUCCurrent()
+                       << "\n2048 x 2048: "
+                       << largeXPointArray.getSetUCCurrent());
+  BOOST_CHECK_MESSAGE( largeXPointArray.getWriteEnergy()
+                       > smallXPointArray.getWriteEnergy(),
+                       "V/3 write energy not growing with the array area."
+                       << "\n1024 x 1024: "
+                       << smallXPointArray.getWriteEnergy()
+                       << "\n2048 x 2048: "
+                       << largeXPointArray.getWriteEnergy());
+  BOOST_CHECK_MESSAGE( largeXPointArray.getReadEnergy()
+                       > smallXPointArray.getReadEnergy(),
+                       "V/3 read energy not growing with the array area."
+                       << "\n1024 x 1024: "
+                       << smallXPointArray.getReadEnergy()
+                       << "\n2048 x 2048: "
+                       << largeXPointArray.getReadEnergy());
+
+  // The leakage is part of the write energy bound
+  BOOST_CHECK_MESSAGE( minWriteEnergy <= largeXPointArray.getWriteEnergy(),
+                       "V/3 write energy lower bound greater than the write"
+                       << " energy."
+                       << "\nBound: " << minWriteEnergy
+                       << "\nGot: " << largeXPointArray.getWriteEnergy());
+
+  // A million cells leaking a third of the write voltage outweigh the V/2
+  //  half selected cells
+  BOOST_CHECK_MESSAGE( smallXPointArray.getWriteEnergy()
+                       > halfXPointArray.getWriteEnergy(),
+                       "V/3 write energy not greater than the V/2 one."
+                       << "\nV/2: " << halfXPointArray.getWriteEnergy()
+                       << "\nV/3: " << smallXPointArray.getWriteEnergy());
+
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif // XPOINTARRAYTEST_CPP
@@ -38,10 +38,21 @@
 
 #include "classTests/FunctionsTest.cpp"
 #include "classTests/ParamTest.cpp"
+#include "classTests/ResultCacheTest.cpp"
+#include "classTests/PerfStatsTest.cpp"
+#include "classTests/TraceTest.cpp"
+#include "classTests/SolverGuardTest.cpp"
+#include "classTests/WorkerPoolTest.cpp"
 
 #include "classTests/ArgumentsParserTest.cpp"
 #include "classTests/JsonAssistTest.cpp"
 
 #include "classTests/CellTest.cpp"
+#include "classTests/LineSolverTest.cpp"
+#include "classTests/ArraySolverTest.cpp"
 #include "classTests/TechnologyTest.cpp"
 #include "classTests/XPointArrayTest.cpp"
+#include "classTests/BankTest.cpp"
+#include "classTests/RramSpecLibTest.cpp"
+#include "classTests/ResultWriterTest.cpp"
+#include "classTests/RramServerTest.cpp"
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+#include "PerfStats.h"
+
+std::atomic<bool> perfStatsSwitch(false);
+
+PerfStats&
+PerfStats::operator+=(const PerfStats& other)
+{
+  selectedCellSolves += other.selectedCellSolves;
+  selectedCellIterations += other.selectedCellIterations;
+  edgeSolves += other.edgeSolves;
+  edgeIterations += other.edgeIterations;
+  solverIterations += other.solverIterations;
+  solverRelaxations += other.solverRelaxations;
+  solverFailures += other.solverFailures;
+  acceleratedSolves += other.acceleratedSolves;
+  acceleratedIterations += other.acceleratedIterations;
+
+  cellCurrentLookups += other.cellCurrentLookups;
+  rawCellCurrentLookups += other.rawCellCurrentLookups;
+  cellCurrentEvaluations += other.cellCurrentEvaluations;
+
+  cellIxVBuilds += other.cellIxVBuilds;
+  cellIxVCacheHits += other.cellIxVCacheHits;
+  cellIxVPoints += other.cellIxVPoints;
+  cellIxVBuildSeconds += other.cellIxVBuildSeconds;
+
+  readVoltageSearches += other.readVoltageSearches;
+  readVoltageIterations += other.readVoltageIterations;
+
+  arrayUpdates += other.arrayUpdates;
+  geometrySeconds += other.geometrySeconds;
+  delaysSeconds += other.delaysSeconds;
+  writeOperationSeconds += other.writeOperationSeconds;
+  readOperationSeconds += other.readOperationSeconds;
+
+  return *this;
+}
+
+namespace {
+
+// Ratio of the counters, 0 when nothing was divided
+double perCall(uint64_t total, uint64_t calls)
+{
+  return calls == 0 ? 0. : double(total) / double(calls);
+}
+
+}
+
+// Very specific macros to be used in the field list below
+#define PERF_COUNT_FIELD(name, counter) \
+  { name, [](const PerfStats& stats) { return double(stats.counter); } }
+
+#define PERF_RATIO_FIELD(name, total, calls) \
+  { name, [](const PerfStats& stats) \
+          { return perCall(stats.total, stats.calls); } }
+
+#define PERF_TIME_FIELD(name, seconds) \
+  { name, [](const PerfStats& stats) { return 1e3 * stats.seconds; } }
+
+const std::vector<PerfStatsField>&
+perfStatsFields()
+{
+  static const std::vector<PerfStatsField> fields = {
+    PERF_COUNT_FIELD("Selected cell solves []", selectedCellSolves),
+    PERF_RATIO_FIELD("Iterations per selected cell solve []",
+                     selectedCellIterations, selectedCellSolves),
+    PERF_COUNT_FIELD("Edge solves []", edgeSolves),
+    PERF_RATIO_FIELD("Iterations per edge solve []",
+                     edgeIterations, edgeSolves),
+    PERF_COUNT_FIELD("Solver under-relaxations []", solverRelaxations),
+    PERF_COUNT_FIELD("Failed solves []", solverFailures),
+    PERF_COUNT_FIELD("Accelerated solves []", acceleratedSolves),
+    PERF_RATIO_FIELD("Iterations per accelerated solve []",
+                     acceleratedIterations, acceleratedSolves),
+
+    PERF_COUNT_FIELD("Cell current lookups []", cellCurrentLookups),
+    PERF_COUNT_FIELD("Raw cell current lookups []", rawCellCurrentLookups),
+    PERF_COUNT_FIELD("Cell current evaluations []", cellCurrentEvaluations),
+
+    PERF_COUNT_FIELD("Cell I-V table builds []", cellIxVBuilds),
+    PERF_COUNT_FIELD("Cell I-V table cache hits []", cellIxVCacheHits),
+    PERF_RATIO_FIELD("Points per cell I-V table build []",
+                     cellIxVPoints, cellIxVBuilds),
+    PERF_TIME_FIELD("Cell I-V table build time [ms]", cellIxVBuildSeconds),
+
+    PERF_COUNT_FIELD("Read voltage searches []", readVoltageSearches),
+    PERF_RATIO_FIELD("Iterations per read voltage search []",
+                     readVoltageIterations, readVoltageSearches),
+
+    PERF_COUNT_FIELD("Array updates []", arrayUpdates),
+    PERF_TIME_FIELD("Geometry update time [ms]", geometrySeconds),
+    PERF_TIME_FIELD("Delays update time [ms]", delaysSeconds),
+    PERF_TIME_FIELD("Write operation update time [ms]",
+                    writeOperationSeconds),
+    PERF_TIME_FIELD("Read operation update time [ms]",
+                    readOperationSeconds)
+  };
+  return fields;
+}
+
+void setPerfStatsEnabled(bool enabled)
+{
+  perfStatsSwitch.store(enabled, std::memory_order_relaxed);
+}
+
+PerfStatsCollection::PerfStatsCollection()
+{
+  previousStats = threadPerfStats();
+  threadPerfStats() = PerfStats();
+}
+
+PerfStatsCollection::~PerfStatsCollection()
+{
+  threadPerfStats() += previousStats;
+}
+
+const PerfStats&
+PerfStatsCollection::collected() const
+{
+  return threadPerfStats();
+}
+
+PerfTimer::PerfTimer(double PerfStats::*seconds_)
+  : seconds(seconds_)
+{
+  // The clock is only read when counting
+  enabled = perfStatsEnabled();
+  if ( enabled ) {
+    start = std::chrono::steady_clock::now();
+  }
+}
+
+PerfTimer::~PerfTimer()
+{
+  if ( enabled ) {
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    threadPerfStats().*seconds += elapsed.count();
+  }
+}
+
+PerfSolveCounter::PerfSolveCounter(uint64_t PerfStats::*solves_,
+                                   uint64_t PerfStats::*iterations_)
+  : solves(solves_), iterations(iterations_)
+{
+  enabled = perfStatsEnabled();
+  firstIteration = threadPerfStats().solverIterations;
+}
+
+PerfSolveCounter::~PerfSolveCounter()
+{
+  if ( enabled ) {
+    PerfStats& stats = threadPerfStats();
+    ++(stats.*solves);
+    stats.*iterations += stats.solverIterations - firstIteration;
+  }
+}
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+#ifndef PERFSTATS_H
+#define PERFSTATS_H
+
+/* Performance counters of the model hot paths: solver calls and
+ * iterations, cell current evaluations, cell I-V table builds, read
+ * voltage searches and the time of each array update phase.
+ * Each thread counts into its own counters, with no lock or atomic, and
+ * the counters of the worker threads are added to the ones of the thread
+ * that started them when they finish. Nothing is counted unless enabled
+ * at run time, and the counting is compiled out with RRAMSPEC_STATS=0.
+ * Times are summed over threads, so they exceed the wall time of a run
+ * whose phases ran in parallel.
+*/
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Counting compiled in - disabled at run time unless asked for
+#ifndef RRAMSPEC_STATS
+#define RRAMSPEC_STATS 1
+#endif
+
+struct PerfStats {
+  // Array solves - calcVSelectedCell and calcVEdge calls, and the solver
+  //  iterations they took
+  uint64_t selectedCellSolves;
+  uint64_t selectedCellIterations;
+  uint64_t edgeSolves;
+  uint64_t edgeIterations;
+  // Running count of the solver iterations, charged to the solve running
+  //  them by PerfSolveCounter - counted unconditionally, as a check would
+  //  cost as much
+  uint64_t solverIterations;
+  // Solves under-relaxed once their error stalled, counted per halving of
+  //  the relaxation factor, and solves failed on a limit or diverging
+  uint64_t solverRelaxations;
+  uint64_t solverFailures;
+  // Line solves accelerated by SOR or Anderson mixing and their iterations
+  //  The saving is not counted - it takes the iterations per solve of a
+  //  separate unaccelerated run
+  uint64_t acceleratedSolves;
+  uint64_t acceleratedIterations;
+
+  // Cell current evaluations - interpolated from the I-V tables, through
+  //  the model quantities (getCellCurrent) or the raw solver lookups, and
+  //  computed from the cell model (calcCellCurrent)
+  uint64_t cellCurrentLookups;
+  uint64_t rawCellCurrentLookups;
+  uint64_t cellCurrentEvaluations;
+
+  // Cell I-V tables - built or taken from the cache, points of the built
+  //  ones and the time spent building them
+  uint64_t cellIxVBuilds;
+  uint64_t cellIxVCacheHits;
+  uint64_t cellIxVPoints;
+  double cellIxVBuildSeconds;
+
+  // Read voltage searches and their iterations
+  uint64_t readVoltageSearches;
+  uint64_t readVoltageIterations;
+
+  // Array updates and the time of each of their phases
+  uint64_t arrayUpdates;
+  double geometrySeconds;
+  double delaysSeconds;
+  double writeOperationSeconds;
+  double readOperationSeconds;
+
+  PerfStats& operator+=(const PerfStats& other);
+};
+
+// Counter of the stats, written under its name with its unit
+struct PerfStatsField {
+  const char* name;
+  double (*value)(const PerfStats&);
+};
+const std::vector<PerfStatsField>& perfStatsFields();
+
+// Whether the counters are updated, for the whole process - off by default
+//  Checked inline, as it guards the hottest paths
+extern std::atomic<bool> perfStatsSwitch;
+inline bool perfStatsEnabled()
+{
+  return perfStatsSwitch.load(std::memory_order_relaxed);
+}
+void setPerfStatsEnabled(bool enabled);
+
+// Counters of the calling thread. Plain data, so the thread local needs
+//  no guard on access
+inline PerfStats& threadPerfStats()
+{
+  static thread_local PerfStats stats;
+  return stats;
+}
+
+// Collects the counters of the calling thread while in scope, starting
+//  from zero. They are added back to the counters before it on exit, so
+//  collections nest
+class PerfStatsCollection
+{
+public:
+  PerfStatsCollection();
+  ~PerfStatsCollection();
+  PerfStatsCollection(const PerfStatsCollection&) = delete;
+  PerfStatsCollection& operator=(const PerfStatsCollection&) = delete;
+
+  // Counted so far in the scope
+  const PerfStats& collected() const;
+
+private:
+  PerfStats previousStats;
+};
+
+// Adds the time spent in its scope to the counter
+class PerfTimer
+{
+public:
+  explicit PerfTimer(double PerfStats::*seconds);
+  ~PerfTimer();
+  PerfTimer(const PerfTimer&) = delete;
+  PerfTimer& operator=(const PerfTimer&) = delete;
+
+private:
+  double PerfStats::*seconds;
+  bool enabled;
+  std::chrono::steady_clock::time_point start;
+};
+
+// Counts a solve and the solver iterations counted in its scope
+class PerfSolveCounter
+{
+public:
+  PerfSolveCounter(uint64_t PerfStats::*solves,
+                   uint64_t PerfStats::*iterations);
+  ~PerfSolveCounter();
+  PerfSolveCounter(const PerfSolveCounter&) = delete;
+  PerfSolveCounter& operator=(const PerfSolveCounter&) = delete;
+
+private:
+  uint64_t PerfStats::*solves;
+  uint64_t PerfStats::*iterations;
+  bool enabled;
+  uint64_t firstIteration;
+};
+
+#define PERF_CONCAT_IMPL(first, second) first##second
+#define PERF_CONCAT(first, second) PERF_CONCAT_IMPL(first, second)
+
+#if RRAMSPEC_STATS
+#define COUNT_PERF(counter, n) \
+    do{ if ( perfStatsEnabled() ) { \
+          threadPerfStats().counter += (n); } } while(false)
+#define COUNT_SOLVER_ITERATION() \
+    do{ ++threadPerfStats().solverIterations; } while(false)
+#define COUNT_PERF_SOLVE(solves, iterations) \
+    PerfSolveCounter PERF_CONCAT(perfSolveCounter, __LINE__)( \
+        &PerfStats::solves, &PerfStats::iterations)
+#define TIME_PERF(seconds) \
+    PerfTimer PERF_CONCAT(perfTimer, __LINE__)(&PerfStats::seconds)
+#else
+#define COUNT_PERF(counter, n) do{ } while(false)
+#define COUNT_SOLVER_ITERATION() do{ } while(false)
+#define COUNT_PERF_SOLVE(solves, iterations) do{ } while(false)
+#define TIME_PERF(seconds) do{ } while(false)
+#endif
+
+#endif // PERFSTATS_H
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+#include "ResultCache.h"
+
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+// First bytes of every cache file
+struct FileHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t recordSize;
+};
+
+const char cacheMagic[8] = {'R','R','S','P','C','A','C','H'};
+
+// Holds the file lock for the lifetime of the scope
+class FileLock
+{
+public:
+  FileLock(int fileDescriptor_, int operation) :
+    fileDescriptor(fileDescriptor_)
+  {
+    locked = ( flock(fileDescriptor, operation) == 0 );
+  }
+  ~FileLock()
+  {
+    if ( locked ) {
+      flock(fileDescriptor, LOCK_UN);
+    }
+  }
+  bool locked;
+private:
+  int fileDescriptor;
+};
+
+}
+
+ResultCache::ResultCache(const string& fileName_)
+{
+  fileName = fileName_;
+  mappedFile = nullptr;
+  mappedSize = 0;
+  indexedSize = sizeof(FileHeader);
+
+  fileDescriptor = open(fileName.c_str(), O_RDWR | O_CREAT | O_APPEND, 0644);
+  if ( fileDescriptor < 0 ) {
+    throwFileError("open");
+  }
+
+  FileHeader expectedHeader;
+  memcpy(expectedHeader.magic, cacheMagic, sizeof(cacheMagic));
+  expectedHeader.version = RESULT_CACHE_VERSION;
+  expectedHeader.recordSize = sizeof(Record);
+
+  bool isCacheFile = false;
+  {
+    FileLock lock(fileDescriptor, LOCK_EX);
+    struct stat fileStatus;
+    if ( !lock.locked || fstat(fileDescriptor, &fileStatus) != 0 ) {
+      int lockErrno = errno;
+      close(fileDescriptor);
+      errno = lockErrno;
+      throwFileError("lock");
+    }
+
+    if ( fileStatus.st_size == 0 ) {
+      isCacheFile = ( write(fileDescriptor, &expectedHeader,
+                            sizeof(FileHeader)) == sizeof(FileHeader) );
+    }
+    else {
+      FileHeader header;
+      isCacheFile = ( pread(fileDescriptor, &header, sizeof(FileHeader), 0)
+                      == sizeof(FileHeader) )
+                    && memcmp(&header, &expectedHeader,
+                              sizeof(FileHeader)) == 0;
+    }
+  }
+
+  if ( !isCacheFile ) {
+    close(fileDescriptor);
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("File ");
+    exceptionMsgThrown.append(fileName);
+    exceptionMsgThrown.append(" is not a result cache of this RRAMSpec");
+    exceptionMsgThrown.append(" version. Remove it or choose another");
+    exceptionMsgThrown.append(" result cache file.\n");
+    throw exceptionMsgThrown;
+  }
+}
+
+ResultCache::~ResultCache()
+{
+  if ( mappedFile != nullptr ) {
+    munmap(const_cast<char*>(mappedFile), mappedSize);
+  }
+  close(fileDescriptor);
+}
+
+bool
+ResultCache::find(uint64_t key, Record& record)
+{
+  lock_guard<mutex> guard(cacheMutex);
+  update();
+
+  auto recordOffset = recordOffsets.find(key);
+  if ( recordOffset == recordOffsets.end() ) {
+    return false;
+  }
+  memcpy(&record, mappedFile + recordOffset->second, sizeof(Record));
+  return true;
+}
+
+void
+ResultCache::store(const Record& record)
+{
+  lock_guard<mutex> guard(cacheMutex);
+  FileLock lock(fileDescriptor, LOCK_EX);
+  if ( !lock.locked ) {
+    throwFileError("lock");
+  }
+  // A single append, so other processes see either all or none of it
+  if ( write(fileDescriptor, &record, sizeof(Record)) != sizeof(Record) ) {
+    throwFileError("write to");
+  }
+}
+
+const string&
+ResultCache::getFileName() const
+{
+  return fileName;
+}
+
+void
+ResultCache::update()
+{
+  struct stat fileStatus;
+  {
+    // Writers append whole records under the exclusive lock
+    FileLock lock(fileDescriptor, LOCK_SH);
+    if ( !lock.locked || fstat(fileDescriptor, &fileStatus) != 0 ) {
+      throwFileError("lock");
+    }
+  }
+
+  size_t fileSize = size_t(fileStatus.st_size);
+  if ( fileSize > mappedSize ) {
+    if ( mappedFile != nullptr ) {
+      munmap(const_cast<char*>(mappedFile), mappedSize);
+      mappedFile = nullptr;
+      mappedSize = 0;
+    }
+    void* mapping = mmap(nullptr, fileSize, PROT_READ, MAP_SHARED,
+                         fileDescriptor, 0);
+    if ( mapping == MAP_FAILED ) {
+      throwFileError("map");
+    }
+    mappedFile = static_cast<const char*>(mapping);
+    mappedSize = fileSize;
+  }
+
+  while ( indexedSize + sizeof(Record) <= mappedSize ) {
+    uint64_t key;
+    memcpy(&key, mappedFile + indexedSize, sizeof(key));
+    recordOffsets[key] = indexedSize;
+    indexedSize += sizeof(Record);
+  }
+}
+
+void
+ResultCache::throwFileError(const string& action) const
+{
+  string exceptionMsgThrown("[ERROR] ");
+  exceptionMsgThrown.append("Could not ");
+  exceptionMsgThrown.append(action);
+  exceptionMsgThrown.append(" the result cache file ");
+  exceptionMsgThrown.append(fileName);
+  exceptionMsgThrown.append(": ");
+  exceptionMsgThrown.append(strerror(errno));
+  exceptionMsgThrown.append("\n");
+  throw exceptionMsgThrown;
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+#ifndef RESULTCACHE_H
+#define RESULTCACHE_H
+
+/* Persistent store of solver results, shared by runs and processes.
+ * Results are records of a fixed number of doubles under a 64-bit key,
+ * a hash of every input of the solve they hold. The file is only ever
+ * appended to: new records are written under an exclusive file lock, and
+ * read back through a shared memory map of the file, re-mapped as it
+ * grows. The latest record of a key supersedes the earlier ones.
+*/
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+using namespace std;
+
+// Bumped on every change that alters a cached result, so stale records
+//  no longer match any key
+#define RESULT_CACHE_VERSION 3
+
+class ResultCache
+{
+public:
+  static const size_t nRecordValues = 16;
+
+  struct Record {
+    uint64_t key;
+    // Bit mask of the stages of the solve holding results
+    uint64_t stages;
+    double values[nRecordValues];
+  };
+
+  ResultCache(const string& fileName);
+  ~ResultCache();
+
+  // Copies the latest record of the key, if there is one
+  bool find(uint64_t key, Record& record);
+  void store(const Record& record);
+
+  const string& getFileName() const;
+
+private:
+  string fileName;
+  int fileDescriptor;
+
+  const char* mappedFile;
+  size_t mappedSize;
+  // Offsets of the latest record of each key
+  unordered_map<uint64_t, size_t> recordOffsets;
+  size_t indexedSize;
+
+  // Guards the map and the index against the threads of this process -
+  //  the file lock guards the file against other processes
+  mutex cacheMutex;
+
+  // Maps the records appended since the last call, by any process
+  void update();
+
+  void throwFileError(const string& action) const;
+
+  // Invalid constructors
+  ResultCache(const ResultCache&);
+  ResultCache& operator=(const ResultCache&);
+};
+
+#endif // RESULTCACHE_H
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+#include "SolverGuard.h"
+
+#include <cmath>
+#include <limits>
+
+#include "PerfStats.h"
+
+SolverGuard::SolverGuard(const SolverLimits& limits, const char* solverName)
+  : limits(limits), solverName(solverName)
+{
+  if ( limits.maxSeconds > 0. ) {
+    start = std::chrono::steady_clock::now();
+  }
+  iteration = 0;
+  relaxation = 1.;
+  minError = std::numeric_limits<double>::infinity();
+  minErrorIteration = 0;
+}
+
+void
+SolverGuard::startIteration()
+{
+  if ( iteration >= limits.maxIterations ) {
+    fail("did not converge after " + std::to_string(iteration)
+         + " iterations");
+  }
+  if ( limits.maxSeconds > 0. ) {
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    if ( elapsed.count() > limits.maxSeconds ) {
+      fail("did not converge within " + std::to_string(limits.maxSeconds)
+           + " s (" + std::to_string(iteration) + " iterations)");
+    }
+  }
+  ++iteration;
+}
+
+void
+SolverGuard::checkError(double relError)
+{
+  double absError = std::abs(relError);
+  checkFinite(absError);
+
+  if ( absError < minError ) {
+    minError = absError;
+    minErrorIteration = iteration;
+    return;
+  }
+  if ( iteration - minErrorIteration < SOLVER_STALL_ITERATIONS ) {
+    return;
+  }
+
+  // Oscillating or diverging - slow the steps down, and give the solve
+  //  as many iterations again to get below its current error
+  relaxation /= 2.;
+  minError = absError;
+  minErrorIteration = iteration;
+  COUNT_PERF(solverRelaxations, 1);
+  if ( relaxation < SOLVER_MIN_RELAXATION ) {
+    fail("diverged after " + std::to_string(iteration)
+         + " iterations, even under-relaxed");
+  }
+}
+
+void
+SolverGuard::checkFinite(double relError)
+{
+  if ( !std::isfinite(relError) ) {
+    fail("diverged after " + std::to_string(iteration) + " iterations");
+  }
+}
+
+double
+SolverGuard::getRelaxation() const
+{
+  return relaxation;
+}
+
+size_t
+SolverGuard::getIteration() const
+{
+  return iteration;
+}
+
+void
+SolverGuard::fail(const std::string& reason) const
+{
+  COUNT_PERF(solverFailures, 1);
+  std::string exceptionMsgThrown("[ERROR] ");
+  exceptionMsgThrown.append(solverName);
+  exceptionMsgThrown.append(" ");
+  exceptionMsgThrown.append(reason);
+  exceptionMsgThrown.append(".\n");
+  throw exceptionMsgThrown;
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+#ifndef SOLVERGUARD_H
+#define SOLVERGUARD_H
+
+/* Bounds of the iterative solves of the model. Each solve is given a
+ * limit of iterations and, optionally, of time; a solve reaching either
+ * fails by throwing the [ERROR] message string, so a sweep point that
+ * never converges is reported and skipped instead of stalling the run.
+ * The error of the fixed-point iterations is watched as well: once it
+ * stops reaching new lows - the iterations oscillate or diverge - the
+ * solve is under-relaxed, halving its relaxation factor each time.
+*/
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <string>
+
+struct SolverLimits {
+  // Iterations of a single solve
+  size_t maxIterations = 100000;
+  // Wall time of a single solve [s] - 0 for no limit
+  double maxSeconds = 0.;
+};
+
+// Iterations a solve may go without a new smallest error before it is
+//  under-relaxed
+#define SOLVER_STALL_ITERATIONS 25
+
+// Relaxation factor below which a solve is taken as diverging
+#define SOLVER_MIN_RELAXATION 1e-6
+
+// Watches the iterations of one solve, named by a string literal for the
+//  failure messages
+class SolverGuard
+{
+public:
+  SolverGuard(const SolverLimits& limits, const char* solverName);
+
+  // Call at the start of each iteration - throws once a limit is reached
+  void startIteration();
+  // Relative error of the iteration just run. Under-relaxes the solve
+  //  when the error stalls, and throws when it is not finite or the
+  //  relaxation gets too small
+  void checkError(double relError);
+  // Error of an iteration of a solve that is never relaxed - Newton steps,
+  //  conjugate gradients. Only throws when it is not finite
+  void checkFinite(double relError);
+
+  // Fraction of each fixed-point step to take - 1 until under-relaxed
+  double getRelaxation() const;
+  size_t getIteration() const;
+
+private:
+  const SolverLimits& limits;
+  const char* solverName;
+  std::chrono::steady_clock::time_point start;
+
+  size_t iteration;
+  double relaxation;
+  double minError;
+  size_t minErrorIteration;
+
+  void fail(const std::string& reason) const;
+};
+
+// Moves from last towards next by the relaxation factor - exactly next
+//  when not relaxed
+inline double relaxedUpdate(double last, double next, double relaxation)
+{
+  return relaxation == 1. ? next : last + relaxation * (next - last);
+}
+
+// Largest magnitude so far, NaN once any value is - std::max would skip
+//  it, so an update gone NaN could pass for a converged one
+inline double maxMagnitude(double maxSoFar, double value)
+{
+  double magnitude = std::abs(value);
+  return (magnitude > maxSoFar || magnitude != magnitude) ?
+         magnitude : maxSoFar;
+}
+
+#endif // SOLVERGUARD_H
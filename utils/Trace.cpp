@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+#include "Trace.h"
+#include "functions.h"
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+std::atomic<bool> traceSwitch(false);
+
+namespace {
+
+struct TraceEvent {
+  const char* name;
+  std::string detail;
+  // Microseconds since the trace was enabled
+  double start;
+  double duration;
+  uint64_t iterations;
+};
+
+// Ring of the events of a thread - written by that thread only
+struct TraceBuffer {
+  size_t threadID;
+  std::vector<TraceEvent> events;
+  // Slot of the next event once the ring is full
+  size_t next;
+  uint64_t nRecorded;
+};
+
+// Every buffer ever used, and the ones whose thread finished
+std::mutex traceMutex;
+std::vector<std::unique_ptr<TraceBuffer>> traceBuffers;
+std::vector<TraceBuffer*> freeTraceBuffers;
+std::chrono::steady_clock::time_point traceEpoch;
+
+// Plain pointer, so the thread local needs no guard on access
+thread_local TraceBuffer* threadTraceBuffer = nullptr;
+
+// Hands the buffer of the thread over to the next new thread when the
+//  thread finishes
+struct TraceBufferRelease {
+  ~TraceBufferRelease()
+  {
+    std::lock_guard<std::mutex> lock(traceMutex);
+    freeTraceBuffers.push_back(threadTraceBuffer);
+  }
+};
+
+TraceBuffer& traceBuffer()
+{
+  if ( threadTraceBuffer == nullptr ) {
+    {
+      std::lock_guard<std::mutex> lock(traceMutex);
+      if ( !freeTraceBuffers.empty() ) {
+        threadTraceBuffer = freeTraceBuffers.back();
+        freeTraceBuffers.pop_back();
+      }
+      else {
+        traceBuffers.emplace_back(new TraceBuffer());
+        threadTraceBuffer = traceBuffers.back().get();
+        threadTraceBuffer->threadID = traceBuffers.size();
+        threadTraceBuffer->next = 0;
+        threadTraceBuffer->nRecorded = 0;
+      }
+    }
+    static thread_local TraceBufferRelease release;
+    (void) release;
+  }
+  return *threadTraceBuffer;
+}
+
+double traceTime()
+{
+  return std::chrono::duration<double, std::micro>(
+           std::chrono::steady_clock::now() - traceEpoch).count();
+}
+
+// JSON string of the text - names and details are plain ASCII
+std::string traceString(const std::string& text)
+{
+  std::string quoted("\"");
+  for (char character : text) {
+    if ( character == '"' || character == '\\' ) {
+      quoted.push_back('\\');
+    }
+    if ( (unsigned char) character >= 0x20 ) {
+      quoted.push_back(character);
+    }
+  }
+  quoted.push_back('"');
+  return quoted;
+}
+
+}
+
+void setTraceEnabled(bool enabled)
+{
+  if ( enabled ) {
+    std::lock_guard<std::mutex> lock(traceMutex);
+    for (auto& buffer : traceBuffers) {
+      buffer->events.clear();
+      buffer->next = 0;
+      buffer->nRecorded = 0;
+    }
+    traceEpoch = std::chrono::steady_clock::now();
+  }
+  traceSwitch.store(enabled, std::memory_order_relaxed);
+}
+
+void writeTrace(const std::string& fileName)
+{
+  std::ofstream traceFile(fileName);
+  if ( !traceFile.is_open() ) {
+    std::string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("Could not write the trace file: ");
+    exceptionMsgThrown.append(fileName);
+    exceptionMsgThrown.append("\n");
+    throw exceptionMsgThrown;
+  }
+
+  std::lock_guard<std::mutex> lock(traceMutex);
+  uint64_t nOverwritten = 0;
+  traceFile << std::setprecision(15)
+            << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+            << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,"
+            << "\"args\":{\"name\":\"RRAMSpec\"}}";
+  for (const auto& buffer : traceBuffers) {
+    traceFile << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,"
+              << "\"tid\":" << buffer->threadID << ",\"args\":{\"name\":"
+              << traceString("Thread " + std::to_string(buffer->threadID))
+              << "}}";
+
+    // Oldest event first - at the next slot once the ring is full
+    size_t nEvents = buffer->events.size();
+    nOverwritten += buffer->nRecorded - nEvents;
+    size_t first = buffer->nRecorded > nEvents ? buffer->next : 0;
+    for (size_t eventID = 0; eventID < nEvents; ++eventID) {
+      const TraceEvent& event = buffer->events[(first + eventID) % nEvents];
+      traceFile << ",\n{\"name\":" << traceString(event.name)
+                << ",\"cat\":\"rramspec\",\"ph\":\"X\",\"pid\":1,\"tid\":"
+                << buffer->threadID << ",\"ts\":" << event.start
+                << ",\"dur\":" << event.duration << ",\"args\":{";
+      bool firstArg = true;
+      if ( !event.detail.empty() ) {
+        traceFile << "\"detail\":" << traceString(event.detail);
+        firstArg = false;
+      }
+      if ( event.iterations > 0 ) {
+        traceFile << (firstArg ? "" : ",") << "\"solver iterations\":"
+                  << event.iterations;
+      }
+      traceFile << "}}";
+    }
+  }
+  traceFile << "\n]}\n";
+
+  if ( nOverwritten > 0 ) {
+    PRINT_WARNING("The trace lost its " << nOverwritten << " oldest"
+                  << " events - each thread keeps the last "
+                  << TRACE_BUFFER_EVENTS << ".");
+  }
+}
+
+TraceScope::TraceScope(const char* name_)
+  : name(name_)
+{
+  recording = traceEnabled();
+  if ( recording ) {
+    start = traceTime();
+    firstIteration = threadPerfStats().solverIterations;
+  }
+}
+
+TraceScope::~TraceScope()
+{
+  if ( !recording ) {
+    return;
+  }
+
+  TraceEvent event;
+  event.name = name;
+  event.detail.swap(detail);
+  event.start = start;
+  event.duration = traceTime() - start;
+  event.iterations = threadPerfStats().solverIterations - firstIteration;
+
+  TraceBuffer& buffer = traceBuffer();
+  if ( buffer.events.size() < TRACE_BUFFER_EVENTS ) {
+    buffer.events.push_back(std::move(event));
+  }
+  else {
+    buffer.events[buffer.next] = std::move(event);
+    buffer.next = (buffer.next + 1) % TRACE_BUFFER_EVENTS;
+  }
+  ++buffer.nRecorded;
+}
+
+bool
+TraceScope::isRecording() const
+{
+  return recording;
+}
+
+void
+TraceScope::setDetail(const std::string& detail_)
+{
+  detail = detail_;
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+#ifndef TRACE_H
+#define TRACE_H
+
+/* Timeline of the model evaluation, written as a Chrome trace (JSON
+ * object format, opened by chrome://tracing or ui.perfetto.dev).
+ * Scopes marked with TRACE_SCOPE are recorded as complete events, with
+ * the solver iterations they ran. Each thread records into its own ring
+ * buffer, with no lock; the oldest events are overwritten when it is
+ * full. Buffers outlive their threads and are handed to the next new
+ * thread, so short-lived worker threads share timeline rows. Nothing is
+ * recorded unless enabled at run time, and the recording is compiled out
+ * with RRAMSPEC_TRACE=0.
+*/
+
+#include <atomic>
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+#include "PerfStats.h"
+
+// Recording compiled in - disabled at run time unless asked for
+#ifndef RRAMSPEC_TRACE
+#define RRAMSPEC_TRACE 1
+#endif
+
+// Events kept per thread before the oldest are overwritten
+#define TRACE_BUFFER_EVENTS 65536
+
+// Whether events are recorded, for the whole process - off by default
+//  Checked inline, as it guards every traced scope
+extern std::atomic<bool> traceSwitch;
+inline bool traceEnabled()
+{
+  return traceSwitch.load(std::memory_order_relaxed);
+}
+// Enabling starts the timeline clock and clears the recorded events
+void setTraceEnabled(bool enabled);
+
+// Writes the events recorded so far as Chrome trace JSON. Failures throw
+//  the [ERROR] message as a string
+void writeTrace(const std::string& fileName);
+
+// Records its scope as one event, named by a string literal, with an
+//  optional detail shown in its arguments
+class TraceScope
+{
+public:
+  explicit TraceScope(const char* name);
+  ~TraceScope();
+  TraceScope(const TraceScope&) = delete;
+  TraceScope& operator=(const TraceScope&) = delete;
+
+  bool isRecording() const;
+  void setDetail(const std::string& detail);
+
+private:
+  const char* name;
+  bool recording;
+  double start;
+  uint64_t firstIteration;
+  std::string detail;
+};
+
+#if RRAMSPEC_TRACE
+#define TRACE_SCOPE(name) \
+    TraceScope PERF_CONCAT(traceScope, __LINE__)(name)
+// The detail is a stream expression, only formatted when recording
+#define TRACE_SCOPE_DETAIL(name, detail) \
+    TraceScope PERF_CONCAT(traceScope, __LINE__)(name); \
+    if ( PERF_CONCAT(traceScope, __LINE__).isRecording() ) { \
+      std::ostringstream traceDetail; \
+      traceDetail << detail; \
+      PERF_CONCAT(traceScope, __LINE__).setDetail(traceDetail.str()); }
+#else
+#define TRACE_SCOPE(name) do{ } while(false)
+#define TRACE_SCOPE_DETAIL(name, detail) do{ } while(false)
+#endif
+
+#endif // TRACE_H
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+#include "WorkerPool.h"
+
+WorkerPool::WorkerPool()
+{
+  runID = 0;
+  runJob = nullptr;
+  nRunWorkers = 0;
+  nPendingWorkers = 0;
+  stopping = false;
+}
+
+WorkerPool::WorkerPool(const WorkerPool&)
+  : WorkerPool()
+{
+}
+
+WorkerPool&
+WorkerPool::operator=(const WorkerPool&)
+{
+  return *this;
+}
+
+WorkerPool::~WorkerPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+  }
+  runStarted.notify_all();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+void
+WorkerPool::run(size_t nWorkers, const std::function<void(size_t)>& job)
+{
+  if ( nWorkers <= 1 ) {
+    if ( nWorkers == 1 ) {
+      job(0);
+    }
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    // Threads started now have not seen this run yet
+    for (size_t worker = threads.size() + 1; worker < nWorkers; ++worker) {
+      threads.emplace_back(&WorkerPool::threadLoop, this, worker, runID);
+    }
+    ++runID;
+    runJob = &job;
+    nRunWorkers = nWorkers;
+    nPendingWorkers = nWorkers - 1;
+    workerErrors.assign(nWorkers, nullptr);
+    workerStats.assign(nWorkers, PerfStats());
+  }
+  runStarted.notify_all();
+
+  std::exception_ptr callerError;
+  try {
+    job(0);
+  } catch(...) {
+    callerError = std::current_exception();
+  }
+
+  std::unique_lock<std::mutex> lock(mutex);
+  runFinished.wait(lock, [this]() { return nPendingWorkers == 0; });
+  for (size_t worker = 1; worker < nWorkers; ++worker) {
+    threadPerfStats() += workerStats[worker];
+  }
+  workerErrors[0] = callerError;
+  for (auto& workerError : workerErrors) {
+    if ( workerError ) {
+      std::rethrow_exception(workerError);
+    }
+  }
+}
+
+size_t
+WorkerPool::getNThreads() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return threads.size();
+}
+
+void
+WorkerPool::threadLoop(size_t worker, uint64_t lastRunID)
+{
+  std::unique_lock<std::mutex> lock(mutex);
+  while ( true ) {
+    runStarted.wait(lock, [&]() { return stopping || runID != lastRunID; });
+    if ( stopping ) {
+      return;
+    }
+    lastRunID = runID;
+    // Runs on fewer threads leave the others asleep
+    if ( worker >= nRunWorkers ) {
+      continue;
+    }
+
+    lock.unlock();
+    std::exception_ptr error;
+    try {
+      (*runJob)(worker);
+    } catch(...) {
+      error = std::current_exception();
+    }
+    lock.lock();
+
+    workerErrors[worker] = error;
+    workerStats[worker] = threadPerfStats();
+    threadPerfStats() = PerfStats();
+    if ( --nPendingWorkers == 0 ) {
+      runFinished.notify_one();
+    }
+  }
+}
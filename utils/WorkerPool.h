@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2019, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Andr'e L. Chinazzo, Deepak M. Mathew, Christian Weis
+ */
+
+
+#ifndef WORKERPOOL_H
+#define WORKERPOOL_H
+
+/* Threads kept alive between the parallel runs of their owner. A solver
+ * splitting every step of a solve among threads runs thousands of times
+ * per solve, so each run only wakes the pool threads up instead of
+ * starting and joining new ones. Pool threads are started by the first
+ * run needing them, and joined when the pool is destroyed. A pool serves
+ * one calling thread at a time.
+*/
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "PerfStats.h"
+
+class WorkerPool
+{
+public:
+  WorkerPool();
+  ~WorkerPool();
+  // Copies start without threads, so their owners stay copyable
+  WorkerPool(const WorkerPool&);
+  WorkerPool& operator=(const WorkerPool&);
+
+  // Runs job(0) to job(nWorkers-1) at once - job(0) on the calling thread,
+  //  the others on pool threads - and returns when all of them are done.
+  //  Counters of the pool threads go to the calling thread. If jobs throw,
+  //  the exception of the lowest failing one is rethrown
+  void run(size_t nWorkers, const std::function<void(size_t)>& job);
+
+  // Pool threads started so far
+  size_t getNThreads() const;
+
+private:
+  std::vector<std::thread> threads;
+  mutable std::mutex mutex;
+  std::condition_variable runStarted;
+  std::condition_variable runFinished;
+
+  // Current run - each pool thread takes part in a run at most once
+  uint64_t runID;
+  const std::function<void(size_t)>* runJob;
+  size_t nRunWorkers;
+  size_t nPendingWorkers;
+  std::vector<std::exception_ptr> workerErrors;
+  // Counters of each pool thread, added up by the calling thread once the
+  //  whole run is done - it may still be counting while they finish
+  std::vector<PerfStats> workerStats;
+  bool stopping;
+
+  void threadLoop(size_t worker, uint64_t lastRunID);
+};
+
+#endif // WORKERPOOL_H
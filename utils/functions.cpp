@@ -37,6 +37,15 @@
 #include "functions.h"
 #include <stdio.h>
 #include <iostream>
+#include <cstring>
+#include <deque>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include <sys/stat.h>
 
 bool isValid( const ebool& flag )
 {
@@ -259,5 +268,286 @@ double tausToPercentLumpedRC(double percentage)
   return nTaus;
 }
 
+double unselectedLineBias(biasSchemes scheme, bool isPLine)
+{
+  switch (scheme) {
+    case half_bias:
+      return 0.5;
+    case third_bias:
+      return isPLine? 1./3. : 2./3.;
+    case floating_bias:
+      return 0.;
+    default:
+      std::string exceptionMsgThrown("[ERROR] ");
+      exceptionMsgThrown.append("Unexpected behaviour - ");
+      exceptionMsgThrown.append("unknown bias scheme for unselected lines.\n");
+      throw exceptionMsgThrown;
+  }
+}
+
+bool dominates(const std::vector<double>& lhs, const std::vector<double>& rhs)
+{
+  bool smallerOnAny = false;
+  for (size_t objectiveID = 0; objectiveID < lhs.size(); ++objectiveID) {
+    if ( lhs[objectiveID] > rhs[objectiveID] ) {
+      return false;
+    }
+    if ( lhs[objectiveID] < rhs[objectiveID] ) {
+      smallerOnAny = true;
+    }
+  }
+  return smallerOnAny;
+}
+
+uint64_t hashString(const std::string& str)
+{
+  uint64_t hash = 14695981039346656037ull;
+  for (unsigned char byte : str) {
+    hash ^= byte;
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+std::string fileStamp(const std::string& fileName)
+{
+  struct stat fileStatus;
+  if ( stat(fileName.c_str(), &fileStatus) != 0 ) {
+    return std::string();
+  }
+#ifdef __APPLE__
+  const struct timespec& modificationTime = fileStatus.st_mtimespec;
+#else
+  const struct timespec& modificationTime = fileStatus.st_mtim;
+#endif
+  return std::to_string(modificationTime.tv_sec) + "."
+         + std::to_string(modificationTime.tv_nsec) + " "
+         + std::to_string(fileStatus.st_size);
+}
+
+// Thread budget of each thread - 0 while it has all hardware threads
+static thread_local size_t threadBudgetThreads = 0;
+
+size_t threadBudget()
+{
+  if ( threadBudgetThreads == 0 ) {
+    return std::max(std::thread::hardware_concurrency(), 1u);
+  }
+  return threadBudgetThreads;
+}
+
+ThreadBudget::ThreadBudget(size_t nThreads)
+{
+  previousBudget = threadBudgetThreads;
+  threadBudgetThreads = std::max(nThreads, (size_t) 1);
+}
+
+ThreadBudget::~ThreadBudget()
+{
+  threadBudgetThreads = previousBudget;
+}
+
+size_t nWorkerThreads(size_t nThreads)
+{
+  if ( nThreads == 0 ) {
+    return threadBudget();
+  }
+  return nThreads;
+}
+
+void runParallelTasks(size_t nTasks, size_t nThreads,
+                      const std::function<void(size_t)>& task)
+{
+  nThreads = std::min(nWorkerThreads(nThreads), nTasks);
+  if ( nThreads == 0 ) {
+    return;
+  }
+
+  // One task queue per thread - tasks are long, so a lock per queue costs
+  //  nothing next to them
+  std::vector<std::deque<size_t>> queues(nThreads);
+  std::vector<std::mutex> queueMutexes(nThreads);
+  for (size_t taskID = 0; taskID < nTasks; ++taskID) {
+    queues[taskID % nThreads].push_back(taskID);
+  }
+
+  std::vector<std::exception_ptr> taskErrors(nTasks);
+
+  // Threads split the budget of the calling thread among them
+  const size_t workerBudget = threadBudget() / nThreads;
+
+  // Counters of the workers go to the calling thread, as it waits for them
+  PerfStats& callerStats = threadPerfStats();
+  std::mutex callerStatsMutex;
+
+  auto worker = [&](size_t threadID) {
+    ThreadBudget budget(workerBudget);
+    while ( true ) {
+      bool found = false;
+      size_t taskID = 0;
+      {
+        std::lock_guard<std::mutex> lock(queueMutexes[threadID]);
+        if ( !queues[threadID].empty() ) {
+          taskID = queues[threadID].front();
+          queues[threadID].pop_front();
+          found = true;
+        }
+      }
+      // Own queue is empty - steal from the others, in turn
+      for (size_t victim = 1; !found && victim < nThreads; ++victim) {
+        size_t victimID = (threadID + victim) % nThreads;
+        std::lock_guard<std::mutex> lock(queueMutexes[victimID]);
+        if ( !queues[victimID].empty() ) {
+          taskID = queues[victimID].back();
+          queues[victimID].pop_back();
+          found = true;
+        }
+      }
+      // Tasks never spawn tasks, so all queues stay empty from here on
+      if ( !found ) {
+        std::lock_guard<std::mutex> lock(callerStatsMutex);
+        callerStats += threadPerfStats();
+        return;
+      }
+
+      try {
+        task(taskID);
+      } catch(...) {
+        taskErrors[taskID] = std::current_exception();
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (size_t threadID = 0; threadID < nThreads; ++threadID) {
+    threads.emplace_back(worker, threadID);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (auto& taskError : taskErrors) {
+    if ( taskError ) {
+      std::rethrow_exception(taskError);
+    }
+  }
+}
+
+// Redirection of each thread's messages - null while printing to std::cout
+static thread_local std::ostream* threadMessageStream = nullptr;
+
+std::ostream& messageStream()
+{
+  if ( threadMessageStream == nullptr ) {
+    return std::cout;
+  }
+  return *threadMessageStream;
+}
+
+std::ostream* redirectMessages(std::ostream* stream)
+{
+  std::ostream* previousStream = threadMessageStream;
+  threadMessageStream = stream;
+  return previousStream;
+}
+
+MessageRedirection::MessageRedirection(std::ostream* stream)
+{
+  previousStream = redirectMessages(stream);
+}
+
+MessageRedirection::~MessageRedirection()
+{
+  redirectMessages(previousStream);
+}
+
+// Level told by the tag the line starts with - -1 for untagged lines
+static int taggedLevel(const std::string& messages, size_t lineStart)
+{
+  static const std::pair<const char*, int> levelTags[] = {
+    {"[ERROR] ", LOG_LEVEL_ERROR}, {"[WARNING] ", LOG_LEVEL_WARNING},
+    {"[INFO] ", LOG_LEVEL_INFO}, {"[DEBUG] ", LOG_LEVEL_DEBUG}};
+
+  for (const auto& levelTag : levelTags) {
+    if ( messages.compare(lineStart, std::strlen(levelTag.first),
+                          levelTag.first) == 0 ) {
+      return levelTag.second;
+    }
+  }
+  return -1;
+}
+
+void printMessages(const std::string& messages)
+{
+  if ( threadMessageStream != nullptr ) {
+    *threadMessageStream << messages;
+    return;
+  }
+
+  std::ostream* stream = &std::cout;
+  size_t lineStart = 0;
+  while ( lineStart < messages.size() ) {
+    size_t lineEnd = messages.find('\n', lineStart);
+    lineEnd = (lineEnd == std::string::npos) ? messages.size() : lineEnd + 1;
+
+    int level = taggedLevel(messages, lineStart);
+    if ( level >= 0 ) {
+      std::ostream* levelStream = (level <= LOG_LEVEL_WARNING) ?
+                                  &std::cerr : &std::cout;
+      // Keeps the order of both streams on a terminal
+      if ( levelStream != stream ) {
+        stream->flush();
+      }
+      stream = levelStream;
+    }
+    stream->write(messages.data() + lineStart, lineEnd - lineStart);
+    lineStart = lineEnd;
+  }
+}
+
+MessageBuffer::MessageBuffer()
+{
+  previousStream = redirectMessages(&buffer);
+}
+
+MessageBuffer::~MessageBuffer()
+{
+  redirectMessages(previousStream);
+  printMessages(buffer.str());
+}
 
+// Least important level printed - shared by all threads
+static std::atomic<int> runtimeLogLevel(LOG_LEVEL_INFO);
 
+int logLevel()
+{
+  return runtimeLogLevel.load(std::memory_order_relaxed);
+}
+
+void setLogLevel(int level)
+{
+  runtimeLogLevel.store(level, std::memory_order_relaxed);
+}
+
+int logLevelFromName(const std::string& levelName)
+{
+  if ( levelName == "error" ) { return LOG_LEVEL_ERROR; }
+  if ( levelName == "warning" ) { return LOG_LEVEL_WARNING; }
+  if ( levelName == "info" ) { return LOG_LEVEL_INFO; }
+  if ( levelName == "debug" ) { return LOG_LEVEL_DEBUG; }
+
+  std::string exceptionMsgThrown("[ERROR] ");
+  exceptionMsgThrown.append("Log level \"");
+  exceptionMsgThrown.append(levelName);
+  exceptionMsgThrown.append("\" is unknown. Use \"error\", \"warning\",");
+  exceptionMsgThrown.append(" \"info\" or \"debug\".\n");
+  throw exceptionMsgThrown;
+}
+
+std::ostream& logStream(int level)
+{
+  if ( threadMessageStream == nullptr && level <= LOG_LEVEL_WARNING ) {
+    return std::cerr;
+  }
+  return messageStream();
+}
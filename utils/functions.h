@@ -40,13 +40,19 @@
 #include <algorithm>
 #include <numeric>
 #include <cmath>
+#include <cstdint>
+#include <string>
 #include <vector>
 
 #include <iostream>
 #include <iomanip>
+#include <functional>
+#include <sstream>
 
 #include "constants.h"
 #include "globalStructs.h"
+#include "PerfStats.h"
+#include "Trace.h"
 
 #include "../expandedBoostUnits/Units/rramSpec_units.h"
 
@@ -162,17 +168,137 @@ double tausToPercentSingleRC(double percentage);
 
 double tausToPercentLumpedRC(double percentage);
 
+// Fraction of the bias voltage at which unselected lines parallel to the
+//  positive (isPLine) or grounded selected line are driven. Floating lines
+//  are not driven and are taken as discharged (0)
+double unselectedLineBias(biasSchemes scheme, bool isPLine);
+
+// Whether lhs Pareto-dominates rhs - no objective greater and at least one
+//  smaller, all objectives minimized
+bool dominates(const std::vector<double>& lhs, const std::vector<double>& rhs);
+
+// 64-bit FNV-1a hash of the string bytes - stable across runs and machines
+uint64_t hashString(const std::string& str);
+
+// Modification time and size of the file, telling whether it changed
+//  between two calls - empty if the file cannot be stat'ed
+std::string fileStamp(const std::string& fileName);
+
+// Hardware threads the calling thread may keep busy - all of them, unless
+//  it runs tasks of runParallelTasks, which splits its own budget evenly
+//  among its threads (at least one each)
+size_t threadBudget();
+
+// Sets the thread budget of the calling thread while in scope
+class ThreadBudget
+{
+public:
+  explicit ThreadBudget(size_t nThreads);
+  ~ThreadBudget();
+  ThreadBudget(const ThreadBudget&) = delete;
+  ThreadBudget& operator=(const ThreadBudget&) = delete;
+
+private:
+  size_t previousBudget;
+};
+
+// Threads running the tasks when nThreads are requested (0 for the thread
+//  budget of the calling thread)
+size_t nWorkerThreads(size_t nThreads);
+
+// Runs task(0) to task(nTasks-1) on nThreads threads (0 for the thread
+//  budget of the calling thread). Tasks are dealt round-robin to the
+//  threads, which take their own from the front and steal from the back of
+//  the others when idle. Each thread gets its share of the calling thread
+//  budget, so nested parallel work does not oversubscribe the machine.
+//  If tasks throw, the exception of the lowest failing task is rethrown
+//  after all threads finish, whatever the timing
+void runParallelTasks(size_t nTasks, size_t nThreads,
+                      const std::function<void(size_t)>& task);
+
+// Stream taking the messages printed by the calling thread - std::cout
+//  unless redirected (nullptr restores it), so messages of parallel tasks
+//  can be collected apart and printed in order. Redirecting returns the
+//  previous stream, to be restored by nested redirections
+std::ostream& messageStream();
+std::ostream* redirectMessages(std::ostream* stream);
+
+// Redirects the messages of the calling thread while in scope
+class MessageRedirection
+{
+public:
+  explicit MessageRedirection(std::ostream* stream);
+  ~MessageRedirection();
+  MessageRedirection(const MessageRedirection&) = delete;
+  MessageRedirection& operator=(const MessageRedirection&) = delete;
+
+private:
+  std::ostream* previousStream;
+};
+
+// Writes messages collected apart to the message stream of the calling
+//  thread. When it is not redirected, each message goes to the stream of
+//  its level, told by its "[ERROR] ", "[WARNING] ", "[INFO] " or
+//  "[DEBUG] " tag - lines without a tag continue the message before them
+void printMessages(const std::string& messages);
+
+// Buffers the messages of the calling thread while in scope, then prints
+//  them at once as printMessages does
+class MessageBuffer
+{
+public:
+  MessageBuffer();
+  ~MessageBuffer();
+  MessageBuffer(const MessageBuffer&) = delete;
+  MessageBuffer& operator=(const MessageBuffer&) = delete;
+
+private:
+  std::ostringstream buffer;
+  std::ostream* previousStream;
+};
+
+// Levels of the messages, from the most to the least important
+#define LOG_LEVEL_ERROR   0
+#define LOG_LEVEL_WARNING 1
+#define LOG_LEVEL_INFO    2
+#define LOG_LEVEL_DEBUG   3
+
+// Messages less important than this level are compiled out
+#ifndef RRAMSPEC_LOG_LEVEL
+#define RRAMSPEC_LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+// Least important level printed at run time, for the whole process - info
+//  by default. Levels are named "error", "warning", "info" and "debug"
+int logLevel();
+void setLogLevel(int level);
+int logLevelFromName(const std::string& levelName);
+
+// Stream of the messages of the level - the thread's message stream, or
+//  stderr for warnings and errors when the thread is not redirected
+std::ostream& logStream(int level);
+
+// The message is only formatted when its level is printed, and the whole
+//  statement is compiled out above RRAMSPEC_LOG_LEVEL. Lines are not
+//  flushed, so messages cost no system call each
+#define PRINT_MESSAGE(level, message) \
+    do{ if ( (level) <= RRAMSPEC_LOG_LEVEL && (level) <= logLevel() ) { \
+          logStream(level) << message << '\n'; } } while(false)
+
 #define PRINT_VAR(varName) \
-    do{std::cout << #varName " = " << std::setprecision(60) \
-       << varName << std::endl;} while(false)
+    PRINT_MESSAGE(LOG_LEVEL_DEBUG, \
+                  #varName " = " << std::setprecision(60) << varName)
+
+#define PRINT_DEBUG(debugString) \
+    PRINT_MESSAGE(LOG_LEVEL_DEBUG, "[DEBUG] " << debugString)
 
 #define PRINT_INFO(infoString) \
-    do{ std::cout << "[INFO] " << infoString << std::endl;} while(false)
+    PRINT_MESSAGE(LOG_LEVEL_INFO, "[INFO] " << infoString)
 
 #define PRINT_WARNING(warningString) \
-    do{ std::cerr << "[WARNING] " << warningString << std::endl;} while(false)
+    PRINT_MESSAGE(LOG_LEVEL_WARNING, "[WARNING] " << warningString)
 
 #define PRINT_ERROR(errorString) \
-    do{ std::cerr << "[ERROR] " << errorString << std::endl;} while(false)
+    PRINT_MESSAGE(LOG_LEVEL_ERROR, "[ERROR] " << errorString)
 
 #endif // FUNCTIONS_H
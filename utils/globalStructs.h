@@ -57,4 +57,6 @@ enum lineTypes {wordline, bitline, any_lt};
 
 enum selectionTypes {full_selected, half_selected, any_st};
 
+enum biasSchemes {half_bias, third_bias, floating_bias, invalid_bias};
+
 #endif // GLOBALSTRUCTS_H